@@ -5,10 +5,12 @@
 
 #import <Foundation/Foundation.h>
 #import <AppLovinSDK/AppLovinSDK.h>
+#import "MAUnityLogger.h"
 
 NS_ASSUME_NONNULL_BEGIN
 typedef const void *MAUnityRef;
 typedef void (*ALUnityBackgroundCallback)(const char* args);
+typedef void (*ALUnityBinaryBackgroundCallback)(const uint8_t* bytes, int length);
 
 @interface MAUnityAdManager : NSObject
 
@@ -23,6 +25,8 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 - (void)stopBannerAutoRefreshForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)setBannerExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable NSString *)value;
 - (void)setBannerLocalExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable id)value;
+- (void)setBannerExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters;
+- (void)setBannerLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters;
 - (void)setBannerCustomData:(nullable NSString *)customData forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)setBannerWidth:(CGFloat)width forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)updateBannerPosition:(nullable NSString *)bannerPosition forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
@@ -30,7 +34,7 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 - (void)showBannerWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)destroyBannerWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)hideBannerWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
-- (NSString *)bannerLayoutForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
+- (CGRect)bannerFrameForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 + (CGFloat)adaptiveBannerHeightForWidth:(CGFloat)width;
 
 - (void)createMRecWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier atPosition:(nullable NSString *)mrecPosition;
@@ -41,31 +45,47 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 - (void)stopMRecAutoRefreshForAdUnitIdentifier:(nullable NSString *)adUnitIdentifer;
 - (void)setMRecExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable NSString *)value;
 - (void)setMRecLocalExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable id)value;
+- (void)setMRecExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters;
+- (void)setMRecLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters;
 - (void)setMRecCustomData:(nullable NSString *)customData forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)showMRecWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)destroyMRecWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)hideMRecWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)updateMRecPosition:(nullable NSString *)mrecPosition forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)updateMRecPosition:(CGFloat)xOffset y:(CGFloat)yOffset forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
-- (NSString *)mrecLayoutForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
+- (CGRect)mrecFrameForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 
 - (void)loadInterstitialWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (BOOL)isInterstitialReadyWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)showInterstitialWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier placement:(nullable NSString *)placement customData:(nullable NSString *)customData;
 - (void)setInterstitialExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable NSString *)value;
 - (void)setInterstitialLocalExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable id)value;
+- (void)setInterstitialExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters;
+- (void)setInterstitialLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters;
 
 - (void)loadAppOpenAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (BOOL)isAppOpenAdReadyWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)showAppOpenAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier placement:(nullable NSString *)placement customData:(nullable NSString *)customData;
 - (void)setAppOpenAdExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable NSString *)value;
 - (void)setAppOpenAdLocalExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable id)value;
+- (void)setAppOpenAdExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters;
+- (void)setAppOpenAdLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters;
 
 - (void)loadRewardedAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (BOOL)isRewardedAdReadyWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 - (void)showRewardedAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier placement:(nullable NSString *)placement customData:(nullable NSString *)customData;
 - (void)setRewardedAdExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable NSString *)value;
 - (void)setRewardedAdLocalExtraParameterForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier key:(nullable NSString *)key value:(nullable id)value;
+- (void)setRewardedAdExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters;
+- (void)setRewardedAdLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters;
+
+// Ad Unit Handles
+
+/**
+ * Returns a positive handle for the ad unit identifier, or 0 if the identifier is empty. Registering the same identifier again returns the same handle.
+ */
+- (int)registerAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
+- (nullable NSString *)adUnitIdentifierForHandle:(int)handle;
 
 // Event Tracking
 - (void)trackEvent:(nullable NSString *)event parameters:(nullable NSString *)parameters;
@@ -73,6 +93,13 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 // Ad Value
 - (NSString *)adValueForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier withKey:(nullable NSString *)key;
 
+// Debugging
+
+/**
+ * A JSON description of every ad unit the plugin is tracking and the memory held by its record. Must be called on the main thread.
+ */
+- (NSString *)adUnitStateDebugDump;
+
 // User Service
 - (void)didDismissUserConsentDialog;
 
@@ -84,6 +111,42 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 + (NSDictionary<NSString *, id> *)deserializeParameters:(nullable NSString *)serialized;
 
 + (void)setUnityBackgroundCallback:(ALUnityBackgroundCallback)unityBackgroundCallback;
++ (void)setUnityBinaryBackgroundCallback:(ALUnityBinaryBackgroundCallback)unityBinaryBackgroundCallback;
+
+/**
+ * When enabled, ad events are forwarded to Unity using the compact binary encoding in @c MAUnityEventCodec.h instead of JSON.
+ * Events that have no binary event id (e.g. SDK initialization or CMP events) are always forwarded as JSON.
+ */
++ (void)setBinaryEventEncodingEnabled:(BOOL)enabled;
+
+/**
+ * Sets which ad events have at least one listener in Unity. Bit @c n corresponds to the event with id @c n in @c max_unity_event_id.
+ * Ad events without a listener are dropped before their payload is built. Events without an event id are always forwarded.
+ */
++ (void)setEventSubscriptionMask:(uint64_t)mask;
+
+/**
+ * Sets the version of the event payloads Unity understands, one of the @c MAX_UNITY_EVENT_PAYLOAD_VERSION_* constants. From @c MAX_UNITY_EVENT_PAYLOAD_VERSION_TYPED_NUMBERS,
+ * numeric values such as revenue, latencies and error codes are sent as JSON numbers instead of strings. Defaults to @c MAX_UNITY_EVENT_PAYLOAD_VERSION_STRING_NUMBERS.
+ */
++ (void)setEventPayloadVersion:(int)version;
+
+/**
+ * Sets how much of an ad's waterfall is included in an ad event, one of the @c MAX_UNITY_PAYLOAD_LEVEL_* constants. Cached ad info is kept per level.
+ * An event id from @c max_unity_event_id sets the level of that event only. Any other id sets the level of every event and clears the levels set for individual events.
+ */
++ (void)setPayloadLevel:(int)level forEventIdentifier:(int)eventIdentifier;
+
+/**
+ * Sets how long, in milliseconds, events are held so that events received shortly after can be sent to Unity with them in a single callback.
+ * Events received while the application is not active are always batched. Defaults to @c 0.
+ */
++ (void)setEventBatchingWindowMillis:(int)millis;
+
+/**
+ * Formats the message and hands it to the background log writer in @c MAUnityLogger.h. Prefer the @c MAX_UNITY_LOG_* macros, which skip evaluating the arguments when the level is disabled.
+ */
++ (void)logWithLevel:(max_unity_log_level)level tag:(NSString *)tag format:(NSString *)format, ... NS_FORMAT_FUNCTION(3, 4);
 
 /**
  * Creates an instance of @c MAUnityAdManager if needed and returns the singleton instance.
@@ -94,4 +157,10 @@ typedef void (*ALUnityBackgroundCallback)(const char* args);
 
 @end
 
+// Logs with the `TAG` of the file using the macro
+#define MAX_UNITY_LOG(_LEVEL, ...) do { if ( MAX_UNITY_LOG_IS_ENABLED(_LEVEL) ) [MAUnityAdManager logWithLevel: (_LEVEL) tag: TAG format: __VA_ARGS__]; } while ( 0 )
+#define MAX_UNITY_LOG_DEBUG(...) MAX_UNITY_LOG(MAX_UNITY_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define MAX_UNITY_LOG_WARNING(...) MAX_UNITY_LOG(MAX_UNITY_LOG_LEVEL_WARNING, __VA_ARGS__)
+#define MAX_UNITY_LOG_ERROR(...) MAX_UNITY_LOG(MAX_UNITY_LOG_LEVEL_ERROR, __VA_ARGS__)
+
 NS_ASSUME_NONNULL_END
@@ -4,6 +4,13 @@
 //
 
 #import "MAUnityAdManager.h"
+#import "MAUnityAdViewLayout.h"
+#import "MAUnityEventCodec.h"
+#import "MAUnityPipelineStats.h"
+#import "MAUnityTimelineTracer.h"
+#import <malloc/malloc.h>
+#import <objc/runtime.h>
+#import <stdatomic.h>
 
 #define KEY_WINDOW [UIApplication sharedApplication].keyWindow
 #define DEVICE_SPECIFIC_ADVIEW_AD_FORMAT ([[UIDevice currentDevice] userInterfaceIdiom] == UIUserInterfaceIdiomPad) ? MAAdFormat.leader : MAAdFormat.banner
@@ -13,8 +20,6 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-    
-    extern bool max_unity_should_disable_all_logs(void);  // Forward declaration
 
     // UnityAppController.mm
     UIViewController* UnityGetGLViewController(void);
@@ -24,17 +29,43 @@ extern "C" {
     int UnityIsPaused(void);
     void UnityPause(int pause);
     
+    // Runs the block and, while timeline tracing is enabled, records how long it ran and how long it waited since `dispatchTimestamp`
+    static void max_unity_run_traced_main_thread_block(dispatch_block_t block, uint64_t dispatchTimestamp)
+    {
+        uint64_t startTimestamp = max_unity_timeline_now();
+        block();
+        
+        if ( startTimestamp == 0 || dispatchTimestamp == 0 ) return;
+        
+        uint64_t waitMicros = startTimestamp > dispatchTimestamp ? (startTimestamp - dispatchTimestamp) / 1000 : 0;
+        max_unity_timeline_record(MAX_UNITY_TIMELINE_SPAN_MAIN_THREAD, waitMicros < UINT32_MAX ? (uint32_t) waitMicros : UINT32_MAX, startTimestamp, max_unity_timeline_now());
+    }
+    
     void max_unity_dispatch_on_main_thread(dispatch_block_t block)
     {
         if ( block )
         {
+            uint64_t dispatchTimestamp = max_unity_timeline_now();
             if ( [NSThread isMainThread] )
             {
-                block();
+                if ( dispatchTimestamp == 0 )
+                {
+                    block();
+                }
+                else
+                {
+                    max_unity_run_traced_main_thread_block(block, dispatchTimestamp);
+                }
+            }
+            else if ( dispatchTimestamp == 0 )
+            {
+                dispatch_async(dispatch_get_main_queue(), block);
             }
             else
             {
-                dispatch_async(dispatch_get_main_queue(), block);
+                dispatch_async(dispatch_get_main_queue(), ^{
+                    max_unity_run_traced_main_thread_block(block, dispatchTimestamp);
+                });
             }
         }
     }
@@ -42,38 +73,41 @@ extern "C" {
 }
 #endif
 
+@class MAUnityPendingEvent;
+@class MAUnityAdUnitState;
+@class MAUnityLayoutObserverView;
+
 @interface MAUnityAdManager()<MAAdDelegate, MAAdViewAdDelegate, MARewardedAdDelegate, MAAdRevenueDelegate, MAAdReviewDelegate, MAAdExpirationDelegate>
 
 // Parent Fields
 @property (nonatomic, weak) ALSdk *sdk;
 
-// Fullscreen Ad Fields
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAInterstitialAd *> *interstitials;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAAppOpenAd *> *appOpenAds;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MARewardedAd *> *rewardedAds;
+// Ad Unit Fields
+@property (nonatomic, strong) NSMutableDictionary<NSString *, MAUnityAdUnitState *> *adUnitStates;
+@property (nonatomic, strong) NSObject *adUnitStatesLock;
+
+// Handles given out to Unity so hot calls can skip marshaling the ad unit identifier. Handle `n` maps to index `n - 1`. Guarded by `adUnitStatesLock`.
+@property (nonatomic, strong) NSMutableArray<NSString *> *adUnitIdentifiersByHandle;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *adUnitHandles;
 
 // AdView Fields
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAAdView *> *adViews;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAAdFormat *> *adViewAdFormats;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSString *> *adViewPositions;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSValue *> *adViewOffsets;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *adViewWidths;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAAdFormat *> *verticalAdViewFormats;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSArray<NSLayoutConstraint *> *> *adViewConstraints;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, NSString *> *> *adViewExtraParametersToSetAfterCreate;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, id> *> *adViewLocalExtraParametersToSetAfterCreate;
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSString *> *adViewCustomDataToSetAfterCreate;
-@property (nonatomic, strong) NSMutableArray<NSString *> *adUnitIdentifiersToShowAfterCreate;
-@property (nonatomic, strong) NSMutableSet<NSString *> *disabledAdaptiveBannerAdUnitIdentifiers;
-@property (nonatomic, strong) NSMutableSet<NSString *> *disabledAutoRefreshAdViewAdUnitIdentifiers;
-@property (nonatomic, strong) NSMutableSet<NSString *> *ignoreSafeAreaLandscapeAdUnitIdentifiers;
+@property (nonatomic, strong) NSMutableOrderedSet<NSString *> *adUnitIdentifiersNeedingLayout;
+@property (nonatomic, assign, getter=isAdViewLayoutScheduled) BOOL adViewLayoutScheduled;
+@property (nonatomic, copy, nullable) NSString *safeAreaBackgroundAdUnitIdentifier;
 @property (nonatomic, strong) UIView *safeAreaBackground;
 @property (nonatomic, strong, nullable) UIColor *publisherBannerBackgroundColor;
-
-@property (nonatomic, strong) NSMutableDictionary<NSString *, MAAd *> *adInfoDict;
-@property (nonatomic, strong) NSObject *adInfoDictLock;
-
-@property (nonatomic, strong) NSOperationQueue *backgroundCallbackEventsQueue;
+@property (nonatomic, strong) MAUnityLayoutObserverView *adViewLayoutObserver;
+@property (nonatomic, assign, getter=isAdViewFrameCheckScheduled) BOOL adViewFrameCheckScheduled;
+
+// Replaced as a whole on `eventPipelineQueue`, so it can be read from any thread without a lock
+@property (atomic, copy) NSDictionary<NSString *, MAAd *> *adInfoDict;
+
+/**
+ * Serial queue that builds every event, updates @c adInfoDict and forwards the event to Unity, so events reach Unity in the order the SDK reported them.
+ */
+@property (nonatomic, strong) dispatch_queue_t eventPipelineQueue;
+@property (nonatomic, strong) NSMutableArray<MAUnityPendingEvent *> *pendingUnityEvents; // Only accessed from `eventPipelineQueue`
+@property (nonatomic, assign) BOOL pendingUnityEventsFlushScheduled; // Only accessed from `eventPipelineQueue`
 @property (nonatomic, assign) BOOL resumeUnityAfterApplicationBecomesActive;
 
 @end
@@ -96,11 +130,277 @@ extern "C" {
 @property (nonatomic, assign, readonly, getter=isAdViewAd) BOOL adViewAd;
 @end
 
+/**
+ * The part of an ad's info that does not change over the lifetime of the @c MAAd. It is built once, attached to the ad as an associated object,
+ * and spliced into every later event for that ad. The placement is excluded since it is only assigned when the ad is shown.
+ */
+@interface MAUnityCachedAdInfo : NSObject
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *adInfo;
+
+/**
+ * The JSON members of @c adInfo without the enclosing braces. Computed lazily and must only be accessed from @c eventPipelineQueue.
+ */
+@property (nonatomic, copy, readonly) NSString *serializedAdInfoFragment;
+
+- (instancetype)initWithAdInfo:(NSDictionary<NSString *, id> *)adInfo;
+@end
+
+@implementation MAUnityCachedAdInfo
+{
+    NSString *_serializedAdInfoFragment;
+}
+
+- (instancetype)initWithAdInfo:(NSDictionary<NSString *, id> *)adInfo
+{
+    self = [super init];
+    if ( self )
+    {
+        _adInfo = [adInfo copy];
+    }
+    return self;
+}
+
+- (NSString *)serializedAdInfoFragment
+{
+    if ( !_serializedAdInfoFragment )
+    {
+        NSString *serializedAdInfo = [MAUnityAdManager serializeParameters: self.adInfo];
+        _serializedAdInfoFragment = serializedAdInfo.length > 2 ? [serializedAdInfo substringWithRange: NSMakeRange(1, serializedAdInfo.length - 2)] : @"";
+    }
+    
+    return _serializedAdInfoFragment;
+}
+
+@end
+
+/**
+ * An event waiting to be sent to Unity as part of the next batch.
+ */
+@interface MAUnityPendingEvent : NSObject
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *args;
+@property (nonatomic, strong, readonly, nullable) MAUnityCachedAdInfo *cachedAdInfo;
+
+// Pipeline stats timestamps from `max_unity_pipeline_stats_now()`, or 0 if the event was not timed
+@property (nonatomic, assign) uint64_t delegateTimestamp;
+@property (nonatomic, assign) uint64_t serializedTimestamp;
+@property (nonatomic, assign) uint16_t eventIdentifier;
+
+- (instancetype)initWithArgs:(NSDictionary<NSString *, id> *)args cachedAdInfo:(nullable MAUnityCachedAdInfo *)cachedAdInfo;
+@end
+
+@implementation MAUnityPendingEvent
+
+- (instancetype)initWithArgs:(NSDictionary<NSString *, id> *)args cachedAdInfo:(nullable MAUnityCachedAdInfo *)cachedAdInfo
+{
+    self = [super init];
+    if ( self )
+    {
+        _args = [args copy];
+        _cachedAdInfo = cachedAdInfo;
+    }
+    return self;
+}
+
+@end
+
+/**
+ * Everything the plugin tracks for one ad unit. Records live in @c adUnitStates and, apart from the fullscreen ads and @c adView, are only accessed on the main thread.
+ */
+@interface MAUnityAdUnitState : NSObject
+@property (nonatomic, copy, readonly) NSString *adUnitIdentifier;
+
+// Fullscreen Ad Fields
+@property (nonatomic, strong, nullable) MAInterstitialAd *interstitial;
+@property (nonatomic, strong, nullable) MAAppOpenAd *appOpenAd;
+@property (nonatomic, strong, nullable) MARewardedAd *rewardedAd;
+
+// AdView Fields
+@property (nonatomic, strong, nullable) MAAdView *adView;
+@property (nonatomic, strong, nullable) MAAdFormat *adViewAdFormat;
+@property (nonatomic, copy, nullable) NSString *adViewPosition;
+@property (nonatomic, assign) CGPoint adViewOffset;
+@property (nonatomic, strong, nullable) NSNumber *adViewWidth;
+@property (nonatomic, strong, nullable) MAAdFormat *verticalAdViewFormat;
+@property (nonatomic, strong, nullable) MAAdFormat *adViewFormatNeedingLayout;
+@property (nonatomic, copy, nullable) NSArray<NSLayoutConstraint *> *adViewConstraints;
+@property (nonatomic, assign) max_unity_ad_view_geometry adViewGeometry;
+@property (nonatomic, assign) BOOL hasAdViewGeometry;
+@property (nonatomic, assign) CGRect reportedAdViewFrame;
+@property (nonatomic, assign) BOOL hasReportedAdViewFrame;
+@property (nonatomic, assign, getter=isAdaptiveBannerDisabled) BOOL adaptiveBannerDisabled;
+@property (nonatomic, assign, getter=isAutoRefreshDisabled) BOOL autoRefreshDisabled;
+@property (nonatomic, assign) BOOL ignoresSafeAreaLandscape;
+
+// Settings received before the ad view was created
+@property (nonatomic, strong, nullable) NSMutableDictionary<NSString *, NSString *> *extraParametersToSetAfterCreate;
+@property (nonatomic, strong, nullable) NSMutableDictionary<NSString *, id> *localExtraParametersToSetAfterCreate;
+@property (nonatomic, copy, nullable) NSString *customDataToSetAfterCreate;
+@property (nonatomic, assign, getter=shouldShowAfterCreate) BOOL showAfterCreate;
+
+- (instancetype)initWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
+
+/**
+ * The heap memory held by the record itself and the collections it owns. Does not include the SDK ad objects.
+ */
+- (size_t)allocatedSize;
+
+- (NSDictionary<NSString *, id> *)debugInfo;
+@end
+
+@implementation MAUnityAdUnitState
+
+- (instancetype)initWithAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    self = [super init];
+    if ( self )
+    {
+        _adUnitIdentifier = [adUnitIdentifier copy];
+    }
+    return self;
+}
+
+- (size_t)allocatedSize
+{
+    size_t size = malloc_size((__bridge const void *) self);
+    size += malloc_size((__bridge const void *) self.adViewConstraints);
+    for ( NSLayoutConstraint *constraint in self.adViewConstraints )
+    {
+        size += malloc_size((__bridge const void *) constraint);
+    }
+    size += malloc_size((__bridge const void *) self.extraParametersToSetAfterCreate);
+    size += malloc_size((__bridge const void *) self.localExtraParametersToSetAfterCreate);
+    
+    return size;
+}
+
+- (NSDictionary<NSString *, id> *)debugInfo
+{
+    NSMutableDictionary<NSString *, id> *info = [NSMutableDictionary dictionaryWithCapacity: 12];
+    info[@"adUnitId"] = self.adUnitIdentifier;
+    info[@"allocatedBytes"] = @([self allocatedSize]);
+    
+    if ( self.interstitial ) info[@"interstitial"] = @YES;
+    if ( self.appOpenAd ) info[@"appOpenAd"] = @YES;
+    if ( self.rewardedAd ) info[@"rewardedAd"] = @YES;
+    
+    if ( self.adView )
+    {
+        info[@"adViewFormat"] = self.adViewAdFormat.label ?: @"";
+        info[@"adViewPosition"] = self.adViewPosition ?: @"";
+        info[@"adViewHidden"] = @(self.adView.hidden);
+        info[@"adViewConstraintCount"] = @(self.adViewConstraints.count);
+        info[@"autoRefreshDisabled"] = @(self.isAutoRefreshDisabled);
+    }
+    
+    NSUInteger pendingSettingCount = self.extraParametersToSetAfterCreate.count + self.localExtraParametersToSetAfterCreate.count + ( self.customDataToSetAfterCreate ? 1 : 0 );
+    if ( pendingSettingCount > 0 )
+    {
+        info[@"settingsToSetAfterCreate"] = @(pendingSettingCount);
+    }
+    
+    return info;
+}
+
+@end
+
+/**
+ * A hidden view that spans the Unity view and calls @c layoutHandler whenever the Unity view is laid out or its safe area changes, e.g. on rotation.
+ * Ad view frames can change in those passes without the plugin updating any constraints.
+ */
+@interface MAUnityLayoutObserverView : UIView
+@property (nonatomic, copy, nullable) void (^layoutHandler)(void);
+@end
+
+@implementation MAUnityLayoutObserverView
+
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+    
+    if ( self.layoutHandler ) self.layoutHandler();
+}
+
+- (void)safeAreaInsetsDidChange
+{
+    [super safeAreaInsetsDidChange];
+    
+    if ( self.layoutHandler ) self.layoutHandler();
+}
+
+@end
+
 @implementation MAUnityAdManager
 static NSString *const SDK_TAG = @"AppLovinSdk";
 static NSString *const TAG = @"MAUnityAdManager";
 static NSString *const DEFAULT_AD_VIEW_POSITION = @"top_left";
 static ALUnityBackgroundCallback backgroundCallback;
+static ALUnityBinaryBackgroundCallback binaryBackgroundCallback;
+static BOOL binaryEventEncodingEnabled;
+static char cachedAdInfoKeys[MAX_UNITY_PAYLOAD_LEVEL_COUNT]; // One cached ad info per payload level
+static atomic_ullong adInfoCacheHitCount;
+static atomic_ullong adInfoCacheMissCount;
+static atomic_ullong eventSubscriptionMask = ULLONG_MAX; // Forward everything until Unity reports its listeners
+static atomic_int eventBatchingWindowMillis;
+static atomic_int eventPayloadVersion = MAX_UNITY_EVENT_PAYLOAD_VERSION_STRING_NUMBERS; // Until Unity reports the version it understands
+static atomic_int defaultPayloadLevel = MAX_UNITY_PAYLOAD_LEVEL_FULL_WATERFALL;
+static atomic_int eventPayloadLevels[MAX_UNITY_EVENT_COUNT]; // The payload level plus one for events with their own level, or 0 to use `defaultPayloadLevel`
+static max_unity_event_writer binaryEventWriter; // Only accessed from `eventPipelineQueue`
+static uint64_t currentDelegateTimestamp; // Only accessed from `eventPipelineQueue`
+static uint16_t currentDelegateEventIdentifier; // The last event forwarded by the current delegate callback while timeline tracing is enabled. Only accessed from `eventPipelineQueue`.
+
+// Numeric payload values are sent as JSON numbers to Unity plugins that understand typed payloads, and as strings to older ones
+static id max_unity_payload_number(NSNumber *number)
+{
+    return atomic_load_explicit(&eventPayloadVersion, memory_order_relaxed) >= MAX_UNITY_EVENT_PAYLOAD_VERSION_TYPED_NUMBERS ? number : number.stringValue;
+}
+
+// Called on the background log writer thread, so NSLog never blocks the thread that logged the message
+static void max_unity_log_write_to_console(max_unity_log_level level, const char *message, size_t length)
+{
+    NSLog(@"[%@] %s", SDK_TAG, message);
+}
+
+static int max_unity_payload_level_for_event(NSString *name)
+{
+    uint16_t eventIdentifier = max_unity_event_id_for_name(name.UTF8String);
+    int eventPayloadLevel = eventIdentifier < MAX_UNITY_EVENT_COUNT ? atomic_load_explicit(&eventPayloadLevels[eventIdentifier], memory_order_relaxed) : 0;
+    
+    return eventPayloadLevel > 0 ? eventPayloadLevel - 1 : atomic_load_explicit(&defaultPayloadLevel, memory_order_relaxed);
+}
+
+// JSON `null` in bulk extra parameters clears the key, the same as passing a `nil` value to the single key setters
+static id max_unity_nil_if_null(id value)
+{
+    return value == [NSNull null] ? nil : value;
+}
+
+// Dispatches the block that builds the events for an SDK delegate callback. While pipeline stats are enabled, the time the delegate was called is attached to the events the block forwards.
+// While timeline tracing is enabled, the block is recorded as a span.
+static void max_unity_dispatch_delegate_event(dispatch_queue_t eventPipelineQueue, dispatch_block_t block)
+{
+    uint64_t delegateTimestamp = max_unity_pipeline_stats_now();
+    if ( delegateTimestamp == 0 && !max_unity_timeline_is_enabled() )
+    {
+        dispatch_async(eventPipelineQueue, block);
+        return;
+    }
+    
+    dispatch_async(eventPipelineQueue, ^{
+        uint64_t startTimestamp = max_unity_timeline_now();
+        currentDelegateTimestamp = delegateTimestamp;
+        currentDelegateEventIdentifier = MAX_UNITY_EVENT_UNKNOWN;
+        block();
+        currentDelegateTimestamp = 0;
+        max_unity_timeline_record(MAX_UNITY_TIMELINE_SPAN_DELEGATE, currentDelegateEventIdentifier, startTimestamp, max_unity_timeline_now());
+    });
+}
+
+// Passed to the ad view layout as `adaptive_height_for_width`, with the ad format as the context
+static double max_unity_adaptive_height_for_width(double width, void *context)
+{
+    MAAdFormat *adFormat = (__bridge MAAdFormat *) context;
+    return [adFormat adaptiveSizeForWidth: width].height;
+}
 
 #pragma mark - Initialization
 
@@ -109,28 +409,16 @@ static ALUnityBackgroundCallback backgroundCallback;
     self = [super init];
     if ( self )
     {
-        self.interstitials = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.appOpenAds = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.rewardedAds = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViews = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewAdFormats = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewPositions = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewOffsets = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewWidths = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.verticalAdViewFormats = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewConstraints = [NSMutableDictionary dictionaryWithCapacity: 2];
-        self.adViewExtraParametersToSetAfterCreate = [NSMutableDictionary dictionaryWithCapacity: 1];
-        self.adViewLocalExtraParametersToSetAfterCreate = [NSMutableDictionary dictionaryWithCapacity: 1];
-        self.adViewCustomDataToSetAfterCreate = [NSMutableDictionary dictionaryWithCapacity: 1];
-        self.adUnitIdentifiersToShowAfterCreate = [NSMutableArray arrayWithCapacity: 2];
-        self.disabledAdaptiveBannerAdUnitIdentifiers = [NSMutableSet setWithCapacity: 2];
-        self.disabledAutoRefreshAdViewAdUnitIdentifiers = [NSMutableSet setWithCapacity: 2];
-        self.ignoreSafeAreaLandscapeAdUnitIdentifiers = [NSMutableSet setWithCapacity: 2];
-        self.adInfoDict = [NSMutableDictionary dictionary];
-        self.adInfoDictLock = [[NSObject alloc] init];
-        
-        self.backgroundCallbackEventsQueue = [[NSOperationQueue alloc] init];
-        self.backgroundCallbackEventsQueue.maxConcurrentOperationCount = 1;
+        self.adUnitStates = [NSMutableDictionary dictionaryWithCapacity: 4];
+        self.adUnitStatesLock = [[NSObject alloc] init];
+        self.adUnitIdentifiersByHandle = [NSMutableArray arrayWithCapacity: 4];
+        self.adUnitHandles = [NSMutableDictionary dictionaryWithCapacity: 4];
+        self.adUnitIdentifiersNeedingLayout = [NSMutableOrderedSet orderedSetWithCapacity: 2];
+        self.adInfoDict = @{};
+        
+        self.eventPipelineQueue = dispatch_queue_create("com.applovin.mediation.unity.event-pipeline", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        self.pendingUnityEvents = [NSMutableArray array];
+        max_unity_event_writer_init(&binaryEventWriter, 4096);
         
         max_unity_dispatch_on_main_thread(^{
             self.safeAreaBackground = [[UIView alloc] init];
@@ -141,6 +429,16 @@ static ALUnityBackgroundCallback backgroundCallback;
             
             UIViewController *rootViewController = [self unityViewController];
             [rootViewController.view addSubview: self.safeAreaBackground];
+            
+            __weak typeof(self) weakSelf = self;
+            self.adViewLayoutObserver = [[MAUnityLayoutObserverView alloc] initWithFrame: rootViewController.view.bounds];
+            self.adViewLayoutObserver.hidden = YES;
+            self.adViewLayoutObserver.userInteractionEnabled = NO;
+            self.adViewLayoutObserver.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+            self.adViewLayoutObserver.layoutHandler = ^{
+                [weakSelf scheduleAdViewFrameCheck];
+            };
+            [rootViewController.view addSubview: self.adViewLayoutObserver];
         });
         
         // Enable orientation change listener, so that the position can be updated for vertical banners.
@@ -149,9 +447,11 @@ static ALUnityBackgroundCallback backgroundCallback;
                                                            queue: [NSOperationQueue mainQueue]
                                                       usingBlock:^(NSNotification *notification) {
             
-            for ( NSString *adUnitIdentifier in self.verticalAdViewFormats )
+            for ( MAUnityAdUnitState *state in [self allAdUnitStates] )
             {
-                [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: self.verticalAdViewFormats[adUnitIdentifier]];
+                if ( !state.verticalAdViewFormat ) continue;
+                
+                [self positionAdViewForAdUnitIdentifier: state.adUnitIdentifier adFormat: state.verticalAdViewFormat];
             }
         }];
         
@@ -177,7 +477,10 @@ static ALUnityBackgroundCallback backgroundCallback;
             }
 #endif
             
-            self.backgroundCallbackEventsQueue.suspended = NO;
+            // Send the events held while the application was not active
+            dispatch_async(self.eventPipelineQueue, ^{
+                [self flushPendingUnityEvents];
+            });
         }];
     }
     return self;
@@ -198,13 +501,56 @@ static ALUnityBackgroundCallback backgroundCallback;
     backgroundCallback = unityBackgroundCallback;
 }
 
++ (void)setUnityBinaryBackgroundCallback:(ALUnityBinaryBackgroundCallback)unityBinaryBackgroundCallback
+{
+    binaryBackgroundCallback = unityBinaryBackgroundCallback;
+}
+
++ (void)setBinaryEventEncodingEnabled:(BOOL)enabled
+{
+    binaryEventEncodingEnabled = enabled;
+}
+
++ (void)setEventSubscriptionMask:(uint64_t)mask
+{
+    atomic_store(&eventSubscriptionMask, mask);
+}
+
++ (void)setEventPayloadVersion:(int)version
+{
+    atomic_store(&eventPayloadVersion, version);
+}
+
++ (void)setPayloadLevel:(int)level forEventIdentifier:(int)eventIdentifier
+{
+    level = MIN(MAX(level, MAX_UNITY_PAYLOAD_LEVEL_MINIMAL), MAX_UNITY_PAYLOAD_LEVEL_FULL_WATERFALL);
+    
+    if ( eventIdentifier > MAX_UNITY_EVENT_UNKNOWN && eventIdentifier < MAX_UNITY_EVENT_COUNT )
+    {
+        atomic_store(&eventPayloadLevels[eventIdentifier], level + 1);
+        return;
+    }
+    
+    // Setting the level for every event clears the levels set for individual events
+    atomic_store(&defaultPayloadLevel, level);
+    for ( int i = 0; i < MAX_UNITY_EVENT_COUNT; i++ )
+    {
+        atomic_store(&eventPayloadLevels[i], 0);
+    }
+}
+
++ (void)setEventBatchingWindowMillis:(int)millis
+{
+    atomic_store(&eventBatchingWindowMillis, MAX(millis, 0));
+}
+
 #pragma mark - Plugin Initialization
 
 - (void)initializeSdkWithConfiguration:(ALSdkInitializationConfiguration *)initConfig andCompletionHandler:(ALSdkInitializationCompletionHandler)completionHandler;
 {
     self.sdk = [ALSdk shared];
     [self.sdk initializeWithConfiguration: initConfig completionHandler:^(ALSdkConfiguration *configuration) {
-        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        dispatch_async(self.eventPipelineQueue, ^{
             
             // Note: internal state should be updated first
             completionHandler( configuration );
@@ -284,13 +630,23 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     if ( !key )
     {
-        [self log: @"Failed to set local extra parameter: No key specified"];
+        MAX_UNITY_LOG_ERROR(@"Failed to set local extra parameter: No key specified");
         return;
     }
     
     [self setAdViewLocalExtraParameterForAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier] key: key value: value];
 }
 
+- (void)setBannerExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    [self setAdViewExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier] extraParameters: extraParameters];
+}
+
+- (void)setBannerLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    [self setAdViewLocalExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier] localExtraParameters: localExtraParameters];
+}
+
 - (void)setBannerCustomData:(nullable NSString *)customData forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
 {
     [self setAdViewCustomData: customData forAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier]];
@@ -306,9 +662,9 @@ static ALUnityBackgroundCallback backgroundCallback;
     [self hideAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier]];
 }
 
-- (NSString *)bannerLayoutForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+- (CGRect)bannerFrameForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
 {
-    return [self adViewLayoutForAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier]];
+    return [self adViewFrameForAdUnitIdentifier: adUnitIdentifier adFormat: [self adViewAdFormatForAdUnitIdentifier: adUnitIdentifier]];
 }
 
 - (void)destroyBannerWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
@@ -372,13 +728,23 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     if ( !key )
     {
-        [self log: @"Failed to set local extra parameter: No key specified"];
+        MAX_UNITY_LOG_ERROR(@"Failed to set local extra parameter: No key specified");
         return;
     }
     
     [self setAdViewLocalExtraParameterForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec key: key value: value];
 }
 
+- (void)setMRecExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    [self setAdViewExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec extraParameters: extraParameters];
+}
+
+- (void)setMRecLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    [self setAdViewLocalExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec localExtraParameters: localExtraParameters];
+}
+
 - (void)setMRecCustomData:(nullable NSString *)customData forAdUnitIdentifier:(nullable NSString *)adUnitIdentifier;
 {
     [self setAdViewCustomData: customData forAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
@@ -399,9 +765,9 @@ static ALUnityBackgroundCallback backgroundCallback;
     [self hideAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
 }
 
-- (NSString *)mrecLayoutForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+- (CGRect)mrecFrameForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
 {
-    return [self adViewLayoutForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
+    return [self adViewFrameForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
 }
 
 #pragma mark - Interstitials
@@ -434,7 +800,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     if ( !key )
     {
-        [self log: @"Failed to set local extra parameter: No key specified"];
+        MAX_UNITY_LOG_ERROR(@"Failed to set local extra parameter: No key specified");
         return;
     }
     
@@ -442,6 +808,24 @@ static ALUnityBackgroundCallback backgroundCallback;
     [interstitial setLocalExtraParameterForKey: key value: value];
 }
 
+- (void)setInterstitialExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    MAInterstitialAd *interstitial = [self retrieveInterstitialForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in extraParameters )
+    {
+        [interstitial setExtraParameterForKey: key value: max_unity_nil_if_null(extraParameters[key])];
+    }
+}
+
+- (void)setInterstitialLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    MAInterstitialAd *interstitial = [self retrieveInterstitialForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in localExtraParameters )
+    {
+        [interstitial setLocalExtraParameterForKey: key value: max_unity_nil_if_null(localExtraParameters[key])];
+    }
+}
+
 #pragma mark - App Open Ads
 
 - (void)loadAppOpenAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
@@ -472,7 +856,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     if ( !key )
     {
-        [self log: @"Failed to set local extra parameter: No key specified"];
+        MAX_UNITY_LOG_ERROR(@"Failed to set local extra parameter: No key specified");
         return;
     }
     
@@ -480,6 +864,24 @@ static ALUnityBackgroundCallback backgroundCallback;
     [appOpenAd setLocalExtraParameterForKey: key value: value];
 }
 
+- (void)setAppOpenAdExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    MAAppOpenAd *appOpenAd = [self retrieveAppOpenAdForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in extraParameters )
+    {
+        [appOpenAd setExtraParameterForKey: key value: max_unity_nil_if_null(extraParameters[key])];
+    }
+}
+
+- (void)setAppOpenAdLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    MAAppOpenAd *appOpenAd = [self retrieveAppOpenAdForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in localExtraParameters )
+    {
+        [appOpenAd setLocalExtraParameterForKey: key value: max_unity_nil_if_null(localExtraParameters[key])];
+    }
+}
+
 #pragma mark - Rewarded
 
 - (void)loadRewardedAdWithAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
@@ -510,7 +912,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     if ( !key )
     {
-        [self log: @"Failed to set local extra parameter: No key specified"];
+        MAX_UNITY_LOG_ERROR(@"Failed to set local extra parameter: No key specified");
         return;
     }
     
@@ -518,6 +920,24 @@ static ALUnityBackgroundCallback backgroundCallback;
     [rewardedAd setLocalExtraParameterForKey: key value: value];
 }
 
+- (void)setRewardedAdExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    MARewardedAd *rewardedAd = [self retrieveRewardedAdForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in extraParameters )
+    {
+        [rewardedAd setExtraParameterForKey: key value: max_unity_nil_if_null(extraParameters[key])];
+    }
+}
+
+- (void)setRewardedAdLocalExtraParametersForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    MARewardedAd *rewardedAd = [self retrieveRewardedAdForAdUnitIdentifier: adUnitIdentifier];
+    for ( NSString *key in localExtraParameters )
+    {
+        [rewardedAd setLocalExtraParameterForKey: key value: max_unity_nil_if_null(localExtraParameters[key])];
+    }
+}
+
 #pragma mark - Event Tracking
 
 - (void)trackEvent:(nullable NSString *)event parameters:(nullable NSString *)parameters
@@ -528,25 +948,65 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 #pragma mark - Ad Info
 
-- (NSDictionary<NSString *, id> *)adInfoForAd:(MAAd *)ad
+- (NSMutableDictionary<NSString *, id> *)adInfoForAd:(MAAd *)ad payloadLevel:(int)payloadLevel
+{
+    NSMutableDictionary<NSString *, id> *adInfo = [[self cachedAdInfoForAd: ad payloadLevel: payloadLevel].adInfo mutableCopy];
+    adInfo[@"placement"] = ad.placement ?: @"";
+    
+    return adInfo;
+}
+
+- (MAUnityCachedAdInfo *)cachedAdInfoForAd:(MAAd *)ad payloadLevel:(int)payloadLevel
 {
-    return @{@"adUnitId" : ad.adUnitIdentifier,
-             @"adFormat" : ad.format.label,
-             @"networkName" : ad.networkName,
-             @"networkPlacement" : ad.networkPlacement,
-             @"creativeId" : ad.creativeIdentifier ?: @"",
-             @"placement" : ad.placement ?: @"",
-             @"revenue" : [@(ad.revenue) stringValue],
-             @"revenuePrecision" : ad.revenuePrecision,
-             @"waterfallInfo" : [self createAdWaterfallInfo: ad.waterfall],
-             @"latencyMillis" : [self requestLatencyMillisFromRequestLatency: ad.requestLatency],
-             @"dspName" : ad.DSPName ?: @""};
+    // Two threads may both miss for the same ad, in which case the last one to finish wins. Both results are identical.
+    const void *cachedAdInfoKey = &cachedAdInfoKeys[payloadLevel];
+    MAUnityCachedAdInfo *cachedAdInfo = objc_getAssociatedObject(ad, cachedAdInfoKey);
+    if ( cachedAdInfo )
+    {
+        atomic_fetch_add(&adInfoCacheHitCount, 1);
+        return cachedAdInfo;
+    }
+    
+    unsigned long long missCount = atomic_fetch_add(&adInfoCacheMissCount, 1) + 1;
+    
+    cachedAdInfo = [[MAUnityCachedAdInfo alloc] initWithAdInfo: [self createAdInfoForAd: ad payloadLevel: payloadLevel]];
+    objc_setAssociatedObject(ad, cachedAdInfoKey, cachedAdInfo, OBJC_ASSOCIATION_RETAIN);
+    
+    if ( missCount % 20 == 0 && MAX_UNITY_LOG_IS_ENABLED(MAX_UNITY_LOG_LEVEL_DEBUG) )
+    {
+        unsigned long long hitCount = atomic_load(&adInfoCacheHitCount);
+        MAX_UNITY_LOG_DEBUG(@"Ad info cache hit rate: %.1f%% (%llu hits, %llu misses)", 100.0 * hitCount / (hitCount + missCount), hitCount, missCount);
+    }
+    
+    return cachedAdInfo;
+}
+
+- (NSDictionary<NSString *, id> *)createAdInfoForAd:(MAAd *)ad payloadLevel:(int)payloadLevel
+{
+    NSMutableDictionary<NSString *, id> *adInfo = [NSMutableDictionary dictionaryWithCapacity: 10];
+    adInfo[@"adUnitId"] = ad.adUnitIdentifier;
+    adInfo[@"adFormat"] = ad.format.label;
+    adInfo[@"networkName"] = ad.networkName;
+    adInfo[@"networkPlacement"] = ad.networkPlacement;
+    adInfo[@"creativeId"] = ad.creativeIdentifier ?: @"";
+    adInfo[@"revenue"] = max_unity_payload_number(@(ad.revenue));
+    adInfo[@"revenuePrecision"] = ad.revenuePrecision;
+    adInfo[@"waterfallInfo"] = [self createAdWaterfallInfo: ad.waterfall payloadLevel: payloadLevel];
+    adInfo[@"latencyMillis"] = [self requestLatencyMillisFromRequestLatency: ad.requestLatency];
+    adInfo[@"dspName"] = ad.DSPName ?: @"";
+    
+    return adInfo;
 }
 
 #pragma mark - Waterfall Information
 
-- (NSDictionary<NSString *, id> *)createAdWaterfallInfo:(MAAdWaterfallInfo *)waterfallInfo
+/**
+ * Returns @c nil at @c MAX_UNITY_PAYLOAD_LEVEL_MINIMAL, so the waterfall is left out of the event entirely.
+ */
+- (nullable NSDictionary<NSString *, id> *)createAdWaterfallInfo:(MAAdWaterfallInfo *)waterfallInfo payloadLevel:(int)payloadLevel
 {
+    if ( payloadLevel == MAX_UNITY_PAYLOAD_LEVEL_MINIMAL ) return nil;
+    
     NSMutableDictionary<NSString *, NSObject *> *waterfallInfoDict = [NSMutableDictionary dictionary];
     if ( !waterfallInfo ) return waterfallInfoDict;
     
@@ -556,7 +1016,7 @@ static ALUnityBackgroundCallback backgroundCallback;
     NSMutableArray<NSDictionary<NSString *, NSObject *> *> *networkResponsesArray = [NSMutableArray arrayWithCapacity: waterfallInfo.networkResponses.count];
     for ( MANetworkResponseInfo *response in  waterfallInfo.networkResponses )
     {
-        [networkResponsesArray addObject: [self createNetworkResponseInfo: response]];
+        [networkResponsesArray addObject: [self createNetworkResponseInfo: response payloadLevel: payloadLevel]];
     }
     
     waterfallInfoDict[@"networkResponses"] = networkResponsesArray;
@@ -565,26 +1025,33 @@ static ALUnityBackgroundCallback backgroundCallback;
     return waterfallInfoDict;
 }
 
-- (NSDictionary<NSString *, id> *)createNetworkResponseInfo:(MANetworkResponseInfo *)response
+- (NSDictionary<NSString *, id> *)createNetworkResponseInfo:(MANetworkResponseInfo *)response payloadLevel:(int)payloadLevel
 {
     NSMutableDictionary<NSString *, NSObject *> *networkResponseDict = [NSMutableDictionary dictionary];
+    BOOL isFullWaterfall = payloadLevel >= MAX_UNITY_PAYLOAD_LEVEL_FULL_WATERFALL;
     
-    networkResponseDict[@"adLoadState"] = @(response.adLoadState).stringValue;
+    networkResponseDict[@"adLoadState"] = max_unity_payload_number(@(response.adLoadState));
     
     MAMediatedNetworkInfo *mediatedNetworkInfo = response.mediatedNetwork;
     if ( mediatedNetworkInfo )
     {
         NSMutableDictionary <NSString *, NSObject *> *networkInfoObject = [NSMutableDictionary dictionary];
         networkInfoObject[@"name"] = response.mediatedNetwork.name;
-        networkInfoObject[@"adapterClassName"] = response.mediatedNetwork.adapterClassName;
-        networkInfoObject[@"adapterVersion"] = response.mediatedNetwork.adapterVersion;
-        networkInfoObject[@"sdkVersion"] = response.mediatedNetwork.sdkVersion;
-        networkInfoObject[@"initializationStatus"] = @(response.mediatedNetwork.initializationStatus);
+        if ( isFullWaterfall )
+        {
+            networkInfoObject[@"adapterClassName"] = response.mediatedNetwork.adapterClassName;
+            networkInfoObject[@"adapterVersion"] = response.mediatedNetwork.adapterVersion;
+            networkInfoObject[@"sdkVersion"] = response.mediatedNetwork.sdkVersion;
+            networkInfoObject[@"initializationStatus"] = @(response.mediatedNetwork.initializationStatus);
+        }
         
         networkResponseDict[@"mediatedNetwork"] = networkInfoObject;
     }
     
-    networkResponseDict[@"credentials"] = response.credentials;
+    if ( isFullWaterfall )
+    {
+        networkResponseDict[@"credentials"] = response.credentials;
+    }
     networkResponseDict[@"isBidding"] = @([response isBidding]);
     
     MAError *error = response.error;
@@ -592,8 +1059,11 @@ static ALUnityBackgroundCallback backgroundCallback;
     {
         NSMutableDictionary<NSString *, NSObject *> *errorObject = [NSMutableDictionary dictionary];
         errorObject[@"errorMessage"] = error.message;
-        errorObject[@"adLoadFailure"] = error.adLoadFailureInfo;
-        errorObject[@"errorCode"] = @(error.code).stringValue;
+        if ( isFullWaterfall )
+        {
+            errorObject[@"adLoadFailure"] = error.adLoadFailureInfo;
+        }
+        errorObject[@"errorCode"] = max_unity_payload_number(@(error.code));
         errorObject[@"latencyMillis"] = [self requestLatencyMillisFromRequestLatency: error.requestLatency];
         
         networkResponseDict[@"error"] = errorObject;
@@ -664,32 +1134,33 @@ static ALUnityBackgroundCallback backgroundCallback;
         return;
     }
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
-        @synchronized ( self.adInfoDictLock )
-        {
-            self.adInfoDict[ad.adUnitIdentifier] = ad;
-        }
+        [self setAd: ad forAdUnitIdentifier: ad.adUnitIdentifier];
+        
+        if ( ![self hasListenerForEventWithName: name] ) return;
         
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
 - (void)didFailToLoadAdForAdUnitIdentifier:(NSString *)adUnitIdentifier withError:(MAError *)error
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         if ( !adUnitIdentifier )
         {
-            [self log: @"adUnitIdentifier cannot be nil from %@", [NSThread callStackSymbols]];
+            MAX_UNITY_LOG_ERROR(@"adUnitIdentifier cannot be nil from %@", [NSThread callStackSymbols]);
             return;
         }
         
+        MAUnityAdUnitState *state = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        
         NSString *name;
-        if ( self.adViews[adUnitIdentifier] )
+        if ( state.adView )
         {
-            MAAdFormat *adFormat = self.adViewAdFormats[adUnitIdentifier];
+            MAAdFormat *adFormat = state.adViewAdFormat;
             if ( MAAdFormat.mrec == adFormat )
             {
                 name = @"OnMRecAdLoadFailedEvent";
@@ -699,42 +1170,43 @@ static ALUnityBackgroundCallback backgroundCallback;
                 name = @"OnBannerAdLoadFailedEvent";
             }
         }
-        else if ( self.interstitials[adUnitIdentifier] )
+        else if ( state.interstitial )
         {
             name = @"OnInterstitialLoadFailedEvent";
         }
-        else if ( self.appOpenAds[adUnitIdentifier] )
+        else if ( state.appOpenAd )
         {
             name = @"OnAppOpenAdLoadFailedEvent";
         }
-        else if ( self.rewardedAds[adUnitIdentifier] )
+        else if ( state.rewardedAd )
         {
             name = @"OnRewardedAdLoadFailedEvent";
         }
         else
         {
-            [self log: @"invalid adUnitId from %@", [NSThread callStackSymbols]];
+            MAX_UNITY_LOG_ERROR(@"invalid adUnitId from %@", [NSThread callStackSymbols]);
             return;
         }
         
-        @synchronized ( self.adInfoDictLock )
-        {
-            [self.adInfoDict removeObjectForKey: adUnitIdentifier];
-        }
+        [self setAd: nil forAdUnitIdentifier: adUnitIdentifier];
         
-        [self forwardUnityEventWithArgs: @{@"name" : name,
-                                           @"adUnitId" : adUnitIdentifier,
-                                           @"errorCode" : [@(error.code) stringValue],
-                                           @"errorMessage" : error.message,
-                                           @"waterfallInfo" : [self createAdWaterfallInfo: error.waterfall],
-                                           @"adLoadFailureInfo" : error.adLoadFailureInfo ?: @"",
-                                           @"latencyMillis" : [self requestLatencyMillisFromRequestLatency: error.requestLatency]}];
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
+        NSMutableDictionary<NSString *, id> *args = [NSMutableDictionary dictionaryWithCapacity: 7];
+        args[@"name"] = name;
+        args[@"adUnitId"] = adUnitIdentifier;
+        args[@"errorCode"] = max_unity_payload_number(@(error.code));
+        args[@"errorMessage"] = error.message;
+        args[@"waterfallInfo"] = [self createAdWaterfallInfo: error.waterfall payloadLevel: max_unity_payload_level_for_event(name)];
+        args[@"adLoadFailureInfo"] = error.adLoadFailureInfo ?: @"";
+        args[@"latencyMillis"] = [self requestLatencyMillisFromRequestLatency: error.requestLatency];
+        [self forwardUnityEventWithArgs: args];
     });
 }
 
 - (void)didClickAd:(MAAd *)ad
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         MAAdFormat *adFormat = ad.format;
@@ -764,8 +1236,10 @@ static ALUnityBackgroundCallback backgroundCallback;
             return;
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
@@ -780,7 +1254,7 @@ static ALUnityBackgroundCallback backgroundCallback;
     UnityPause(YES);
 #endif
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         if ( MAAdFormat.interstitial == adFormat )
@@ -796,14 +1270,16 @@ static ALUnityBackgroundCallback backgroundCallback;
             name = @"OnRewardedAdDisplayedEvent";
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
 - (void)didFailToDisplayAd:(MAAd *)ad withError:(MAError *)error
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         // BMLs do not support [DISPLAY] events in Unity
         MAAdFormat *adFormat = ad.format;
@@ -823,12 +1299,17 @@ static ALUnityBackgroundCallback backgroundCallback;
             name = @"OnRewardedAdFailedToDisplayEvent";
         }
         
-        NSMutableDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        args[@"errorCode"] = [@(error.code) stringValue];
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
+        // The error's waterfall and latency replace the ad's, so the ad info cannot be spliced in as-is
+        int payloadLevel = max_unity_payload_level_for_event(name);
+        NSMutableDictionary<NSString *, id> *args = [self adInfoForAd: ad payloadLevel: payloadLevel];
+        args[@"name"] = name;
+        args[@"errorCode"] = max_unity_payload_number(@(error.code));
         args[@"errorMessage"] = error.message;
-        args[@"mediatedNetworkErrorCode"] = [@(error.mediatedNetworkErrorCode) stringValue];
+        args[@"mediatedNetworkErrorCode"] = max_unity_payload_number(@(error.mediatedNetworkErrorCode));
         args[@"mediatedNetworkErrorMessage"] = error.mediatedNetworkErrorMessage;
-        args[@"waterfallInfo"] = [self createAdWaterfallInfo: error.waterfall];
+        args[@"waterfallInfo"] = [self createAdWaterfallInfo: error.waterfall payloadLevel: payloadLevel];
         args[@"latencyMillis"] = [self requestLatencyMillisFromRequestLatency: error.requestLatency];
         [self forwardUnityEventWithArgs: args];
     });
@@ -854,7 +1335,7 @@ static ALUnityBackgroundCallback backgroundCallback;
     }
 #endif
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         if ( MAAdFormat.interstitial == adFormat )
@@ -870,8 +1351,10 @@ static ALUnityBackgroundCallback backgroundCallback;
             name = @"OnRewardedAdHiddenEvent";
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
@@ -889,7 +1372,7 @@ static ALUnityBackgroundCallback backgroundCallback;
     UnityPause(YES);
 #endif
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         if ( MAAdFormat.mrec == adFormat )
@@ -901,8 +1384,10 @@ static ALUnityBackgroundCallback backgroundCallback;
             name = @"OnBannerAdExpandedEvent";
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
@@ -929,7 +1414,7 @@ static ALUnityBackgroundCallback backgroundCallback;
     }
 #endif
     
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         if ( MAAdFormat.mrec == adFormat )
@@ -941,14 +1426,16 @@ static ALUnityBackgroundCallback backgroundCallback;
             name = @"OnBannerAdCollapsedEvent";
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
 - (void)didRewardUserForAd:(MAAd *)ad withReward:(MAReward *)reward
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         MAAdFormat *adFormat = ad.format;
         if ( adFormat != MAAdFormat.rewarded )
@@ -959,19 +1446,21 @@ static ALUnityBackgroundCallback backgroundCallback;
         
         NSString *rewardLabel = reward ? reward.label : @"";
         NSInteger rewardAmountInt = reward ? reward.amount : 0;
-        NSString *rewardAmount = [@(rewardAmountInt) stringValue];
+        id rewardAmount = max_unity_payload_number(@(rewardAmountInt));
         NSString *name = @"OnRewardedAdReceivedRewardEvent";
                 
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSMutableDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
         args[@"rewardLabel"] = rewardLabel;
         args[@"rewardAmount"] = rewardAmount;
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
 - (void)didPayRevenueForAd:(MAAd *)ad
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         MAAdFormat *adFormat = ad.format;
@@ -1001,15 +1490,17 @@ static ALUnityBackgroundCallback backgroundCallback;
             return;
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSMutableDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
         args[@"keepInBackground"] = @([adFormat isFullscreenAd]);
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
 - (void)didReloadExpiredAd:(MAAd *)expiredAd withNewAd:(MAAd *)newAd;
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         MAAdFormat *adFormat = newAd.format;
@@ -1023,7 +1514,7 @@ static ALUnityBackgroundCallback backgroundCallback;
         }
         else if ( MAAdFormat.rewarded == adFormat )
         {
-            name = @"OnExpiredRewardedAdReloadedEvent ";
+            name = @"OnExpiredRewardedAdReloadedEvent";
         }
         else
         {
@@ -1031,14 +1522,14 @@ static ALUnityBackgroundCallback backgroundCallback;
             return;
         }
     
-        @synchronized ( self.adInfoDictLock )
-        {
-            self.adInfoDict[newAd.adUnitIdentifier] = newAd;
-        }
+        [self setAd: newAd forAdUnitIdentifier: newAd.adUnitIdentifier];
+        
+        if ( ![self hasListenerForEventWithName: name] ) return;
         
         NSMutableDictionary<NSString *, NSObject *> *args = [NSMutableDictionary dictionary];
-        args[@"expiredAdInfo"] = [self adInfoForAd: expiredAd];
-        args[@"newAdInfo"] = [self adInfoForAd: newAd];
+        int payloadLevel = max_unity_payload_level_for_event(name);
+        args[@"expiredAdInfo"] = [self adInfoForAd: expiredAd payloadLevel: payloadLevel];
+        args[@"newAdInfo"] = [self adInfoForAd: newAd payloadLevel: payloadLevel];
         args[@"name"] = name;
         [self forwardUnityEventWithArgs: args];
     });
@@ -1046,7 +1537,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (void)didGenerateCreativeIdentifier:(NSString *)creativeIdentifier forAd:(MAAd *)ad
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         
         NSString *name;
         MAAdFormat *adFormat = ad.format;
@@ -1072,19 +1563,36 @@ static ALUnityBackgroundCallback backgroundCallback;
             return;
         }
         
+        if ( ![self hasListenerForEventWithName: name] ) return;
+        
         NSMutableDictionary<NSString *, id> *args = [self defaultAdEventParametersForName: name withAd: ad];
         args[@"adReviewCreativeId"] = creativeIdentifier;
         args[@"keepInBackground"] = @([adFormat isFullscreenAd]);
         
         // Forward the event in background for fullscreen ads so that the user gets the callback even while the ad is playing.
-        [self forwardUnityEventWithArgs: args];
+        [self forwardUnityEventWithArgs: args forAd: ad];
     });
 }
 
+/**
+ * Returns @c NO if the event is an ad event that nobody in Unity is listening to, in which case its payload does not need to be built.
+ */
+- (BOOL)hasListenerForEventWithName:(NSString *)name
+{
+    uint16_t eventIdentifier = max_unity_event_id_for_name(name.UTF8String);
+    if ( eventIdentifier == MAX_UNITY_EVENT_UNKNOWN ) return YES;
+    
+    return (atomic_load(&eventSubscriptionMask) & (1ULL << eventIdentifier)) != 0;
+}
+
+/**
+ * Returns the event specific parameters for an ad event. The cached ad info is added by @c -forwardUnityEventWithArgs:forAd:, so callers must not add any ad info keys.
+ */
 - (NSMutableDictionary<NSString *, id> *)defaultAdEventParametersForName:(NSString *)name withAd:(MAAd *)ad
 {
-    NSMutableDictionary<NSString *, id> *args = [[self adInfoForAd: ad] mutableCopy];
+    NSMutableDictionary<NSString *, id> *args = [NSMutableDictionary dictionaryWithCapacity: 4];
     args[@"name"] = name;
+    args[@"placement"] = ad.placement ?: @"";
     
     return args;
 }
@@ -1094,11 +1602,12 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)createAdViewWithAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat atPosition:(NSString *)adViewPosition withOffset:(CGPoint)offset isAdaptive:(BOOL)isAdaptive
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Creating %@ with ad unit identifier \"%@\" and position: \"%@\"", adFormat, adUnitIdentifier, adViewPosition];
+        MAX_UNITY_LOG_DEBUG(@"Creating %@ with ad unit identifier \"%@\" and position: \"%@\"", adFormat, adUnitIdentifier, adViewPosition);
         
-        if ( self.adViews[adUnitIdentifier] )
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        if ( state.adView )
         {
-            [self log: @"Trying to create a %@ that was already created. This will cause the current ad to be hidden.", adFormat.label];
+            MAX_UNITY_LOG_WARNING(@"Trying to create a %@ that was already created. This will cause the current ad to be hidden.", adFormat.label);
         }
         
         // Retrieve ad view from the map
@@ -1107,10 +1616,10 @@ static ALUnityBackgroundCallback backgroundCallback;
         self.safeAreaBackground.hidden = YES;
         
         // Position ad view immediately so if publisher sets color before ad loads, it will not be the size of the screen
-        self.adViewAdFormats[adUnitIdentifier] = adFormat;
+        state.adViewAdFormat = adFormat;
         [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
         
-        NSDictionary<NSString *, NSString *> *extraParameters = self.adViewExtraParametersToSetAfterCreate[adUnitIdentifier];
+        NSDictionary<NSString *, NSString *> *extraParameters = state.extraParametersToSetAfterCreate;
         
         // Handle initial extra parameters if publisher sets it before creating ad view
         if ( extraParameters )
@@ -1118,50 +1627,47 @@ static ALUnityBackgroundCallback backgroundCallback;
             for ( NSString *key in extraParameters )
             {
                 [adView setExtraParameterForKey: key value: extraParameters[key]];
-                
-                [self handleExtraParameterChangesIfNeededForAdUnitIdentifier: adUnitIdentifier
-                                                                    adFormat: adFormat
-                                                                         key: key
-                                                                       value: extraParameters[key]];
             }
             
-            [self.adViewExtraParametersToSetAfterCreate removeObjectForKey: adUnitIdentifier];
+            [self handleExtraParameterChangesIfNeededForAdUnitIdentifier: adUnitIdentifier
+                                                                adFormat: adFormat
+                                                         extraParameters: extraParameters];
+            
+            state.extraParametersToSetAfterCreate = nil;
         }
         
         // Handle initial local extra parameters if publisher sets it before creating ad view
-        if ( self.adViewLocalExtraParametersToSetAfterCreate[adUnitIdentifier] )
+        if ( state.localExtraParametersToSetAfterCreate )
         {
-            NSDictionary<NSString *, NSString *> *localExtraParameters = self.adViewLocalExtraParametersToSetAfterCreate[adUnitIdentifier];
+            NSDictionary<NSString *, id> *localExtraParameters = state.localExtraParametersToSetAfterCreate;
             for ( NSString *key in localExtraParameters )
             {
                 [adView setLocalExtraParameterForKey: key value: localExtraParameters[key]];
             }
             
-            [self.adViewLocalExtraParametersToSetAfterCreate removeObjectForKey: adUnitIdentifier];
+            state.localExtraParametersToSetAfterCreate = nil;
         }
         
         // Handle initial custom data if publisher sets it before creating ad view
-        if ( self.adViewCustomDataToSetAfterCreate[adUnitIdentifier] )
+        if ( state.customDataToSetAfterCreate )
         {
-            NSString *customData = self.adViewCustomDataToSetAfterCreate[adUnitIdentifier];
-            adView.customData = customData;
-            
-            [self.adViewCustomDataToSetAfterCreate removeObjectForKey: adUnitIdentifier];
+            adView.customData = state.customDataToSetAfterCreate;
+            state.customDataToSetAfterCreate = nil;
         }
         
         [adView loadAd];
         
         // Disable auto-refresh if publisher sets it before creating the ad view.
-        if ( [self.disabledAutoRefreshAdViewAdUnitIdentifiers containsObject: adUnitIdentifier] )
+        if ( state.isAutoRefreshDisabled )
         {
             [adView stopAutoRefresh];
         }
         
         // The publisher may have requested to show the banner before it was created. Now that the banner is created, show it.
-        if ( [self.adUnitIdentifiersToShowAfterCreate containsObject: adUnitIdentifier] )
+        if ( state.shouldShowAfterCreate )
         {
             [self showAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
-            [self.adUnitIdentifiersToShowAfterCreate removeObject: adUnitIdentifier];
+            state.showAfterCreate = NO;
         }
     });
 }
@@ -1169,22 +1675,23 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)loadAdViewWithAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAUnityAdUnitState *state = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        MAAdView *adView = state.adView;
         if ( !adView )
         {
-            [self log: @"%@ does not exist for ad unit identifier \"%@\".", adFormat.label, adUnitIdentifier];
+            MAX_UNITY_LOG_WARNING(@"%@ does not exist for ad unit identifier \"%@\".", adFormat.label, adUnitIdentifier);
             return;
         }
         
-        if ( ![self.disabledAutoRefreshAdViewAdUnitIdentifiers containsObject: adUnitIdentifier] )
+        if ( !state.isAutoRefreshDisabled )
         {
             if ( [adView isHidden] )
             {
-                [self log: @"Auto-refresh will resume when the %@ ad is shown. You should only call LoadBanner() or LoadMRec() if you explicitly pause auto-refresh and want to manually load an ad.", adFormat.label];
+                MAX_UNITY_LOG_WARNING(@"Auto-refresh will resume when the %@ ad is shown. You should only call LoadBanner() or LoadMRec() if you explicitly pause auto-refresh and want to manually load an ad.", adFormat.label);
                 return;
             }
             
-            [self log: @"You must stop auto-refresh if you want to manually load %@ ads.", adFormat.label];
+            MAX_UNITY_LOG_WARNING(@"You must stop auto-refresh if you want to manually load %@ ads.", adFormat.label);
             return;
         }
         
@@ -1195,7 +1702,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)setAdViewBackgroundColorForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat hexColorCode:(NSString *)hexColorCode
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Setting %@ with ad unit identifier \"%@\" to color: \"%@\"", adFormat, adUnitIdentifier, hexColorCode];
+        MAX_UNITY_LOG_DEBUG(@"Setting %@ with ad unit identifier \"%@\" to color: \"%@\"", adFormat, adUnitIdentifier, hexColorCode);
         
         // In some cases, black color may get redrawn on each frame update, resulting in an undesired flicker
         NSString *hexColorCodeToUse = [hexColorCode containsString: @"FF000000"] ? @"FF000001" : hexColorCode;
@@ -1213,7 +1720,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)setAdViewPlacement:(nullable NSString *)placement forAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Setting placement \"%@\" for \"%@\" with ad unit identifier \"%@\"", placement, adFormat, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Setting placement \"%@\" for \"%@\" with ad unit identifier \"%@\"", placement, adFormat, adUnitIdentifier);
         
         MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
         adView.placement = placement;
@@ -1223,14 +1730,15 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)startAdViewAutoRefreshForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Starting %@ auto refresh for ad unit identifier \"%@\"", adFormat.label, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Starting %@ auto refresh for ad unit identifier \"%@\"", adFormat.label, adUnitIdentifier);
         
-        [self.disabledAutoRefreshAdViewAdUnitIdentifiers removeObject: adUnitIdentifier];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        state.autoRefreshDisabled = NO;
         
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAAdView *adView = state.adView;
         if ( !adView )
         {
-            [self log: @"%@ does not exist for ad unit identifier %@.", adFormat.label, adUnitIdentifier];
+            MAX_UNITY_LOG_WARNING(@"%@ does not exist for ad unit identifier %@.", adFormat.label, adUnitIdentifier);
             return;
         }
         
@@ -1241,14 +1749,15 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)stopAdViewAutoRefreshForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Stopping %@ auto refresh for ad unit identifier \"%@\"", adFormat.label, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Stopping %@ auto refresh for ad unit identifier \"%@\"", adFormat.label, adUnitIdentifier);
         
-        [self.disabledAutoRefreshAdViewAdUnitIdentifiers addObject: adUnitIdentifier];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        state.autoRefreshDisabled = YES;
         
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAAdView *adView = state.adView;
         if ( !adView )
         {
-            [self log: @"%@ does not exist for ad unit identifier %@.", adFormat.label, adUnitIdentifier];
+            MAX_UNITY_LOG_WARNING(@"%@ does not exist for ad unit identifier %@.", adFormat.label, adUnitIdentifier);
             return;
         }
         
@@ -1259,7 +1768,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)setAdViewWidth:(CGFloat)width forAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Setting width %f for \"%@\" with ad unit identifier \"%@\"", width, adFormat, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Setting width %f for \"%@\" with ad unit identifier \"%@\"", width, adFormat, adUnitIdentifier);
         
         BOOL isBannerOrLeader = adFormat.isBannerOrLeaderAd;
         
@@ -1267,11 +1776,11 @@ static ALUnityBackgroundCallback backgroundCallback;
         CGFloat minWidth = isBannerOrLeader ? MAAdFormat.banner.size.width : adFormat.size.width;
         if ( width < minWidth )
         {
-            [self log: @"The provided width: %f is smaller than the minimum required width: %f for ad format: %@. Automatically setting width to %f.", width, minWidth, adFormat, minWidth];
+            MAX_UNITY_LOG_WARNING(@"The provided width: %f is smaller than the minimum required width: %f for ad format: %@. Automatically setting width to %f.", width, minWidth, adFormat, minWidth);
         }
         
         CGFloat widthToSet = MAX( minWidth, width );
-        self.adViewWidths[adUnitIdentifier] = @(widthToSet);
+        [self adUnitStateForAdUnitIdentifier: adUnitIdentifier].adViewWidth = @(widthToSet);
         [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
     });
 }
@@ -1279,68 +1788,102 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)updateAdViewPosition:(NSString *)adViewPosition withOffset:(CGPoint)offset forAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        self.adViewPositions[adUnitIdentifier] = adViewPosition;
-        self.adViewOffsets[adUnitIdentifier] = [NSValue valueWithCGPoint: offset];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        state.adViewPosition = adViewPosition;
+        state.adViewOffset = offset;
         [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
     });
 }
 
 - (void)setAdViewExtraParameterForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat key:(NSString *)key value:(nullable NSString *)value
 {
+    if ( !key )
+    {
+        MAX_UNITY_LOG_ERROR(@"Failed to set extra parameter: No key specified");
+        return;
+    }
+    
+    [self setAdViewExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat extraParameters: @{key : value ?: [NSNull null]}];
+}
+
+- (void)setAdViewExtraParametersForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat extraParameters:(NSDictionary<NSString *, id> *)extraParameters
+{
+    if ( extraParameters.count == 0 ) return;
+    
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Setting %@ extra with key: \"%@\" value: \"%@\"", adFormat, key, value];
+        MAX_UNITY_LOG_DEBUG(@"Setting %@ extras: %@", adFormat, extraParameters);
         
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        MAAdView *adView = state.adView;
         if ( adView )
         {
-            [adView setExtraParameterForKey: key value: value];
+            for ( NSString *key in extraParameters )
+            {
+                [adView setExtraParameterForKey: key value: max_unity_nil_if_null(extraParameters[key])];
+            }
         }
         else
         {
-            [self log: @"%@ does not exist for ad unit identifier \"%@\". Saving extra parameter to be set when it is created.", adFormat, adUnitIdentifier];
+            MAX_UNITY_LOG_DEBUG(@"%@ does not exist for ad unit identifier \"%@\". Saving extra parameters to be set when it is created.", adFormat, adUnitIdentifier);
             
             // The adView has not yet been created. Store the extra parameters, so that they can be added once the banner has been created.
-            NSMutableDictionary<NSString *, NSString *> *extraParameters = self.adViewExtraParametersToSetAfterCreate[adUnitIdentifier];
-            if ( !extraParameters )
+            NSMutableDictionary<NSString *, NSString *> *storedExtraParameters = state.extraParametersToSetAfterCreate;
+            if ( !storedExtraParameters )
             {
-                extraParameters = [NSMutableDictionary dictionaryWithCapacity: 1];
-                self.adViewExtraParametersToSetAfterCreate[adUnitIdentifier] = extraParameters;
+                storedExtraParameters = [NSMutableDictionary dictionaryWithCapacity: extraParameters.count];
+                state.extraParametersToSetAfterCreate = storedExtraParameters;
             }
             
-            extraParameters[key] = value;
+            for ( NSString *key in extraParameters )
+            {
+                storedExtraParameters[key] = max_unity_nil_if_null(extraParameters[key]);
+            }
         }
         
         // Certain extra parameters need to be handled immediately
         [self handleExtraParameterChangesIfNeededForAdUnitIdentifier: adUnitIdentifier
                                                             adFormat: adFormat
-                                                                 key: key
-                                                               value: value];
+                                                     extraParameters: extraParameters];
     });
 }
 
 - (void)setAdViewLocalExtraParameterForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat key:(NSString *)key value:(nullable id)value
 {
+    [self setAdViewLocalExtraParametersForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat localExtraParameters: @{key : value ?: [NSNull null]}];
+}
+
+- (void)setAdViewLocalExtraParametersForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat localExtraParameters:(NSDictionary<NSString *, id> *)localExtraParameters
+{
+    if ( localExtraParameters.count == 0 ) return;
+    
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Setting %@ local extra with key: \"%@\" value: \"%@\"", adFormat, key, value];
+        MAX_UNITY_LOG_DEBUG(@"Setting %@ local extras: %@", adFormat, localExtraParameters);
         
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        MAAdView *adView = state.adView;
         if ( adView )
         {
-            [adView setLocalExtraParameterForKey: key value: value];
+            for ( NSString *key in localExtraParameters )
+            {
+                [adView setLocalExtraParameterForKey: key value: max_unity_nil_if_null(localExtraParameters[key])];
+            }
         }
         else
         {
-            [self log: @"%@ does not exist for ad unit identifier \"%@\". Saving local extra parameter to be set when it is created.", adFormat, adUnitIdentifier];
+            MAX_UNITY_LOG_DEBUG(@"%@ does not exist for ad unit identifier \"%@\". Saving local extra parameters to be set when it is created.", adFormat, adUnitIdentifier);
             
-            // The adView has not yet been created. Store the loca extra parameters, so that they can be added once the adview has been created.
-            NSMutableDictionary<NSString *, id> *localExtraParameters = self.adViewLocalExtraParametersToSetAfterCreate[adUnitIdentifier];
-            if ( !localExtraParameters )
+            // The adView has not yet been created. Store the local extra parameters, so that they can be added once the adview has been created.
+            NSMutableDictionary<NSString *, id> *storedLocalExtraParameters = state.localExtraParametersToSetAfterCreate;
+            if ( !storedLocalExtraParameters )
             {
-                localExtraParameters = [NSMutableDictionary dictionaryWithCapacity: 1];
-                self.adViewLocalExtraParametersToSetAfterCreate[adUnitIdentifier] = localExtraParameters;
+                storedLocalExtraParameters = [NSMutableDictionary dictionaryWithCapacity: localExtraParameters.count];
+                state.localExtraParametersToSetAfterCreate = storedLocalExtraParameters;
             }
             
-            localExtraParameters[key] = value;
+            for ( NSString *key in localExtraParameters )
+            {
+                storedLocalExtraParameters[key] = max_unity_nil_if_null(localExtraParameters[key]);
+            }
         }
     });
 }
@@ -1349,83 +1892,92 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     max_unity_dispatch_on_main_thread(^{
         
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        MAAdView *adView = state.adView;
         if ( adView )
         {
             adView.customData = customData;
         }
         else
         {
-            [self log: @"%@ does not exist for ad unit identifier %@. Saving custom data to be set when it is created.", adFormat, adUnitIdentifier];
+            MAX_UNITY_LOG_DEBUG(@"%@ does not exist for ad unit identifier %@. Saving custom data to be set when it is created.", adFormat, adUnitIdentifier);
             
             // The adView has not yet been created. Store the custom data, so that they can be added once the AdView has been created.
-            self.adViewCustomDataToSetAfterCreate[adUnitIdentifier] = customData;
+            state.customDataToSetAfterCreate = customData;
         }
     });
 }
 
-- (void)handleExtraParameterChangesIfNeededForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat key:(NSString *)key value:(nullable NSString *)value
+- (void)handleExtraParameterChangesIfNeededForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat extraParameters:(NSDictionary<NSString *, id> *)extraParameters
 {
-    if ( MAAdFormat.mrec != adFormat )
+    // Apply every change first and reposition the ad view at most once
+    MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MAAdFormat *positionAdFormat = adFormat;
+    BOOL shouldPositionAdView = NO;
+    
+    for ( NSString *key in extraParameters )
     {
-        if ( [@"force_banner" isEqualToString: key] )
-        {
-            BOOL shouldForceBanner = [NSNumber al_numberWithString: value].boolValue;
-            MAAdFormat *forcedAdFormat = shouldForceBanner ? MAAdFormat.banner : DEVICE_SPECIFIC_ADVIEW_AD_FORMAT;
-            
-            self.adViewAdFormats[adUnitIdentifier] = forcedAdFormat;
-            [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: forcedAdFormat];
-        }
-        else if ( [@"adaptive_banner" isEqualToString: key] )
+        NSString *value = max_unity_nil_if_null(extraParameters[key]);
+        
+        if ( MAAdFormat.mrec != adFormat )
         {
-            [self log: @"Setting adaptive banners via extra parameters is deprecated and will be removed in a future plugin version. Use the CreateBanner(adUnitIdentifier, AdViewConfiguration) API to properly configure adaptive banners."];
-
-            BOOL shouldUseAdaptiveBanner = [NSNumber al_numberWithString: value].boolValue;
-            if ( shouldUseAdaptiveBanner )
+            if ( [@"force_banner" isEqualToString: key] )
             {
-                [self.disabledAdaptiveBannerAdUnitIdentifiers removeObject: adUnitIdentifier];
+                BOOL shouldForceBanner = [NSNumber al_numberWithString: value].boolValue;
+                MAAdFormat *forcedAdFormat = shouldForceBanner ? MAAdFormat.banner : DEVICE_SPECIFIC_ADVIEW_AD_FORMAT;
+                
+                state.adViewAdFormat = forcedAdFormat;
+                positionAdFormat = forcedAdFormat;
+                shouldPositionAdView = YES;
             }
-            else
+            else if ( [@"adaptive_banner" isEqualToString: key] )
             {
-                [self.disabledAdaptiveBannerAdUnitIdentifiers addObject: adUnitIdentifier];
+                MAX_UNITY_LOG_WARNING(@"Setting adaptive banners via extra parameters is deprecated and will be removed in a future plugin version. Use the CreateBanner(adUnitIdentifier, AdViewConfiguration) API to properly configure adaptive banners.");
+                
+                BOOL shouldUseAdaptiveBanner = [NSNumber al_numberWithString: value].boolValue;
+                state.adaptiveBannerDisabled = !shouldUseAdaptiveBanner;
+                
+                shouldPositionAdView = YES;
+            }
+            else if ( [@"ignore_safe_area_landscape" isEqualToString: key] && [NSNumber al_numberWithString: value].boolValue )
+            {
+                state.ignoresSafeAreaLandscape = YES;
+                shouldPositionAdView = YES;
             }
-            
-            [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
         }
-        else if ( [@"ignore_safe_area_landscape" isEqualToString: key] && [NSNumber al_numberWithString: value].boolValue )
+        
+        if ( [adFormat isAdViewAd] && [@"clips_to_bounds" isEqualToString: key] )
         {
-            [self.ignoreSafeAreaLandscapeAdUnitIdentifiers addObject: adUnitIdentifier];
-            [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+            state.adView.clipsToBounds = [NSNumber al_numberWithString: value].boolValue;
         }
     }
     
-    if ( [adFormat isAdViewAd] && [@"clips_to_bounds" isEqualToString: key] )
+    if ( shouldPositionAdView )
     {
-        BOOL clipsToBounds = [NSNumber al_numberWithString: value].boolValue;
-        MAAdView *view = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
-        view.clipsToBounds = clipsToBounds;
+        [self positionAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: positionAdFormat];
     }
 }
 
 - (void)showAdViewWithAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Showing %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Showing %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier);
         
-        MAAdView *view = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        MAAdView *view = state.adView;
         if ( !view )
         {
-            [self log: @"%@ does not exist for ad unit identifier %@.", adFormat, adUnitIdentifier];
+            MAX_UNITY_LOG_WARNING(@"%@ does not exist for ad unit identifier %@.", adFormat, adUnitIdentifier);
             
             // The adView has not yet been created. Store the ad unit ID, so that it can be displayed once the banner has been created.
-            [self.adUnitIdentifiersToShowAfterCreate addObject: adUnitIdentifier];
+            state.showAfterCreate = YES;
         }
         else
         {
             // Check edge case where ad may be detatched from view controller
             if ( !view.window.rootViewController )
             {
-                [self log: @"%@ missing view controller - re-attaching to %@...", adFormat, [self unityViewController]];
+                MAX_UNITY_LOG_WARNING(@"%@ missing view controller - re-attaching to %@...", adFormat, [self unityViewController]);
                 
                 UIViewController *rootViewController = [self unityViewController];
                 [rootViewController.view addSubview: view];
@@ -1437,7 +1989,7 @@ static ALUnityBackgroundCallback backgroundCallback;
         self.safeAreaBackground.hidden = NO;
         view.hidden = NO;
         
-        if ( ![self.disabledAutoRefreshAdViewAdUnitIdentifiers containsObject: adUnitIdentifier] )
+        if ( !state.isAutoRefreshDisabled )
         {
             [view startAutoRefresh];
         }
@@ -1447,10 +1999,11 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)hideAdViewWithAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Hiding %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier];
-        [self.adUnitIdentifiersToShowAfterCreate removeObject: adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Hiding %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier);
+        MAUnityAdUnitState *state = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        state.showAfterCreate = NO;
         
-        MAAdView *view = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAAdView *view = state.adView;
         view.hidden = YES;
         self.safeAreaBackground.hidden = YES;
         
@@ -1458,79 +2011,80 @@ static ALUnityBackgroundCallback backgroundCallback;
     });
 }
 
-- (NSString *)adViewLayoutForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
+- (CGRect)adViewFrameForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
-    [self log: @"Getting %@ position with ad unit identifier \"%@\"", adFormat, adUnitIdentifier];
+    MAX_UNITY_LOG_DEBUG(@"Getting %@ position with ad unit identifier \"%@\"", adFormat, adUnitIdentifier);
     
     MAAdView *view = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
     if ( !view )
     {
-        [self log: @"%@ does not exist for ad unit identifier %@", adFormat, adUnitIdentifier];
+        MAX_UNITY_LOG_WARNING(@"%@ does not exist for ad unit identifier %@", adFormat, adUnitIdentifier);
         
-        return @"";
+        return CGRectZero;
+    }
+    
+    // Apply a pending layout so the frame reflects any position or size set earlier this turn. Activating constraints only marks the
+    // superview as needing layout, so lay it out now rather than waiting for the next layout pass.
+    if ( [NSThread isMainThread] )
+    {
+        [self layoutAdViewIfNeededForAdUnitIdentifier: adUnitIdentifier];
+        [view.superview layoutIfNeeded];
     }
     
-    CGRect adViewFrame = view.frame;
-    return [MAUnityAdManager serializeParameters: @{@"origin_x" : [NSString stringWithFormat: @"%f", adViewFrame.origin.x],
-                                                    @"origin_y" : [NSString stringWithFormat: @"%f", adViewFrame.origin.y],
-                                                    @"width" : [NSString stringWithFormat: @"%f", CGRectGetWidth(adViewFrame)],
-                                                    @"height" : [NSString stringWithFormat: @"%f", CGRectGetHeight(adViewFrame)]}];
+    return view.frame;
 }
 
 - (void)destroyAdViewWithAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        [self log: @"Destroying %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier];
+        MAX_UNITY_LOG_DEBUG(@"Destroying %@ with ad unit identifier \"%@\"", adFormat, adUnitIdentifier);
         
-        MAAdView *view = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
+        MAAdView *view = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier].adView;
         view.delegate = nil;
         view.revenueDelegate = nil;
         view.adReviewDelegate = nil;
         
         [view removeFromSuperview];
         
-        [self.adViews removeObjectForKey: adUnitIdentifier];
-        [self.adViewAdFormats removeObjectForKey: adUnitIdentifier];
-        [self.adViewPositions removeObjectForKey: adUnitIdentifier];
-        [self.adViewOffsets removeObjectForKey: adUnitIdentifier];
-        [self.adViewWidths removeObjectForKey: adUnitIdentifier];
-        [self.verticalAdViewFormats removeObjectForKey: adUnitIdentifier];
-        [self.disabledAdaptiveBannerAdUnitIdentifiers removeObject: adUnitIdentifier];
+        // Drops everything tracked for the ad unit, including settings saved to be applied after create
+        [self removeAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        [self.adUnitIdentifiersNeedingLayout removeObject: adUnitIdentifier];
+        
+        if ( [self.safeAreaBackgroundAdUnitIdentifier isEqualToString: adUnitIdentifier] )
+        {
+            self.safeAreaBackgroundAdUnitIdentifier = nil;
+        }
     });
 }
 
 - (void)logInvalidAdFormat:(MAAdFormat *)adFormat
 {
-    [self log: @"invalid ad format: %@, from %@", adFormat, [NSThread callStackSymbols]];
+    MAX_UNITY_LOG_ERROR(@"invalid ad format: %@, from %@", adFormat, [NSThread callStackSymbols]);
 }
 
-- (void)log:(NSString *)format, ...
++ (void)logWithLevel:(max_unity_log_level)level tag:(NSString *)tag format:(NSString *)format, ...
 {
-    if (max_unity_should_disable_all_logs()) return;
+    if ( !MAX_UNITY_LOG_IS_ENABLED(level) ) return;
     
-    va_list valist;
-    va_start(valist, format);
-    NSString *message = [[NSString alloc] initWithFormat: format arguments: valist];
-    va_end(valist);
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        max_unity_log_set_writer(max_unity_log_write_to_console);
+    });
     
-    NSLog(@"[%@] [%@] %@", SDK_TAG, TAG, message);
-}
-
-+ (void)log:(NSString *)format, ...
-{
-    if (max_unity_should_disable_all_logs()) return;
-
     va_list valist;
     va_start(valist, format);
-    NSString *message = [[NSString alloc] initWithFormat: format arguments: valist];
+    NSMutableString *message = [NSMutableString stringWithFormat: @"[%@] ", tag];
+    [message appendString: [[NSString alloc] initWithFormat: format arguments: valist]];
     va_end(valist);
     
-    NSLog(@"[%@] [%@] %@", SDK_TAG, TAG, message);
+    const char *utf8Message = message.UTF8String;
+    max_unity_log_enqueue(level, utf8Message, strlen(utf8Message));
 }
 
 - (MAInterstitialAd *)retrieveInterstitialForAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    MAInterstitialAd *result = self.interstitials[adUnitIdentifier];
+    MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MAInterstitialAd *result = state.interstitial;
     if ( !result )
     {
         result = [[MAInterstitialAd alloc] initWithAdUnitIdentifier: adUnitIdentifier];
@@ -1539,7 +2093,7 @@ static ALUnityBackgroundCallback backgroundCallback;
         result.adReviewDelegate = self;
         result.expirationDelegate = self;
         
-        self.interstitials[adUnitIdentifier] = result;
+        state.interstitial = result;
     }
     
     return result;
@@ -1547,7 +2101,8 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (MAAppOpenAd *)retrieveAppOpenAdForAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    MAAppOpenAd *result = self.appOpenAds[adUnitIdentifier];
+    MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MAAppOpenAd *result = state.appOpenAd;
     if ( !result )
     {
         result = [[MAAppOpenAd alloc] initWithAdUnitIdentifier: adUnitIdentifier];
@@ -1555,7 +2110,7 @@ static ALUnityBackgroundCallback backgroundCallback;
         result.revenueDelegate = self;
         result.expirationDelegate = self;
         
-        self.appOpenAds[adUnitIdentifier] = result;
+        state.appOpenAd = result;
     }
     
     return result;
@@ -1563,7 +2118,8 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (MARewardedAd *)retrieveRewardedAdForAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    MARewardedAd *result = self.rewardedAds[adUnitIdentifier];
+    MAUnityAdUnitState *state = [self adUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MARewardedAd *result = state.rewardedAd;
     if ( !result )
     {
         result = [MARewardedAd sharedWithAdUnitIdentifier: adUnitIdentifier];
@@ -1572,7 +2128,7 @@ static ALUnityBackgroundCallback backgroundCallback;
         result.adReviewDelegate = self;
         result.expirationDelegate = self;
         
-        self.rewardedAds[adUnitIdentifier] = result;
+        state.rewardedAd = result;
     }
     
     return result;
@@ -1585,7 +2141,9 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (MAAdView *)retrieveAdViewForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat atPosition:(NSString *)adViewPosition withOffset:(CGPoint)offset isAdaptive:(BOOL)isAdaptive
 {
-    MAAdView *result = self.adViews[adUnitIdentifier];
+    // Only creating an ad view needs a new record
+    MAUnityAdUnitState *state = adViewPosition ? [self adUnitStateForAdUnitIdentifier: adUnitIdentifier] : [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MAAdView *result = state.adView;
     if ( !result && adViewPosition )
     {        
         MAAdViewConfiguration *config = [MAAdViewConfiguration configurationWithBuilderBlock:^(MAAdViewConfigurationBuilder *builder) {
@@ -1600,7 +2158,7 @@ static ALUnityBackgroundCallback backgroundCallback;
                 else
                 {
                     builder.adaptiveType = MAAdViewAdaptiveTypeNone;
-                    [self.disabledAdaptiveBannerAdUnitIdentifiers addObject:adUnitIdentifier];
+                    state.adaptiveBannerDisabled = YES;
                 }
             }
         }];
@@ -1613,9 +2171,9 @@ static ALUnityBackgroundCallback backgroundCallback;
         result.revenueDelegate = self;
         result.adReviewDelegate = self;
         
-        self.adViews[adUnitIdentifier] = result;
-        self.adViewPositions[adUnitIdentifier] = adViewPosition;
-        self.adViewOffsets[adUnitIdentifier] = [NSValue valueWithCGPoint: offset];
+        state.adView = result;
+        state.adViewPosition = adViewPosition;
+        state.adViewOffset = offset;
         
         UIViewController *rootViewController = [self unityViewController];
         [rootViewController.view addSubview: result];
@@ -1635,181 +2193,186 @@ static ALUnityBackgroundCallback backgroundCallback;
 - (void)positionAdViewForAdUnitIdentifier:(NSString *)adUnitIdentifier adFormat:(MAAdFormat *)adFormat
 {
     max_unity_dispatch_on_main_thread(^{
-        MAAdView *adView = [self retrieveAdViewForAdUnitIdentifier: adUnitIdentifier adFormat: adFormat];
-        NSString *adViewPosition = self.adViewPositions[adUnitIdentifier];
-        NSValue *adViewPositionValue = self.adViewOffsets[adUnitIdentifier];
-        CGPoint adViewOffset = [adViewPositionValue CGPointValue];
-        BOOL isAdaptiveBannerDisabled = [self.disabledAdaptiveBannerAdUnitIdentifiers containsObject: adUnitIdentifier];
-        BOOL isWidthPtsOverridden = self.adViewWidths[adUnitIdentifier] != nil;
-        
-        UIView *superview = adView.superview;
-        if ( !superview ) return;
-        
-        // Deactivate any previous constraints and reset rotation so that the banner can be positioned again.
-        NSArray<NSLayoutConstraint *> *activeConstraints = self.adViewConstraints[adUnitIdentifier];
-        [NSLayoutConstraint deactivateConstraints: activeConstraints];
-        adView.transform = CGAffineTransformIdentity;
-        [self.verticalAdViewFormats removeObjectForKey: adUnitIdentifier];
-        
-        // Ensure superview contains the safe area background.
-        if ( ![superview.subviews containsObject: self.safeAreaBackground] )
-        {
-            [self.safeAreaBackground removeFromSuperview];
-            [superview insertSubview: self.safeAreaBackground belowSubview: adView];
-        }
-        
-        // Deactivate any previous constraints and reset visibility state so that the safe area background can be positioned again.
-        [NSLayoutConstraint deactivateConstraints: self.safeAreaBackground.constraints];
-        self.safeAreaBackground.hidden = adView.hidden;
+        MAUnityAdUnitState *state = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+        if ( !state.adView ) return;
         
-        //
-        // Determine ad width
-        //
-        CGFloat adViewWidth;
+        // Re-marking an ad unit moves it to the end, so the last ad view positioned still owns the shared safe area background
+        [self.adUnitIdentifiersNeedingLayout removeObject: adUnitIdentifier];
+        [self.adUnitIdentifiersNeedingLayout addObject: adUnitIdentifier];
+        state.adViewFormatNeedingLayout = adFormat;
         
-        // Check if publisher has overridden width as points
-        if ( isWidthPtsOverridden )
-        {
-            adViewWidth = self.adViewWidths[adUnitIdentifier].floatValue;
-        }
-        // Top center / bottom center stretches full screen
-        else if ( [adViewPosition isEqual: @"top_center"] || [adViewPosition isEqual: @"bottom_center"] )
-        {
-            adViewWidth = CGRectGetWidth(KEY_WINDOW.bounds);
-        }
-        // Else use standard widths of 320, 728, or 300
-        else
-        {
-            adViewWidth = adFormat.size.width;
-        }
+        if ( self.isAdViewLayoutScheduled ) return;
         
-        //
-        // Determine ad height
-        //
-        CGFloat adViewHeight;
+        self.adViewLayoutScheduled = YES;
         
-        if ( (adFormat == MAAdFormat.banner || adFormat == MAAdFormat.leader) && !isAdaptiveBannerDisabled )
-        {
-            adViewHeight = [adFormat adaptiveSizeForWidth: adViewWidth].height;
-        }
-        else
+        // Lay out once before the run loop goes to sleep, which is before Core Animation commits the frame, so setters called in the same turn share a single pass
+        CFRunLoopObserverRef observer = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault, kCFRunLoopBeforeWaiting | kCFRunLoopExit, false, 0, ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+            [self layoutAdViewsIfNeeded];
+        });
+        CFRunLoopAddObserver(CFRunLoopGetMain(), observer, kCFRunLoopCommonModes);
+        CFRelease(observer);
+    });
+}
+
+- (void)layoutAdViewsIfNeeded
+{
+    uint64_t startTimestamp = max_unity_timeline_now();
+    self.adViewLayoutScheduled = NO;
+    
+    NSArray<NSString *> *adUnitIdentifiers = self.adUnitIdentifiersNeedingLayout.array;
+    for ( NSString *adUnitIdentifier in adUnitIdentifiers )
+    {
+        [self layoutAdViewIfNeededForAdUnitIdentifier: adUnitIdentifier];
+    }
+    
+    max_unity_timeline_record(MAX_UNITY_TIMELINE_SPAN_AD_VIEW_LAYOUT, (uint32_t) adUnitIdentifiers.count, startTimestamp, max_unity_timeline_now());
+}
+
+- (void)layoutAdViewIfNeededForAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    [self.adUnitIdentifiersNeedingLayout removeObject: adUnitIdentifier];
+    
+    MAUnityAdUnitState *state = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier];
+    MAAdFormat *adFormat = state.adViewFormatNeedingLayout;
+    if ( !adFormat ) return;
+    
+    state.adViewFormatNeedingLayout = nil;
+    [self layoutAdViewForAdUnitState: state adFormat: adFormat];
+}
+
+- (max_unity_ad_view_layout_input)adViewLayoutInputForAdUnitState:(MAUnityAdUnitState *)state adFormat:(MAAdFormat *)adFormat
+{
+    NSString *adViewPosition = state.adViewPosition;
+    CGPoint adViewOffset = state.adViewOffset;
+    NSNumber *adViewWidth = state.adViewWidth;
+    CGRect windowBounds = KEY_WINDOW.bounds;
+    UIInterfaceOrientation orientation = [UIApplication sharedApplication].statusBarOrientation;
+    
+    max_unity_ad_view_layout_input input = {0};
+    input.position = max_unity_ad_view_position_from_string(adViewPosition.UTF8String);
+    input.offset_x = adViewOffset.x;
+    input.offset_y = adViewOffset.y;
+    input.format_width = adFormat.size.width;
+    input.format_height = adFormat.size.height;
+    input.is_mrec = MAAdFormat.mrec == adFormat;
+    input.supports_adaptive_height = adFormat == MAAdFormat.banner || adFormat == MAAdFormat.leader;
+    input.is_adaptive_banner_disabled = state.isAdaptiveBannerDisabled;
+    input.has_width_override = adViewWidth != nil;
+    input.width_override = adViewWidth.floatValue;
+    input.window_width = CGRectGetWidth(windowBounds);
+    input.window_height = CGRectGetHeight(windowBounds);
+    input.has_background_color = self.publisherBannerBackgroundColor != nil;
+    input.ignores_safe_area = [self shouldIgnoreSafeAreaForAdUnitState: state];
+    input.orientation = ( orientation == UIInterfaceOrientationLandscapeLeft ) ? MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_LEFT : ( orientation == UIInterfaceOrientationLandscapeRight ) ? MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_RIGHT : MAX_UNITY_INTERFACE_ORIENTATION_OTHER;
+    input.adaptive_height_for_width = max_unity_adaptive_height_for_width;
+    input.adaptive_height_context = (__bridge void *) adFormat;
+    
+    return input;
+}
+
+- (void)layoutAdViewForAdUnitState:(MAUnityAdUnitState *)state adFormat:(MAAdFormat *)adFormat
+{
+    NSString *adUnitIdentifier = state.adUnitIdentifier;
+    MAAdView *adView = state.adView;
+    
+    UIView *superview = adView.superview;
+    if ( !superview ) return;
+    
+    max_unity_ad_view_layout_input input = [self adViewLayoutInputForAdUnitState: state adFormat: adFormat];
+    max_unity_ad_view_geometry geometry = max_unity_ad_view_compute_geometry(&input);
+    
+    // Skip rebuilding the constraints if nothing that affects them has changed. The safe area background is shared, so it must still be ours.
+    NSArray<NSLayoutConstraint *> *activeConstraints = state.adViewConstraints;
+    if ( state.hasAdViewGeometry
+        && [self.safeAreaBackgroundAdUnitIdentifier isEqualToString: adUnitIdentifier]
+        && self.safeAreaBackground.superview == superview
+        && [self areConstraintsActive: activeConstraints] )
+    {
+        max_unity_ad_view_geometry previousGeometry = state.adViewGeometry;
+        if ( max_unity_ad_view_geometry_equals(&previousGeometry, &geometry) )
         {
-            adViewHeight = adFormat.size.height;
+            self.safeAreaBackground.hidden = adView.hidden || geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_NONE;
+            return;
         }
-        
-        CGSize adViewSize = CGSizeMake(adViewWidth, adViewHeight);
-        
-        // All positions have constant height
-        NSMutableArray<NSLayoutConstraint *> *constraints = [NSMutableArray arrayWithObject: [adView.heightAnchor constraintEqualToConstant: adViewSize.height]];
-        
-        UILayoutGuide *layoutGuide = superview.safeAreaLayoutGuide;
-        BOOL shouldIgnoreSafeArea = [self shouldIgnoreSafeAreaForAdUnitIdentifier: adUnitIdentifier];
-        NSLayoutAnchor *topAnchor = shouldIgnoreSafeArea ? superview.topAnchor : layoutGuide.topAnchor;
-        
-        if ( [adViewPosition isEqual: @"top_center"] || [adViewPosition isEqual: @"bottom_center"] )
-        {
-            // Non AdMob banners will still be of 50/90 points tall. Set the auto sizing mask such that the inner ad view is pinned to the bottom or top according to the ad view position.
-            if ( !isAdaptiveBannerDisabled )
+    }
+    
+    // Deactivate any previous constraints and reset rotation so that the banner can be positioned again.
+    [NSLayoutConstraint deactivateConstraints: activeConstraints];
+    adView.transform = CGAffineTransformIdentity;
+    state.verticalAdViewFormat = nil;
+    
+    // Ensure superview contains the safe area background.
+    if ( ![superview.subviews containsObject: self.safeAreaBackground] )
+    {
+        [self.safeAreaBackground removeFromSuperview];
+        [superview insertSubview: self.safeAreaBackground belowSubview: adView];
+    }
+    
+    // Deactivate any previous constraints and reset visibility state so that the safe area background can be positioned again.
+    [NSLayoutConstraint deactivateConstraints: self.safeAreaBackground.constraints];
+    self.safeAreaBackground.hidden = adView.hidden || geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_NONE;
+    self.safeAreaBackgroundAdUnitIdentifier = adUnitIdentifier;
+    
+    if ( geometry.autoresizing == MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_TOP_MARGIN )
+    {
+        adView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleTopMargin;
+    }
+    else if ( geometry.autoresizing == MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_BOTTOM_MARGIN )
+    {
+        adView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleBottomMargin;
+    }
+    
+    UILayoutGuide *layoutGuide = superview.safeAreaLayoutGuide;
+    NSLayoutAnchor *topAnchor = geometry.uses_superview_top ? superview.topAnchor : layoutGuide.topAnchor;
+    
+    // All positions have constant height
+    NSMutableArray<NSLayoutConstraint *> *constraints = [NSMutableArray arrayWithObject: [adView.heightAnchor constraintEqualToConstant: geometry.height]];
+    
+    if ( geometry.spans_superview_width )
+    {
+        [constraints addObjectsFromArray: @[[adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor],
+                                            [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
+    }
+    else
+    {
+        [constraints addObject: [adView.widthAnchor constraintEqualToConstant: geometry.width]];
+    }
+    
+    switch ( geometry.position )
+    {
+        case MAX_UNITY_AD_VIEW_POSITION_TOP_LEFT:
+            [constraints addObjectsFromArray: @[[adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor constant: geometry.offset_x],
+                                                [adView.topAnchor constraintEqualToAnchor: topAnchor constant: geometry.offset_y]]];
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER:
+        case MAX_UNITY_AD_VIEW_POSITION_BOTTOM_CENTER:
+            if ( !geometry.spans_superview_width )
             {
-                adView.autoresizingMask = UIViewAutoresizingFlexibleWidth;
-                
-                if ( [@"top_center" isEqual: adViewPosition] )
-                {
-                    adView.autoresizingMask |= UIViewAutoresizingFlexibleBottomMargin;
-                }
-                else // bottom_center
-                {
-                    adView.autoresizingMask |= UIViewAutoresizingFlexibleTopMargin;
-                }
+                [constraints addObject: [adView.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor]];
             }
             
-            // If publisher actually provided a banner background color
-            if ( self.publisherBannerBackgroundColor && adFormat != MAAdFormat.mrec )
+            if ( geometry.position == MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER )
             {
-                if ( isWidthPtsOverridden )
-                {
-                    [constraints addObjectsFromArray: @[[adView.widthAnchor constraintEqualToConstant: adViewWidth],
-                                                        [adView.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor],
-                                                        [self.safeAreaBackground.widthAnchor constraintEqualToConstant: adViewWidth],
-                                                        [self.safeAreaBackground.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor]]];
-                    
-                    if ( [adViewPosition isEqual: @"top_center"] )
-                    {
-                        [constraints addObjectsFromArray: @[[adView.topAnchor constraintEqualToAnchor: topAnchor],
-                                                            [self.safeAreaBackground.topAnchor constraintEqualToAnchor: superview.topAnchor],
-                                                            [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: adView.topAnchor]]];
-                    }
-                    else // bottom_center
-                    {
-                        [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
-                                                            [self.safeAreaBackground.topAnchor constraintEqualToAnchor: adView.bottomAnchor],
-                                                            [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: superview.bottomAnchor]]];
-                    }
-                }
-                else
-                {
-                    [constraints addObjectsFromArray: @[[adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor],
-                                                        [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor],
-                                                        [self.safeAreaBackground.leftAnchor constraintEqualToAnchor: superview.leftAnchor],
-                                                        [self.safeAreaBackground.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
-                    
-                    if ( [adViewPosition isEqual: @"top_center"] )
-                    {
-                        [constraints addObjectsFromArray: @[[adView.topAnchor constraintEqualToAnchor: topAnchor],
-                                                            [self.safeAreaBackground.topAnchor constraintEqualToAnchor: superview.topAnchor],
-                                                            [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: adView.topAnchor]]];
-                    }
-                    else // bottom_center
-                    {
-                        [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
-                                                            [self.safeAreaBackground.topAnchor constraintEqualToAnchor: adView.bottomAnchor],
-                                                            [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: superview.bottomAnchor]]];
-                    }
-                }
+                [constraints addObject: [adView.topAnchor constraintEqualToAnchor: topAnchor]];
             }
-            // If pub does not have a background color set or this is not a banner
             else
             {
-                self.safeAreaBackground.hidden = YES;
-                
-                [constraints addObjectsFromArray: @[[adView.widthAnchor constraintEqualToConstant: adViewWidth],
-                                                    [adView.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor]]];
-                
-                if ( [adViewPosition isEqual: @"top_center"] )
-                {
-                    [constraints addObject: [adView.topAnchor constraintEqualToAnchor: topAnchor]];
-                }
-                else // BottomCenter
-                {
-                    [constraints addObject: [adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor]];
-                }
+                [constraints addObject: [adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor]];
             }
-        }
-        // Check if the publisher wants vertical banners.
-        else if ( [adViewPosition isEqual: @"center_left"] || [adViewPosition isEqual: @"center_right"] )
-        {
-            if ( MAAdFormat.mrec == adFormat )
-            {
-                [constraints addObject: [adView.widthAnchor constraintEqualToConstant: adViewSize.width]];
-                
-                if ( [adViewPosition isEqual: @"center_left"] )
-                {
-                    [constraints addObjectsFromArray: @[[adView.centerYAnchor constraintEqualToAnchor: layoutGuide.centerYAnchor],
-                                                        [adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor]]];
-                    
-                    [constraints addObjectsFromArray: @[[self.safeAreaBackground.rightAnchor constraintEqualToAnchor: layoutGuide.leftAnchor],
-                                                        [self.safeAreaBackground.leftAnchor constraintEqualToAnchor: superview.leftAnchor]]];
-                }
-                else // center_right
-                {
-                    [constraints addObjectsFromArray: @[[adView.centerYAnchor constraintEqualToAnchor: layoutGuide.centerYAnchor],
-                                                        [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
-                    
-                    [constraints addObjectsFromArray: @[[self.safeAreaBackground.leftAnchor constraintEqualToAnchor: layoutGuide.rightAnchor],
-                                                        [self.safeAreaBackground.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
-                }
-            }
-            else
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_TOP_RIGHT:
+            [constraints addObjectsFromArray: @[[adView.topAnchor constraintEqualToAnchor: topAnchor],
+                                                [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_CENTERED:
+            [constraints addObjectsFromArray: @[[adView.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor],
+                                                [adView.centerYAnchor constraintEqualToAnchor: layoutGuide.centerYAnchor]]];
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT:
+        case MAX_UNITY_AD_VIEW_POSITION_CENTER_RIGHT:
+        {
+            BOOL isLeft = geometry.position == MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT;
+            if ( geometry.is_rotated )
             {
                 /* Align the center of the view such that when rotated it snaps into place.
                  *
@@ -1833,97 +2396,147 @@ static ALUnityBackgroundCallback backgroundCallback;
                  *                   v
                  *            Banner Half Height
                  */
-                self.safeAreaBackground.hidden = YES;
-                
                 adView.transform = CGAffineTransformRotate(CGAffineTransformIdentity, M_PI_2);
                 
-                CGFloat width;
-                // If the publiser has a background color set - set the width to the height of the screen, to span the ad across the screen after it is rotated.
-                if ( self.publisherBannerBackgroundColor )
+                NSLayoutXAxisAnchor *anchor;
+                if ( isLeft )
                 {
-                    if ( isWidthPtsOverridden )
-                    {
-                        width = adViewWidth;
-                    }
-                    else
-                    {
-                        width = CGRectGetHeight(KEY_WINDOW.bounds);
-                    }
+                    anchor = geometry.center_x_uses_safe_area ? layoutGuide.leftAnchor : superview.leftAnchor;
                 }
-                // Otherwise - we shouldn't span the banner the width of the realm (there might be user-interactable UI on the sides)
                 else
                 {
-                    width = adViewWidth;
+                    anchor = geometry.center_x_uses_safe_area ? layoutGuide.rightAnchor : superview.rightAnchor;
                 }
-                [constraints addObject: [adView.widthAnchor constraintEqualToConstant: width]];
                 
-                // Set constraints such that the center of the banner aligns with the center left or right as needed. That way, once rotated, the banner snaps into place.
-                [constraints addObject: [adView.centerYAnchor constraintEqualToAnchor: superview.centerYAnchor]];
-                
-                // Place the center of the banner half the height of the banner away from the side. If we align the center exactly with the left/right anchor, only half the banner will be visible.
-                CGFloat bannerHalfHeight = adViewSize.height / 2.0;
-                UIInterfaceOrientation orientation = [UIApplication sharedApplication].statusBarOrientation;
-                if ( [adViewPosition isEqual: @"center_left"] )
-                {
-                    NSLayoutAnchor *anchor = ( orientation == UIInterfaceOrientationLandscapeRight ) ? layoutGuide.leftAnchor : superview.leftAnchor;
-                    [constraints addObject: [adView.centerXAnchor constraintEqualToAnchor: anchor constant: bannerHalfHeight]];
-                }
-                else // CenterRight
-                {
-                    NSLayoutAnchor *anchor = ( orientation == UIInterfaceOrientationLandscapeLeft ) ? layoutGuide.rightAnchor : superview.rightAnchor;
-                    [constraints addObject: [adView.centerXAnchor constraintEqualToAnchor: anchor constant: -bannerHalfHeight]];
-                }
+                [constraints addObjectsFromArray: @[[adView.centerYAnchor constraintEqualToAnchor: superview.centerYAnchor],
+                                                    [adView.centerXAnchor constraintEqualToAnchor: anchor constant: geometry.center_x_offset]]];
                 
                 // Store the ad view with format, so that it can be updated when the orientation changes.
-                self.verticalAdViewFormats[adUnitIdentifier] = adFormat;
-                
-                // If adaptive - make top flexible since we anchor with the bottom of the banner at the edge of the screen
-                if ( !isAdaptiveBannerDisabled )
-                {
-                    adView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleTopMargin;
-                }
+                state.verticalAdViewFormat = adFormat;
             }
+            else
+            {
+                [constraints addObjectsFromArray: @[[adView.centerYAnchor constraintEqualToAnchor: layoutGuide.centerYAnchor],
+                                                    isLeft ? [adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor] : [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
+            }
+            break;
+        }
+        case MAX_UNITY_AD_VIEW_POSITION_BOTTOM_LEFT:
+            [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
+                                                [adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor]]];
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_BOTTOM_RIGHT:
+            [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
+                                                [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
+            break;
+        case MAX_UNITY_AD_VIEW_POSITION_NONE:
+            // Publisher will likely construct their own views around the ad view
+            break;
+    }
+    
+    if ( geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_ABOVE || geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_BELOW )
+    {
+        if ( geometry.spans_superview_width )
+        {
+            [constraints addObjectsFromArray: @[[self.safeAreaBackground.leftAnchor constraintEqualToAnchor: superview.leftAnchor],
+                                                [self.safeAreaBackground.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
         }
-        // Otherwise, publisher will likely construct his own views around the adview
         else
         {
-            self.safeAreaBackground.hidden = YES;
-            
-            [constraints addObject: [adView.widthAnchor constraintEqualToConstant: adViewWidth]];
-            
-            if ( [adViewPosition isEqual: @"top_left"] )
-            {
-                [constraints addObjectsFromArray: @[[adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor constant: adViewOffset.x],
-                                                    [adView.topAnchor constraintEqualToAnchor: topAnchor constant: adViewOffset.y]]];
-            }
-            else if ( [adViewPosition isEqual: @"top_right"] )
-            {
-                [constraints addObjectsFromArray: @[[adView.topAnchor constraintEqualToAnchor: topAnchor],
-                                                    [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
-            }
-            else if ( [adViewPosition isEqual: @"centered"] )
-            {
-                [constraints addObjectsFromArray: @[[adView.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor],
-                                                    [adView.centerYAnchor constraintEqualToAnchor: layoutGuide.centerYAnchor]]];
-            }
-            else if ( [adViewPosition isEqual: @"bottom_left"] )
-            {
-                [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
-                                                    [adView.leftAnchor constraintEqualToAnchor: superview.leftAnchor]]];
-            }
-            else if ( [adViewPosition isEqual: @"bottom_right"] )
-            {
-                [constraints addObjectsFromArray: @[[adView.bottomAnchor constraintEqualToAnchor: layoutGuide.bottomAnchor],
-                                                    [adView.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
-            }
+            [constraints addObjectsFromArray: @[[self.safeAreaBackground.widthAnchor constraintEqualToConstant: geometry.width],
+                                                [self.safeAreaBackground.centerXAnchor constraintEqualToAnchor: layoutGuide.centerXAnchor]]];
         }
         
-        self.adViewConstraints[adUnitIdentifier] = constraints;
-        
-        [NSLayoutConstraint activateConstraints: constraints];
+        if ( geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_ABOVE )
+        {
+            [constraints addObjectsFromArray: @[[self.safeAreaBackground.topAnchor constraintEqualToAnchor: superview.topAnchor],
+                                                [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: adView.topAnchor]]];
+        }
+        else
+        {
+            [constraints addObjectsFromArray: @[[self.safeAreaBackground.topAnchor constraintEqualToAnchor: adView.bottomAnchor],
+                                                [self.safeAreaBackground.bottomAnchor constraintEqualToAnchor: superview.bottomAnchor]]];
+        }
+    }
+    else if ( geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_LEFT )
+    {
+        [constraints addObjectsFromArray: @[[self.safeAreaBackground.rightAnchor constraintEqualToAnchor: layoutGuide.leftAnchor],
+                                            [self.safeAreaBackground.leftAnchor constraintEqualToAnchor: superview.leftAnchor]]];
+    }
+    else if ( geometry.safe_area_background == MAX_UNITY_SAFE_AREA_BACKGROUND_RIGHT )
+    {
+        [constraints addObjectsFromArray: @[[self.safeAreaBackground.leftAnchor constraintEqualToAnchor: layoutGuide.rightAnchor],
+                                            [self.safeAreaBackground.rightAnchor constraintEqualToAnchor: superview.rightAnchor]]];
+    }
+    
+    state.adViewConstraints = constraints;
+    state.adViewGeometry = geometry;
+    state.hasAdViewGeometry = YES;
+    
+    [NSLayoutConstraint activateConstraints: constraints];
+    
+    [self scheduleAdViewFrameCheck];
+}
+
+/**
+ * Checks the ad view frames once the current layout pass has been applied, which is on the next turn of the main run loop.
+ */
+- (void)scheduleAdViewFrameCheck
+{
+    if ( self.isAdViewFrameCheckScheduled ) return;
+    
+    self.adViewFrameCheckScheduled = YES;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        self.adViewFrameCheckScheduled = NO;
+        [self notifyAdViewFrameChanges];
     });
 }
 
+- (void)notifyAdViewFrameChanges
+{
+    for ( MAUnityAdUnitState *state in [self allAdUnitStates] )
+    {
+        MAAdView *adView = state.adView;
+        if ( !adView.superview ) continue;
+        
+        // Constraints activated since the last layout pass are not reflected in the frame until the superview is laid out
+        [adView.superview layoutIfNeeded];
+        
+        CGRect frame = adView.frame;
+        if ( state.hasReportedAdViewFrame && CGRectEqualToRect(frame, state.reportedAdViewFrame) ) continue;
+        
+        // The frame is only marked as reported once it is sent, so a listener added later gets the current frame on the next layout pass
+        NSString *name = ( state.adViewAdFormat == MAAdFormat.mrec ) ? @"OnMRecAdLayoutChangedEvent" : @"OnBannerAdLayoutChangedEvent";
+        if ( ![self hasListenerForEventWithName: name] ) continue;
+        
+        state.reportedAdViewFrame = frame;
+        state.hasReportedAdViewFrame = YES;
+        
+        NSString *adUnitIdentifier = state.adUnitIdentifier;
+        dispatch_async(self.eventPipelineQueue, ^{
+            [self forwardUnityEventWithArgs: @{@"name" : name,
+                                               @"adUnitId" : adUnitIdentifier,
+                                               @"origin_x" : max_unity_payload_number(@(frame.origin.x)),
+                                               @"origin_y" : max_unity_payload_number(@(frame.origin.y)),
+                                               @"width" : max_unity_payload_number(@(CGRectGetWidth(frame))),
+                                               @"height" : max_unity_payload_number(@(CGRectGetHeight(frame)))}];
+        });
+    }
+}
+
+- (BOOL)areConstraintsActive:(nullable NSArray<NSLayoutConstraint *> *)constraints
+{
+    if ( constraints.count == 0 ) return NO;
+    
+    for ( NSLayoutConstraint *constraint in constraints )
+    {
+        if ( !constraint.isActive ) return NO;
+    }
+    
+    return YES;
+}
+
 - (UIViewController *)unityViewController
 {
     // Handle edge case where `UnityGetGLViewController()` returns nil
@@ -1932,17 +2545,163 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (void)forwardUnityEventWithArgs:(NSDictionary<NSString *, id> *)args
 {
+    [self forwardUnityEventWithArgs: args cachedAdInfo: nil];
+}
+
+- (void)forwardUnityEventWithArgs:(NSDictionary<NSString *, id> *)args forAd:(MAAd *)ad
+{
+    [self forwardUnityEventWithArgs: args cachedAdInfo: [self cachedAdInfoForAd: ad payloadLevel: max_unity_payload_level_for_event(args[@"name"])]];
+}
+
+/**
+ * Must only be called from @c eventPipelineQueue.
+ */
+- (void)forwardUnityEventWithArgs:(NSDictionary<NSString *, id> *)args cachedAdInfo:(nullable MAUnityCachedAdInfo *)cachedAdInfo
+{
+    // Events are coalesced into a single batch until it is flushed, so a burst (or everything received while the application is not active) crosses into Unity once
+    MAUnityPendingEvent *pendingEvent = [[MAUnityPendingEvent alloc] initWithArgs: args cachedAdInfo: cachedAdInfo];
+    pendingEvent.delegateTimestamp = currentDelegateTimestamp;
+    [self.pendingUnityEvents addObject: pendingEvent];
+    
+    if ( max_unity_timeline_is_enabled() )
+    {
+        NSString *name = args[@"name"];
+        currentDelegateEventIdentifier = max_unity_event_id_for_name(name.UTF8String);
+    }
+    
+    int batchingWindowMillis = atomic_load(&eventBatchingWindowMillis);
+    if ( batchingWindowMillis <= 0 )
+    {
+        [self flushPendingUnityEvents];
+        return;
+    }
+    
+    if ( self.pendingUnityEventsFlushScheduled ) return;
+    
+    self.pendingUnityEventsFlushScheduled = YES;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t) batchingWindowMillis * NSEC_PER_MSEC), self.eventPipelineQueue, ^{
+        self.pendingUnityEventsFlushScheduled = NO;
+        [self flushPendingUnityEvents];
+    });
+}
+
+/**
+ * Must only be called from @c eventPipelineQueue.
+ */
+- (void)flushPendingUnityEvents
+{
+    if ( self.pendingUnityEvents.count == 0 ) return;
+    
 #if !IS_TEST_APP
     extern bool _didResignActive;
-    // We should not call any script callbacks when application is not active. Suspend the callback queue if resign is active.
-    // We'll resume the queue once the application becomes active again.
-    self.backgroundCallbackEventsQueue.suspended = _didResignActive;
+    // We should not call any script callbacks when application is not active. The events are held until the application becomes active again.
+    if ( _didResignActive ) return;
 #endif
     
-    [self.backgroundCallbackEventsQueue addOperationWithBlock:^{
-        NSString *serializedParameters = [MAUnityAdManager serializeParameters: args];
-        backgroundCallback(serializedParameters.UTF8String);
-    }];
+    NSArray<MAUnityPendingEvent *> *pendingEvents = self.pendingUnityEvents;
+    self.pendingUnityEvents = [NSMutableArray array];
+    
+    [self forwardUnityEvents: pendingEvents];
+}
+
+/**
+ * Sends the events to Unity in order. Consecutive binary encoded events are sent as one buffer of back to back frames, and consecutive JSON events as one string
+ * with one event per line. Must only be called from @c eventPipelineQueue.
+ */
+- (void)forwardUnityEvents:(NSArray<MAUnityPendingEvent *> *)pendingEvents
+{
+    NSMutableArray<NSString *> *serializedEvents = [NSMutableArray array];
+    binaryEventWriter.length = 0;
+    
+    // The timed events serialized since the last flush. Only created while pipeline stats are enabled.
+    NSMutableArray<MAUnityPendingEvent *> *unflushedTimedEvents = max_unity_pipeline_stats_is_enabled() ? [NSMutableArray array] : nil;
+    
+    for ( MAUnityPendingEvent *pendingEvent in pendingEvents )
+    {
+        size_t binaryEventStart = binaryEventWriter.length;
+        if ( [self appendBinaryUnityEventWithArgs: pendingEvent.args cachedAdInfo: pendingEvent.cachedAdInfo] )
+        {
+            [self recordHandoffForTimedEvents: unflushedTimedEvents];
+            [self flushSerializedUnityEvents: serializedEvents];
+            
+            [self recordSerializationOfPendingEvent: pendingEvent byteCount: binaryEventWriter.length - binaryEventStart timedEvents: unflushedTimedEvents];
+            continue;
+        }
+        
+        [self recordHandoffForTimedEvents: unflushedTimedEvents];
+        [self flushBinaryUnityEvents];
+        
+        NSString *serializedParameters = [MAUnityAdManager serializeParameters: pendingEvent.args];
+        if ( pendingEvent.cachedAdInfo )
+        {
+            // Splice the cached ad info members in before the closing brace of the event specific parameters
+            serializedParameters = [NSString stringWithFormat: @"%@,%@}", [serializedParameters substringToIndex: serializedParameters.length - 1], pendingEvent.cachedAdInfo.serializedAdInfoFragment];
+        }
+        
+        [serializedEvents addObject: serializedParameters];
+        
+        if ( unflushedTimedEvents )
+        {
+            [self recordSerializationOfPendingEvent: pendingEvent byteCount: [serializedParameters lengthOfBytesUsingEncoding: NSUTF8StringEncoding] timedEvents: unflushedTimedEvents];
+        }
+    }
+    
+    [self recordHandoffForTimedEvents: unflushedTimedEvents];
+    [self flushBinaryUnityEvents];
+    [self flushSerializedUnityEvents: serializedEvents];
+}
+
+#pragma mark - Pipeline Stats
+
+/**
+ * Records how long the event took from its delegate callback until it was serialized, and adds it to @c timedEvents so its handoff can be recorded when it is flushed.
+ * Does nothing while pipeline stats are disabled, in which case @c timedEvents is @c nil.
+ */
+- (void)recordSerializationOfPendingEvent:(MAUnityPendingEvent *)pendingEvent byteCount:(size_t)byteCount timedEvents:(nullable NSMutableArray<MAUnityPendingEvent *> *)timedEvents
+{
+    if ( !timedEvents || pendingEvent.delegateTimestamp == 0 ) return;
+    
+    NSString *name = pendingEvent.args[@"name"];
+    pendingEvent.eventIdentifier = max_unity_event_id_for_name(name.UTF8String);
+    pendingEvent.serializedTimestamp = max_unity_pipeline_stats_now();
+    
+    max_unity_pipeline_stats_record(pendingEvent.eventIdentifier, MAX_UNITY_PIPELINE_STAGE_BUILD, pendingEvent.delegateTimestamp, pendingEvent.serializedTimestamp, byteCount);
+    [timedEvents addObject: pendingEvent];
+}
+
+/**
+ * Records how long each event waited between being serialized and being handed to Unity. Must be called right before the events are flushed.
+ */
+- (void)recordHandoffForTimedEvents:(nullable NSMutableArray<MAUnityPendingEvent *> *)timedEvents
+{
+    if ( timedEvents.count == 0 ) return;
+    
+    uint64_t handoffTimestamp = max_unity_pipeline_stats_now();
+    for ( MAUnityPendingEvent *timedEvent in timedEvents )
+    {
+        max_unity_pipeline_stats_record(timedEvent.eventIdentifier, MAX_UNITY_PIPELINE_STAGE_HANDOFF, timedEvent.serializedTimestamp, handoffTimestamp, 0);
+    }
+    
+    [timedEvents removeAllObjects];
+}
+
+- (void)flushSerializedUnityEvents:(NSMutableArray<NSString *> *)serializedEvents
+{
+    if ( serializedEvents.count == 0 ) return;
+    
+    // Compact JSON never contains a raw newline, so it can be used to separate the events
+    NSString *serializedBatch = serializedEvents.count == 1 ? serializedEvents.firstObject : [serializedEvents componentsJoinedByString: @"\n"];
+    [serializedEvents removeAllObjects];
+    
+    backgroundCallback(serializedBatch.UTF8String);
+}
+
+- (void)flushBinaryUnityEvents
+{
+    if ( binaryEventWriter.length == 0 ) return;
+    
+    binaryBackgroundCallback(binaryEventWriter.bytes, (int) binaryEventWriter.length);
+    binaryEventWriter.length = 0;
 }
 
 + (NSString *)serializeParameters:(NSDictionary<NSString *, id> *)dict
@@ -1961,7 +2720,7 @@ static ALUnityBackgroundCallback backgroundCallback;
                                                                                        error: &error];
         if ( error )
         {
-            [self log: @"Failed to deserialize (%@) with error %@", serialized, error];
+            MAX_UNITY_LOG_ERROR(@"Failed to deserialize (%@) with error %@", serialized, error);
             return @{};
         }
         
@@ -1975,9 +2734,10 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (MAAdFormat *)adViewAdFormatForAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    if ( self.adViewAdFormats[adUnitIdentifier] )
+    MAAdFormat *adFormat = [self existingAdUnitStateForAdUnitIdentifier: adUnitIdentifier].adViewAdFormat;
+    if ( adFormat )
     {
-        return self.adViewAdFormats[adUnitIdentifier];
+        return adFormat;
     }
     else
     {
@@ -1985,18 +2745,210 @@ static ALUnityBackgroundCallback backgroundCallback;
     }
 }
 
-- (NSString *)requestLatencyMillisFromRequestLatency:(NSTimeInterval)requestLatency
+- (id)requestLatencyMillisFromRequestLatency:(NSTimeInterval)requestLatency
 {
     // Convert latency from seconds to milliseconds to match Android.
     long requestLatencyMillis = requestLatency * 1000;
-    return @(requestLatencyMillis).stringValue;
+    return max_unity_payload_number(@(requestLatencyMillis));
+}
+
+#pragma mark - Binary Event Encoding
+
+/**
+ * Encodes the event using the binary wire format and appends it to the frames waiting in @c binaryEventWriter. Returns @c NO if the event should be forwarded as JSON instead.
+ * Must only be called from @c eventPipelineQueue, which is serial, so a single writer buffer can be reused for every event.
+ */
+- (BOOL)appendBinaryUnityEventWithArgs:(NSDictionary<NSString *, id> *)args cachedAdInfo:(nullable MAUnityCachedAdInfo *)cachedAdInfo
+{
+    if ( !binaryEventEncodingEnabled || !binaryBackgroundCallback ) return NO;
+    
+    NSString *name = args[@"name"];
+    uint16_t eventIdentifier = max_unity_event_id_for_name(name.UTF8String);
+    if ( eventIdentifier == MAX_UNITY_EVENT_UNKNOWN ) return NO;
+    
+    uint8_t flags = [args[@"keepInBackground"] boolValue] ? MAX_UNITY_EVENT_FLAG_KEEP_IN_BACKGROUND : 0;
+    max_unity_event_begin_next(&binaryEventWriter, eventIdentifier, flags);
+    [self encodeFields: args intoWriter: &binaryEventWriter isTopLevel: YES];
+    if ( cachedAdInfo )
+    {
+        [self encodeFields: cachedAdInfo.adInfo intoWriter: &binaryEventWriter isTopLevel: YES];
+    }
+    
+    if ( !max_unity_event_end(&binaryEventWriter) )
+    {
+        MAX_UNITY_LOG_WARNING(@"Failed to encode %@ - falling back to JSON", name);
+        max_unity_event_discard(&binaryEventWriter);
+        return NO;
+    }
+    
+    return YES;
+}
+
+- (void)encodeFields:(NSDictionary<NSString *, id> *)dict intoWriter:(max_unity_event_writer *)writer isTopLevel:(BOOL)isTopLevel
+{
+    for ( NSString *key in dict )
+    {
+        // The top-level event name is already encoded as the event id
+        if ( isTopLevel && [@"name" isEqualToString: key] ) continue;
+        
+        max_unity_value_type type;
+        uint8_t fieldIdentifier = [MAUnityAdManager binaryFieldForKey: key type: &type];
+        if ( fieldIdentifier == MAX_UNITY_FIELD_NONE ) continue;
+        
+        [self encodeValue: dict[key] field: fieldIdentifier type: type intoWriter: writer];
+    }
+}
+
+- (void)encodeValue:(id)value field:(uint8_t)fieldIdentifier type:(max_unity_value_type)type intoWriter:(max_unity_event_writer *)writer
+{
+    switch ( type )
+    {
+        case MAX_UNITY_VALUE_STRING:
+        {
+            NSString *string = [value isKindOfClass: [NSString class]] ? value : [value description];
+            const char *utf8String = string.UTF8String;
+            max_unity_event_write_string(writer, fieldIdentifier, utf8String, utf8String ? strlen(utf8String) : 0);
+            break;
+        }
+        case MAX_UNITY_VALUE_DOUBLE:
+        {
+            if ( [value respondsToSelector: @selector(doubleValue)] )
+            {
+                max_unity_event_write_double(writer, fieldIdentifier, [value doubleValue]);
+            }
+            break;
+        }
+        case MAX_UNITY_VALUE_INT64:
+        {
+            if ( [value respondsToSelector: @selector(longLongValue)] )
+            {
+                max_unity_event_write_int64(writer, fieldIdentifier, [value longLongValue]);
+            }
+            break;
+        }
+        case MAX_UNITY_VALUE_BOOL:
+        {
+            if ( [value respondsToSelector: @selector(boolValue)] )
+            {
+                max_unity_event_write_bool(writer, fieldIdentifier, [value boolValue]);
+            }
+            break;
+        }
+        case MAX_UNITY_VALUE_OBJECT:
+        {
+            if ( ![value isKindOfClass: [NSDictionary class]] ) break;
+            
+            size_t marker = max_unity_event_begin_container(writer, fieldIdentifier, MAX_UNITY_VALUE_OBJECT);
+            [self encodeFields: value intoWriter: writer isTopLevel: NO];
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        case MAX_UNITY_VALUE_LIST:
+        {
+            if ( ![value isKindOfClass: [NSArray class]] ) break;
+            
+            size_t marker = max_unity_event_begin_container(writer, fieldIdentifier, MAX_UNITY_VALUE_LIST);
+            for ( id item in (NSArray *) value )
+            {
+                [self encodeValue: item field: MAX_UNITY_FIELD_NONE type: MAX_UNITY_VALUE_OBJECT intoWriter: writer];
+            }
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        case MAX_UNITY_VALUE_MAP:
+        {
+            if ( ![value isKindOfClass: [NSDictionary class]] ) break;
+            
+            size_t marker = max_unity_event_begin_container(writer, fieldIdentifier, MAX_UNITY_VALUE_MAP);
+            NSDictionary<NSString *, id> *map = value;
+            for ( NSString *key in map )
+            {
+                [self encodeValue: key field: MAX_UNITY_FIELD_NONE type: MAX_UNITY_VALUE_STRING intoWriter: writer];
+                [self encodeDynamicValue: map[key] intoWriter: writer];
+            }
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+- (void)encodeDynamicValue:(id)value intoWriter:(max_unity_event_writer *)writer
+{
+    if ( [value isKindOfClass: [NSNumber class]] )
+    {
+        NSNumber *number = value;
+        if ( CFGetTypeID((__bridge CFTypeRef) number) == CFBooleanGetTypeID() )
+        {
+            max_unity_event_write_bool(writer, MAX_UNITY_FIELD_NONE, number.boolValue);
+        }
+        else if ( CFNumberIsFloatType((__bridge CFNumberRef) number) )
+        {
+            max_unity_event_write_double(writer, MAX_UNITY_FIELD_NONE, number.doubleValue);
+        }
+        else
+        {
+            max_unity_event_write_int64(writer, MAX_UNITY_FIELD_NONE, number.longLongValue);
+        }
+    }
+    else if ( [value isKindOfClass: [NSDictionary class]] )
+    {
+        // Nested maps and lists are written as containers, so they decode to the same dictionaries and lists as the JSON payload
+        [self encodeValue: value field: MAX_UNITY_FIELD_NONE type: MAX_UNITY_VALUE_MAP intoWriter: writer];
+    }
+    else if ( [value isKindOfClass: [NSArray class]] )
+    {
+        size_t marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_LIST);
+        for ( id item in (NSArray *) value )
+        {
+            [self encodeDynamicValue: item intoWriter: writer];
+        }
+        max_unity_event_end_container(writer, marker);
+    }
+    else
+    {
+        // Map entries must always come in key/value pairs, so anything else is written as its string representation
+        NSString *string = [value isKindOfClass: [NSNull class]] ? @"" : value;
+        [self encodeValue: string field: MAX_UNITY_FIELD_NONE type: MAX_UNITY_VALUE_STRING intoWriter: writer];
+    }
+}
+
++ (uint8_t)binaryFieldForKey:(NSString *)key type:(max_unity_value_type *)type
+{
+    // Cache the codec's key lookup so each payload key costs a single hash lookup
+    static NSDictionary<NSString *, NSNumber *> *fieldsByKey;
+    static dispatch_once_t token;
+    dispatch_once(&token, ^{
+        NSMutableDictionary<NSString *, NSNumber *> *fields = [NSMutableDictionary dictionaryWithCapacity: MAX_UNITY_FIELD_COUNT];
+        for ( uint8_t fieldIdentifier = 1; fieldIdentifier < MAX_UNITY_FIELD_COUNT; fieldIdentifier++ )
+        {
+            const char *fieldKey = max_unity_event_key_for_field(fieldIdentifier);
+            if ( !fieldKey ) continue;
+            
+            max_unity_value_type fieldType;
+            max_unity_event_field_for_key(fieldKey, &fieldType);
+            fields[@(fieldKey)] = @((fieldType << 8) | fieldIdentifier);
+        }
+        fieldsByKey = fields;
+    });
+    
+    NSNumber *field = fieldsByKey[key];
+    if ( !field )
+    {
+        *type = MAX_UNITY_VALUE_NONE;
+        return MAX_UNITY_FIELD_NONE;
+    }
+    
+    *type = (max_unity_value_type) (field.unsignedIntValue >> 8);
+    return (uint8_t) (field.unsignedIntValue & 0xFF);
 }
 
 #pragma mark - User Service
 
 - (void)didDismissUserConsentDialog
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    max_unity_dispatch_delegate_event(self.eventPipelineQueue, ^{
         [self forwardUnityEventWithArgs: @{@"name" : @"OnSdkConsentDialogDismissedEvent"}];
     });
 }
@@ -2007,7 +2959,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 {
     [self.sdk.cmpService showCMPForExistingUserWithCompletion:^(ALCMPError * _Nullable error) {
         
-        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        dispatch_async(self.eventPipelineQueue, ^{
             NSMutableDictionary<NSString *, id> *args = [NSMutableDictionary dictionaryWithCapacity: 2];
             args[@"name"] = @"OnCmpCompletedEvent";
             
@@ -2039,7 +2991,7 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (void)notifyApplicationStateChangedEventForPauseState:(BOOL)isPaused
 {
-    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    dispatch_async(self.eventPipelineQueue, ^{
         [self forwardUnityEventWithArgs: @{@"name": @"OnApplicationStateChanged",
                                            @"isPaused": @(isPaused)}];
     });
@@ -2047,17 +2999,118 @@ static ALUnityBackgroundCallback backgroundCallback;
 
 - (MAAd *)adWithAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    @synchronized ( self.adInfoDictLock )
+    return self.adInfoDict[adUnitIdentifier];
+}
+
+/**
+ * Must only be called from @c eventPipelineQueue, which is the only writer of @c adInfoDict.
+ */
+- (void)setAd:(nullable MAAd *)ad forAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    NSMutableDictionary<NSString *, MAAd *> *adInfoDict = [self.adInfoDict mutableCopy];
+    adInfoDict[adUnitIdentifier] = ad;
+    self.adInfoDict = adInfoDict;
+}
+
+#pragma mark - Ad Unit State
+
+- (nullable MAUnityAdUnitState *)existingAdUnitStateForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+{
+    if ( !adUnitIdentifier ) return nil;
+    
+    @synchronized ( self.adUnitStatesLock )
+    {
+        return self.adUnitStates[adUnitIdentifier];
+    }
+}
+
+/**
+ * Returns the record for the ad unit, creating it if needed.
+ */
+- (nullable MAUnityAdUnitState *)adUnitStateForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+{
+    if ( !adUnitIdentifier ) return nil;
+    
+    @synchronized ( self.adUnitStatesLock )
+    {
+        MAUnityAdUnitState *state = self.adUnitStates[adUnitIdentifier];
+        if ( !state )
+        {
+            state = [[MAUnityAdUnitState alloc] initWithAdUnitIdentifier: adUnitIdentifier];
+            self.adUnitStates[adUnitIdentifier] = state;
+        }
+        
+        return state;
+    }
+}
+
+- (void)removeAdUnitStateForAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+{
+    if ( !adUnitIdentifier ) return;
+    
+    @synchronized ( self.adUnitStatesLock )
     {
-        return self.adInfoDict[adUnitIdentifier];
+        [self.adUnitStates removeObjectForKey: adUnitIdentifier];
     }
 }
 
+- (int)registerAdUnitIdentifier:(nullable NSString *)adUnitIdentifier
+{
+    if ( ![adUnitIdentifier al_isValidString] ) return 0;
+    
+    @synchronized ( self.adUnitStatesLock )
+    {
+        NSNumber *handle = self.adUnitHandles[adUnitIdentifier];
+        if ( handle ) return handle.intValue;
+        
+        // Handles are never reused, so a stale handle cannot end up pointing at a different ad unit
+        [self.adUnitIdentifiersByHandle addObject: adUnitIdentifier];
+        int newHandle = (int) self.adUnitIdentifiersByHandle.count;
+        self.adUnitHandles[adUnitIdentifier] = @(newHandle);
+        
+        return newHandle;
+    }
+}
+
+- (nullable NSString *)adUnitIdentifierForHandle:(int)handle
+{
+    @synchronized ( self.adUnitStatesLock )
+    {
+        if ( handle <= 0 || handle > self.adUnitIdentifiersByHandle.count ) return nil;
+        
+        return self.adUnitIdentifiersByHandle[handle - 1];
+    }
+}
+
+- (NSArray<MAUnityAdUnitState *> *)allAdUnitStates
+{
+    @synchronized ( self.adUnitStatesLock )
+    {
+        return self.adUnitStates.allValues;
+    }
+}
+
+- (NSString *)adUnitStateDebugDump
+{
+    NSArray<MAUnityAdUnitState *> *states = [self allAdUnitStates];
+    NSMutableArray<NSDictionary<NSString *, id> *> *adUnits = [NSMutableArray arrayWithCapacity: states.count];
+    size_t totalAllocatedSize = malloc_size((__bridge const void *) self.adUnitStates);
+    
+    for ( MAUnityAdUnitState *state in states )
+    {
+        [adUnits addObject: [state debugInfo]];
+        totalAllocatedSize += [state allocatedSize];
+    }
+    
+    return [MAUnityAdManager serializeParameters: @{@"adUnits" : adUnits,
+                                                    @"totalAllocatedBytes" : @(totalAllocatedSize)}];
+}
+
 #pragma mark - Helper
 
-- (BOOL)shouldIgnoreSafeAreaForAdUnitIdentifier:(NSString *)adUnitIdentifier
+- (BOOL)shouldIgnoreSafeAreaForAdUnitState:(MAUnityAdUnitState *)state
 {
-    if ( ![self.ignoreSafeAreaLandscapeAdUnitIdentifiers containsObject: adUnitIdentifier] ) return NO;
+    if ( !state.ignoresSafeAreaLandscape ) return NO;
     
     // We should use the superview instead of layout guide if the application's orientation is landscape and the extra parameter is set
     UIInterfaceOrientation orientation = [UIApplication sharedApplication].statusBarOrientation;
@@ -0,0 +1,169 @@
+//
+//  MAUnityAdViewLayout.c
+//  AppLovin MAX Unity Plugin
+//
+
+#include "MAUnityAdViewLayout.h"
+
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    max_unity_ad_view_position position;
+} max_unity_ad_view_position_name;
+
+static const max_unity_ad_view_position_name max_unity_ad_view_position_names[] = {
+    {"top_left", MAX_UNITY_AD_VIEW_POSITION_TOP_LEFT},
+    {"top_center", MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER},
+    {"top_right", MAX_UNITY_AD_VIEW_POSITION_TOP_RIGHT},
+    {"centered", MAX_UNITY_AD_VIEW_POSITION_CENTERED},
+    {"center_left", MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT},
+    {"center_right", MAX_UNITY_AD_VIEW_POSITION_CENTER_RIGHT},
+    {"bottom_left", MAX_UNITY_AD_VIEW_POSITION_BOTTOM_LEFT},
+    {"bottom_center", MAX_UNITY_AD_VIEW_POSITION_BOTTOM_CENTER},
+    {"bottom_right", MAX_UNITY_AD_VIEW_POSITION_BOTTOM_RIGHT}
+};
+
+max_unity_ad_view_position max_unity_ad_view_position_from_string(const char *position)
+{
+    if ( !position ) return MAX_UNITY_AD_VIEW_POSITION_NONE;
+
+    for ( size_t i = 0; i < sizeof(max_unity_ad_view_position_names) / sizeof(max_unity_ad_view_position_names[0]); i++ )
+    {
+        if ( strcmp(position, max_unity_ad_view_position_names[i].name) == 0 )
+        {
+            return max_unity_ad_view_position_names[i].position;
+        }
+    }
+
+    return MAX_UNITY_AD_VIEW_POSITION_NONE;
+}
+
+max_unity_ad_view_geometry max_unity_ad_view_compute_geometry(const max_unity_ad_view_layout_input *input)
+{
+    max_unity_ad_view_geometry geometry;
+    memset(&geometry, 0, sizeof(geometry));
+    geometry.position = input->position;
+
+    bool is_horizontally_centered = input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER || input->position == MAX_UNITY_AD_VIEW_POSITION_BOTTOM_CENTER;
+    bool is_vertical = input->position == MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT || input->position == MAX_UNITY_AD_VIEW_POSITION_CENTER_RIGHT;
+
+    //
+    // Determine ad width
+    //
+
+    // Check if publisher has overridden width as points
+    if ( input->has_width_override )
+    {
+        geometry.width = input->width_override;
+    }
+    // Top center / bottom center stretches full screen
+    else if ( is_horizontally_centered )
+    {
+        geometry.width = input->window_width;
+    }
+    // Else use standard widths of 320, 728, or 300
+    else
+    {
+        geometry.width = input->format_width;
+    }
+
+    //
+    // Determine ad height
+    //
+    if ( input->supports_adaptive_height && !input->is_adaptive_banner_disabled && input->adaptive_height_for_width )
+    {
+        geometry.height = input->adaptive_height_for_width(geometry.width, input->adaptive_height_context);
+    }
+    else
+    {
+        geometry.height = input->format_height;
+    }
+
+    if ( is_horizontally_centered )
+    {
+        geometry.uses_superview_top = input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER && input->ignores_safe_area;
+
+        // Non AdMob banners will still be of 50/90 points tall. Pin the inner ad view to the bottom or top according to the ad view position.
+        if ( !input->is_adaptive_banner_disabled )
+        {
+            geometry.autoresizing = input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER ? MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_BOTTOM_MARGIN : MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_TOP_MARGIN;
+        }
+
+        // If publisher actually provided a banner background color
+        if ( input->has_background_color && !input->is_mrec )
+        {
+            geometry.safe_area_background = input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER ? MAX_UNITY_SAFE_AREA_BACKGROUND_ABOVE : MAX_UNITY_SAFE_AREA_BACKGROUND_BELOW;
+
+            if ( !input->has_width_override )
+            {
+                geometry.spans_superview_width = true;
+                geometry.width = 0;
+            }
+        }
+    }
+    else if ( is_vertical )
+    {
+        if ( input->is_mrec )
+        {
+            geometry.safe_area_background = input->position == MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT ? MAX_UNITY_SAFE_AREA_BACKGROUND_LEFT : MAX_UNITY_SAFE_AREA_BACKGROUND_RIGHT;
+        }
+        else
+        {
+            geometry.is_rotated = true;
+
+            // With a background color, span the screen height so the banner spans the screen once rotated
+            if ( input->has_background_color && !input->has_width_override )
+            {
+                geometry.width = input->window_height;
+            }
+
+            // Place the center of the banner half its height away from the side, so the whole banner is visible once rotated
+            if ( input->position == MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT )
+            {
+                geometry.center_x_offset = geometry.height / 2.0;
+                geometry.center_x_uses_safe_area = input->orientation == MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_RIGHT;
+            }
+            else
+            {
+                geometry.center_x_offset = -geometry.height / 2.0;
+                geometry.center_x_uses_safe_area = input->orientation == MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_LEFT;
+            }
+
+            // If adaptive - make top flexible since we anchor with the bottom of the banner at the edge of the screen
+            if ( !input->is_adaptive_banner_disabled )
+            {
+                geometry.autoresizing = MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_TOP_MARGIN;
+            }
+        }
+    }
+    else if ( input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_LEFT )
+    {
+        geometry.offset_x = input->offset_x;
+        geometry.offset_y = input->offset_y;
+        geometry.uses_superview_top = input->ignores_safe_area;
+    }
+    else if ( input->position == MAX_UNITY_AD_VIEW_POSITION_TOP_RIGHT )
+    {
+        geometry.uses_superview_top = input->ignores_safe_area;
+    }
+
+    return geometry;
+}
+
+bool max_unity_ad_view_geometry_equals(const max_unity_ad_view_geometry *lhs, const max_unity_ad_view_geometry *rhs)
+{
+    return lhs->position == rhs->position
+        && lhs->width == rhs->width
+        && lhs->height == rhs->height
+        && lhs->offset_x == rhs->offset_x
+        && lhs->offset_y == rhs->offset_y
+        && lhs->spans_superview_width == rhs->spans_superview_width
+        && lhs->uses_superview_top == rhs->uses_superview_top
+        && lhs->is_rotated == rhs->is_rotated
+        && lhs->center_x_offset == rhs->center_x_offset
+        && lhs->center_x_uses_safe_area == rhs->center_x_uses_safe_area
+        && lhs->safe_area_background == rhs->safe_area_background
+        && lhs->autoresizing == rhs->autoresizing;
+}
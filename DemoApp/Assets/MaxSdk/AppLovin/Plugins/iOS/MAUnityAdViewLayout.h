@@ -0,0 +1,118 @@
+//
+//  MAUnityAdViewLayout.h
+//  AppLovin MAX Unity Plugin
+//
+//  Computes where an ad view should be placed from its configuration, without touching UIKit. Written in plain C so it can be built and exercised off-device.
+//
+//  The resulting geometry is normalized: fields that do not affect the layout for a given position are zeroed, so two geometries compare equal
+//  exactly when they would produce the same set of constraints.
+//
+
+#ifndef MAUnityAdViewLayout_h
+#define MAUnityAdViewLayout_h
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    MAX_UNITY_AD_VIEW_POSITION_NONE = 0, // Only the size is constrained. Publishers position the view themselves.
+    MAX_UNITY_AD_VIEW_POSITION_TOP_LEFT,
+    MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER,
+    MAX_UNITY_AD_VIEW_POSITION_TOP_RIGHT,
+    MAX_UNITY_AD_VIEW_POSITION_CENTERED,
+    MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT,
+    MAX_UNITY_AD_VIEW_POSITION_CENTER_RIGHT,
+    MAX_UNITY_AD_VIEW_POSITION_BOTTOM_LEFT,
+    MAX_UNITY_AD_VIEW_POSITION_BOTTOM_CENTER,
+    MAX_UNITY_AD_VIEW_POSITION_BOTTOM_RIGHT
+} max_unity_ad_view_position;
+
+typedef enum
+{
+    MAX_UNITY_INTERFACE_ORIENTATION_OTHER = 0,
+    MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_LEFT,
+    MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_RIGHT
+} max_unity_interface_orientation;
+
+// Where the shared safe area background is pinned relative to the ad view
+typedef enum
+{
+    MAX_UNITY_SAFE_AREA_BACKGROUND_NONE = 0, // Hidden
+    MAX_UNITY_SAFE_AREA_BACKGROUND_ABOVE,    // Between the top of the superview and the top of the ad view
+    MAX_UNITY_SAFE_AREA_BACKGROUND_BELOW,    // Between the bottom of the ad view and the bottom of the superview
+    MAX_UNITY_SAFE_AREA_BACKGROUND_LEFT,     // Between the left of the superview and the left of the safe area
+    MAX_UNITY_SAFE_AREA_BACKGROUND_RIGHT     // Between the right of the safe area and the right of the superview
+} max_unity_safe_area_background;
+
+typedef enum
+{
+    MAX_UNITY_AUTORESIZING_UNCHANGED = 0,
+    MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_TOP_MARGIN,
+    MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_BOTTOM_MARGIN
+} max_unity_autoresizing;
+
+typedef double (*max_unity_adaptive_height_function)(double width, void *context);
+
+typedef struct
+{
+    max_unity_ad_view_position position;
+    double offset_x;
+    double offset_y;
+
+    double format_width;
+    double format_height;
+    bool is_mrec;
+    bool supports_adaptive_height; // Banners and leaders
+    bool is_adaptive_banner_disabled;
+
+    bool has_width_override;
+    double width_override;
+
+    double window_width;
+    double window_height;
+    bool has_background_color;
+    bool ignores_safe_area;
+    max_unity_interface_orientation orientation;
+
+    // Only called when the ad view uses an adaptive height
+    max_unity_adaptive_height_function adaptive_height_for_width;
+    void *adaptive_height_context;
+} max_unity_ad_view_layout_input;
+
+typedef struct
+{
+    max_unity_ad_view_position position;
+    double width;                  // Zero when `spans_superview_width` is set
+    double height;
+    double offset_x;               // Only used by the top left position
+    double offset_y;
+    bool spans_superview_width;    // Pinned to the left and right of the superview instead of having a fixed width
+    bool uses_superview_top;       // Pinned to the top of the superview instead of the top of the safe area
+    bool is_rotated;               // Vertical banner rotated by 90 degrees
+    double center_x_offset;        // Only used by rotated ad views
+    bool center_x_uses_safe_area;  // Only used by rotated ad views
+    max_unity_safe_area_background safe_area_background;
+    max_unity_autoresizing autoresizing;
+} max_unity_ad_view_geometry;
+
+/**
+ * Maps a position name sent from Unity, e.g. "top_center", to a position. Unknown or NULL names map to MAX_UNITY_AD_VIEW_POSITION_NONE.
+ */
+max_unity_ad_view_position max_unity_ad_view_position_from_string(const char *position);
+
+/**
+ * Computes the geometry of an ad view. Has no side effects other than calling `input->adaptive_height_for_width`.
+ */
+max_unity_ad_view_geometry max_unity_ad_view_compute_geometry(const max_unity_ad_view_layout_input *input);
+
+bool max_unity_ad_view_geometry_equals(const max_unity_ad_view_geometry *lhs, const max_unity_ad_view_geometry *rhs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAUnityAdViewLayout_h */
@@ -0,0 +1,462 @@
+//
+//  MAUnityEventCodec.c
+//  AppLovin MAX Unity Plugin
+//
+
+#include "MAUnityEventCodec.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *key;
+    uint8_t field_id;
+    max_unity_value_type type;
+} max_unity_field_descriptor;
+
+// Indexed by `max_unity_event_id`
+static const char *const max_unity_event_names[MAX_UNITY_EVENT_COUNT] = {
+    NULL,
+
+    "OnBannerAdLoadedEvent",
+    "OnBannerAdLoadFailedEvent",
+    "OnBannerAdClickedEvent",
+    "OnBannerAdRevenuePaidEvent",
+    "OnBannerAdReviewCreativeIdGeneratedEvent",
+    "OnBannerAdExpandedEvent",
+    "OnBannerAdCollapsedEvent",
+
+    "OnMRecAdLoadedEvent",
+    "OnMRecAdLoadFailedEvent",
+    "OnMRecAdClickedEvent",
+    "OnMRecAdRevenuePaidEvent",
+    "OnMRecAdReviewCreativeIdGeneratedEvent",
+    "OnMRecAdExpandedEvent",
+    "OnMRecAdCollapsedEvent",
+
+    "OnInterstitialLoadedEvent",
+    "OnInterstitialLoadFailedEvent",
+    "OnInterstitialHiddenEvent",
+    "OnInterstitialDisplayedEvent",
+    "OnInterstitialAdFailedToDisplayEvent",
+    "OnInterstitialClickedEvent",
+    "OnInterstitialAdRevenuePaidEvent",
+    "OnInterstitialAdReviewCreativeIdGeneratedEvent",
+
+    "OnAppOpenAdLoadedEvent",
+    "OnAppOpenAdLoadFailedEvent",
+    "OnAppOpenAdHiddenEvent",
+    "OnAppOpenAdDisplayedEvent",
+    "OnAppOpenAdFailedToDisplayEvent",
+    "OnAppOpenAdClickedEvent",
+    "OnAppOpenAdRevenuePaidEvent",
+
+    "OnRewardedAdLoadedEvent",
+    "OnRewardedAdLoadFailedEvent",
+    "OnRewardedAdDisplayedEvent",
+    "OnRewardedAdHiddenEvent",
+    "OnRewardedAdClickedEvent",
+    "OnRewardedAdRevenuePaidEvent",
+    "OnRewardedAdReviewCreativeIdGeneratedEvent",
+    "OnRewardedAdFailedToDisplayEvent",
+    "OnRewardedAdReceivedRewardEvent",
+
+    "OnExpiredInterstitialAdReloadedEvent",
+    "OnExpiredAppOpenAdReloadedEvent",
+    "OnExpiredRewardedAdReloadedEvent",
+
+    "OnBannerAdLayoutChangedEvent",
+    "OnMRecAdLayoutChangedEvent"
+};
+
+static const max_unity_field_descriptor max_unity_field_descriptors[] = {
+    {"adUnitId", MAX_UNITY_FIELD_AD_UNIT_ID, MAX_UNITY_VALUE_STRING},
+    {"adFormat", MAX_UNITY_FIELD_AD_FORMAT, MAX_UNITY_VALUE_STRING},
+    {"networkName", MAX_UNITY_FIELD_NETWORK_NAME, MAX_UNITY_VALUE_STRING},
+    {"networkPlacement", MAX_UNITY_FIELD_NETWORK_PLACEMENT, MAX_UNITY_VALUE_STRING},
+    {"creativeId", MAX_UNITY_FIELD_CREATIVE_ID, MAX_UNITY_VALUE_STRING},
+    {"placement", MAX_UNITY_FIELD_PLACEMENT, MAX_UNITY_VALUE_STRING},
+    {"revenue", MAX_UNITY_FIELD_REVENUE, MAX_UNITY_VALUE_DOUBLE},
+    {"revenuePrecision", MAX_UNITY_FIELD_REVENUE_PRECISION, MAX_UNITY_VALUE_STRING},
+    {"waterfallInfo", MAX_UNITY_FIELD_WATERFALL_INFO, MAX_UNITY_VALUE_OBJECT},
+    {"latencyMillis", MAX_UNITY_FIELD_LATENCY_MILLIS, MAX_UNITY_VALUE_INT64},
+    {"dspName", MAX_UNITY_FIELD_DSP_NAME, MAX_UNITY_VALUE_STRING},
+
+    {"errorCode", MAX_UNITY_FIELD_ERROR_CODE, MAX_UNITY_VALUE_INT64},
+    {"errorMessage", MAX_UNITY_FIELD_ERROR_MESSAGE, MAX_UNITY_VALUE_STRING},
+    {"mediatedNetworkErrorCode", MAX_UNITY_FIELD_MEDIATED_NETWORK_ERROR_CODE, MAX_UNITY_VALUE_INT64},
+    {"mediatedNetworkErrorMessage", MAX_UNITY_FIELD_MEDIATED_NETWORK_ERROR_MESSAGE, MAX_UNITY_VALUE_STRING},
+    {"adLoadFailureInfo", MAX_UNITY_FIELD_AD_LOAD_FAILURE_INFO, MAX_UNITY_VALUE_STRING},
+
+    {"rewardLabel", MAX_UNITY_FIELD_REWARD_LABEL, MAX_UNITY_VALUE_STRING},
+    {"rewardAmount", MAX_UNITY_FIELD_REWARD_AMOUNT, MAX_UNITY_VALUE_INT64},
+    {"adReviewCreativeId", MAX_UNITY_FIELD_AD_REVIEW_CREATIVE_ID, MAX_UNITY_VALUE_STRING},
+    {"expiredAdInfo", MAX_UNITY_FIELD_EXPIRED_AD_INFO, MAX_UNITY_VALUE_OBJECT},
+    {"newAdInfo", MAX_UNITY_FIELD_NEW_AD_INFO, MAX_UNITY_VALUE_OBJECT},
+
+    {"name", MAX_UNITY_FIELD_NAME, MAX_UNITY_VALUE_STRING},
+    {"testName", MAX_UNITY_FIELD_TEST_NAME, MAX_UNITY_VALUE_STRING},
+    {"networkResponses", MAX_UNITY_FIELD_NETWORK_RESPONSES, MAX_UNITY_VALUE_LIST},
+    {"adLoadState", MAX_UNITY_FIELD_AD_LOAD_STATE, MAX_UNITY_VALUE_INT64},
+    {"mediatedNetwork", MAX_UNITY_FIELD_MEDIATED_NETWORK, MAX_UNITY_VALUE_OBJECT},
+    {"credentials", MAX_UNITY_FIELD_CREDENTIALS, MAX_UNITY_VALUE_MAP},
+    {"isBidding", MAX_UNITY_FIELD_IS_BIDDING, MAX_UNITY_VALUE_BOOL},
+    {"error", MAX_UNITY_FIELD_ERROR, MAX_UNITY_VALUE_OBJECT},
+    {"adapterClassName", MAX_UNITY_FIELD_ADAPTER_CLASS_NAME, MAX_UNITY_VALUE_STRING},
+    {"adapterVersion", MAX_UNITY_FIELD_ADAPTER_VERSION, MAX_UNITY_VALUE_STRING},
+    {"sdkVersion", MAX_UNITY_FIELD_SDK_VERSION, MAX_UNITY_VALUE_STRING},
+    {"initializationStatus", MAX_UNITY_FIELD_INITIALIZATION_STATUS, MAX_UNITY_VALUE_INT64},
+
+    {"origin_x", MAX_UNITY_FIELD_ORIGIN_X, MAX_UNITY_VALUE_DOUBLE},
+    {"origin_y", MAX_UNITY_FIELD_ORIGIN_Y, MAX_UNITY_VALUE_DOUBLE},
+    {"width", MAX_UNITY_FIELD_WIDTH, MAX_UNITY_VALUE_DOUBLE},
+    {"height", MAX_UNITY_FIELD_HEIGHT, MAX_UNITY_VALUE_DOUBLE}
+};
+
+static const size_t max_unity_field_descriptor_count = sizeof(max_unity_field_descriptors) / sizeof(max_unity_field_descriptors[0]);
+
+// MARK: - Writer
+
+static bool max_unity_event_writer_reserve(max_unity_event_writer *writer, size_t additional)
+{
+    if ( writer->failed ) return false;
+
+    size_t required = writer->length + additional;
+    if ( required <= writer->capacity ) return true;
+
+    size_t capacity = writer->capacity > 0 ? writer->capacity : 256;
+    while ( capacity < required )
+    {
+        capacity *= 2;
+    }
+
+    uint8_t *bytes = (uint8_t *) realloc(writer->bytes, capacity);
+    if ( !bytes )
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    writer->bytes = bytes;
+    writer->capacity = capacity;
+    return true;
+}
+
+static void max_unity_event_put_u32_at(uint8_t *destination, uint32_t value)
+{
+    destination[0] = (uint8_t) (value & 0xFF);
+    destination[1] = (uint8_t) ((value >> 8) & 0xFF);
+    destination[2] = (uint8_t) ((value >> 16) & 0xFF);
+    destination[3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+static void max_unity_event_put_u64_at(uint8_t *destination, uint64_t value)
+{
+    for ( int i = 0; i < 8; i++ )
+    {
+        destination[i] = (uint8_t) ((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static bool max_unity_event_write_field_header(max_unity_event_writer *writer, uint8_t field_id, max_unity_value_type type, size_t value_size)
+{
+    if ( !max_unity_event_writer_reserve(writer, 2 + value_size) ) return false;
+
+    writer->bytes[writer->length++] = field_id;
+    writer->bytes[writer->length++] = (uint8_t) type;
+    return true;
+}
+
+void max_unity_event_writer_init(max_unity_event_writer *writer, size_t initial_capacity)
+{
+    writer->bytes = NULL;
+    writer->length = 0;
+    writer->capacity = 0;
+    writer->frame_start = 0;
+    writer->failed = false;
+
+    if ( initial_capacity > 0 )
+    {
+        max_unity_event_writer_reserve(writer, initial_capacity);
+    }
+}
+
+void max_unity_event_writer_free(max_unity_event_writer *writer)
+{
+    free(writer->bytes);
+    writer->bytes = NULL;
+    writer->length = 0;
+    writer->capacity = 0;
+    writer->frame_start = 0;
+    writer->failed = false;
+}
+
+void max_unity_event_begin(max_unity_event_writer *writer, uint16_t event_id, uint8_t flags)
+{
+    writer->length = 0;
+    max_unity_event_begin_next(writer, event_id, flags);
+}
+
+void max_unity_event_begin_next(max_unity_event_writer *writer, uint16_t event_id, uint8_t flags)
+{
+    writer->frame_start = writer->length;
+    writer->failed = false;
+
+    if ( !max_unity_event_writer_reserve(writer, MAX_UNITY_EVENT_HEADER_SIZE) ) return;
+
+    // Frame length is patched in `max_unity_event_end`
+    uint8_t *header = writer->bytes + writer->frame_start;
+    max_unity_event_put_u32_at(header, 0);
+    header[4] = MAX_UNITY_EVENT_CODEC_VERSION;
+    header[5] = flags;
+    header[6] = (uint8_t) (event_id & 0xFF);
+    header[7] = (uint8_t) ((event_id >> 8) & 0xFF);
+    writer->length += MAX_UNITY_EVENT_HEADER_SIZE;
+}
+
+void max_unity_event_discard(max_unity_event_writer *writer)
+{
+    writer->length = writer->frame_start;
+    writer->failed = false;
+}
+
+bool max_unity_event_end(max_unity_event_writer *writer)
+{
+    if ( writer->failed || writer->length < writer->frame_start + MAX_UNITY_EVENT_HEADER_SIZE ) return false;
+
+    size_t frame_length = writer->length - writer->frame_start;
+    if ( frame_length > UINT32_MAX ) return false;
+
+    max_unity_event_put_u32_at(writer->bytes + writer->frame_start, (uint32_t) frame_length);
+    return true;
+}
+
+void max_unity_event_write_string(max_unity_event_writer *writer, uint8_t field_id, const char *value, size_t length)
+{
+    if ( !value ) length = 0;
+    if ( length > UINT32_MAX )
+    {
+        writer->failed = true;
+        return;
+    }
+
+    if ( !max_unity_event_write_field_header(writer, field_id, MAX_UNITY_VALUE_STRING, 4 + length) ) return;
+
+    max_unity_event_put_u32_at(writer->bytes + writer->length, (uint32_t) length);
+    writer->length += 4;
+
+    if ( length > 0 )
+    {
+        memcpy(writer->bytes + writer->length, value, length);
+        writer->length += length;
+    }
+}
+
+void max_unity_event_write_double(max_unity_event_writer *writer, uint8_t field_id, double value)
+{
+    if ( !max_unity_event_write_field_header(writer, field_id, MAX_UNITY_VALUE_DOUBLE, 8) ) return;
+
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    max_unity_event_put_u64_at(writer->bytes + writer->length, bits);
+    writer->length += 8;
+}
+
+void max_unity_event_write_int64(max_unity_event_writer *writer, uint8_t field_id, int64_t value)
+{
+    if ( !max_unity_event_write_field_header(writer, field_id, MAX_UNITY_VALUE_INT64, 8) ) return;
+
+    max_unity_event_put_u64_at(writer->bytes + writer->length, (uint64_t) value);
+    writer->length += 8;
+}
+
+void max_unity_event_write_bool(max_unity_event_writer *writer, uint8_t field_id, bool value)
+{
+    if ( !max_unity_event_write_field_header(writer, field_id, MAX_UNITY_VALUE_BOOL, 1) ) return;
+
+    writer->bytes[writer->length++] = value ? 1 : 0;
+}
+
+size_t max_unity_event_begin_container(max_unity_event_writer *writer, uint8_t field_id, max_unity_value_type type)
+{
+    if ( !max_unity_event_write_field_header(writer, field_id, type, 4) ) return 0;
+
+    size_t marker = writer->length;
+    max_unity_event_put_u32_at(writer->bytes + marker, 0);
+    writer->length += 4;
+
+    return marker;
+}
+
+void max_unity_event_end_container(max_unity_event_writer *writer, size_t marker)
+{
+    if ( writer->failed || marker == 0 ) return;
+
+    size_t contents_length = writer->length - marker - 4;
+    if ( contents_length > UINT32_MAX )
+    {
+        writer->failed = true;
+        return;
+    }
+
+    max_unity_event_put_u32_at(writer->bytes + marker, (uint32_t) contents_length);
+}
+
+// MARK: - Reader
+
+static uint32_t max_unity_event_get_u32_at(const uint8_t *source)
+{
+    return (uint32_t) source[0] | ((uint32_t) source[1] << 8) | ((uint32_t) source[2] << 16) | ((uint32_t) source[3] << 24);
+}
+
+static uint64_t max_unity_event_get_u64_at(const uint8_t *source)
+{
+    uint64_t value = 0;
+    for ( int i = 0; i < 8; i++ )
+    {
+        value |= (uint64_t) source[i] << (8 * i);
+    }
+
+    return value;
+}
+
+bool max_unity_event_reader_open(max_unity_event_reader *reader, const uint8_t *bytes, size_t length, uint16_t *event_id, uint8_t *flags)
+{
+    if ( !bytes || length < MAX_UNITY_EVENT_HEADER_SIZE ) return false;
+
+    uint32_t frame_length = max_unity_event_get_u32_at(bytes);
+    if ( frame_length < MAX_UNITY_EVENT_HEADER_SIZE || frame_length > length ) return false;
+    if ( bytes[4] != MAX_UNITY_EVENT_CODEC_VERSION ) return false;
+
+    if ( flags ) *flags = bytes[5];
+    if ( event_id ) *event_id = (uint16_t) (bytes[6] | (bytes[7] << 8));
+
+    reader->bytes = bytes;
+    reader->position = MAX_UNITY_EVENT_HEADER_SIZE;
+    reader->end = frame_length;
+    return true;
+}
+
+bool max_unity_event_reader_next(max_unity_event_reader *reader, max_unity_event_value *value)
+{
+    if ( reader->position + 2 > reader->end ) return false;
+
+    const uint8_t *bytes = reader->bytes;
+    size_t position = reader->position;
+
+    memset(value, 0, sizeof(*value));
+    value->field_id = bytes[position++];
+    value->type = (max_unity_value_type) bytes[position++];
+
+    switch ( value->type )
+    {
+        case MAX_UNITY_VALUE_STRING:
+        {
+            if ( position + 4 > reader->end ) return false;
+
+            uint32_t length = max_unity_event_get_u32_at(bytes + position);
+            position += 4;
+            if ( length > reader->end - position ) return false;
+
+            value->string_value = (const char *) (bytes + position);
+            value->string_length = length;
+            position += length;
+            break;
+        }
+        case MAX_UNITY_VALUE_DOUBLE:
+        {
+            if ( position + 8 > reader->end ) return false;
+
+            uint64_t bits = max_unity_event_get_u64_at(bytes + position);
+            memcpy(&value->double_value, &bits, sizeof(bits));
+            position += 8;
+            break;
+        }
+        case MAX_UNITY_VALUE_INT64:
+        {
+            if ( position + 8 > reader->end ) return false;
+
+            value->int64_value = (int64_t) max_unity_event_get_u64_at(bytes + position);
+            position += 8;
+            break;
+        }
+        case MAX_UNITY_VALUE_BOOL:
+        {
+            if ( position + 1 > reader->end ) return false;
+
+            value->bool_value = bytes[position++] != 0;
+            break;
+        }
+        case MAX_UNITY_VALUE_OBJECT:
+        case MAX_UNITY_VALUE_LIST:
+        case MAX_UNITY_VALUE_MAP:
+        {
+            if ( position + 4 > reader->end ) return false;
+
+            uint32_t length = max_unity_event_get_u32_at(bytes + position);
+            position += 4;
+            if ( length > reader->end - position ) return false;
+
+            value->container.bytes = bytes;
+            value->container.position = position;
+            value->container.end = position + length;
+            position += length;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    reader->position = position;
+    return true;
+}
+
+// MARK: - Lookup
+
+uint16_t max_unity_event_id_for_name(const char *name)
+{
+    if ( !name ) return MAX_UNITY_EVENT_UNKNOWN;
+
+    for ( uint16_t event_id = 1; event_id < MAX_UNITY_EVENT_COUNT; event_id++ )
+    {
+        if ( strcmp(max_unity_event_names[event_id], name) == 0 ) return event_id;
+    }
+
+    return MAX_UNITY_EVENT_UNKNOWN;
+}
+
+const char *max_unity_event_name_for_id(uint16_t event_id)
+{
+    if ( event_id == MAX_UNITY_EVENT_UNKNOWN || event_id >= MAX_UNITY_EVENT_COUNT ) return NULL;
+
+    return max_unity_event_names[event_id];
+}
+
+uint8_t max_unity_event_field_for_key(const char *key, max_unity_value_type *type)
+{
+    if ( key )
+    {
+        for ( size_t i = 0; i < max_unity_field_descriptor_count; i++ )
+        {
+            if ( strcmp(max_unity_field_descriptors[i].key, key) == 0 )
+            {
+                if ( type ) *type = max_unity_field_descriptors[i].type;
+                return max_unity_field_descriptors[i].field_id;
+            }
+        }
+    }
+
+    if ( type ) *type = MAX_UNITY_VALUE_NONE;
+    return MAX_UNITY_FIELD_NONE;
+}
+
+const char *max_unity_event_key_for_field(uint8_t field_id)
+{
+    for ( size_t i = 0; i < max_unity_field_descriptor_count; i++ )
+    {
+        if ( max_unity_field_descriptors[i].field_id == field_id ) return max_unity_field_descriptors[i].key;
+    }
+
+    return NULL;
+}
@@ -0,0 +1,274 @@
+//
+//  MAUnityEventCodec.h
+//  AppLovin MAX Unity Plugin
+//
+//  Compact binary encoding for ad events forwarded to Unity. Written in plain C so it can be built and exercised off-device.
+//
+//  Frame layout (all integers little-endian):
+//
+//    frame     := u32 frameLength | u8 version | u8 flags | u16 eventId | field*
+//    field     := u8 fieldId | u8 valueType | value
+//    value     := STRING u32 length, UTF-8 bytes
+//               | DOUBLE 8 bytes IEEE 754
+//               | INT64  8 bytes
+//               | BOOL   1 byte
+//               | OBJECT / LIST / MAP  u32 length, field*
+//
+//  LIST items and MAP entries use field id 0. A MAP holds alternating STRING keys and values, which may be LIST or MAP values themselves.
+//  Container lengths allow a reader to skip any field it does not care about without decoding it.
+//
+//  Several frames may be sent back to back in one buffer. The frame length is used to find the next frame.
+//
+
+#ifndef MAUnityEventCodec_h
+#define MAUnityEventCodec_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_UNITY_EVENT_CODEC_VERSION 1
+#define MAX_UNITY_EVENT_HEADER_SIZE 8
+
+#define MAX_UNITY_EVENT_FLAG_KEEP_IN_BACKGROUND 0x01
+
+// The version of the event payloads, JSON or binary, reported by Unity. Numeric values are stringified below `MAX_UNITY_EVENT_PAYLOAD_VERSION_TYPED_NUMBERS`.
+#define MAX_UNITY_EVENT_PAYLOAD_VERSION_STRING_NUMBERS 1
+#define MAX_UNITY_EVENT_PAYLOAD_VERSION_TYPED_NUMBERS 2
+
+// How much of an ad's waterfall is included in its events. Must be kept in sync with `MaxSdkBase.CallbackPayloadLevel`.
+#define MAX_UNITY_PAYLOAD_LEVEL_MINIMAL 0        // No waterfall
+#define MAX_UNITY_PAYLOAD_LEVEL_STANDARD 1       // The waterfall without network credentials, adapter details or load failure info
+#define MAX_UNITY_PAYLOAD_LEVEL_FULL_WATERFALL 2 // Everything
+#define MAX_UNITY_PAYLOAD_LEVEL_COUNT 3
+
+typedef enum
+{
+    MAX_UNITY_VALUE_NONE = 0,
+    MAX_UNITY_VALUE_STRING = 1,
+    MAX_UNITY_VALUE_DOUBLE = 2,
+    MAX_UNITY_VALUE_INT64 = 3,
+    MAX_UNITY_VALUE_BOOL = 4,
+    MAX_UNITY_VALUE_OBJECT = 5,
+    MAX_UNITY_VALUE_LIST = 6,
+    MAX_UNITY_VALUE_MAP = 7
+} max_unity_value_type;
+
+// NOTE: Must be kept in sync with `MaxEventCodec.EventNames` in MaxEventCodec.cs
+typedef enum
+{
+    MAX_UNITY_EVENT_UNKNOWN = 0,
+
+    MAX_UNITY_EVENT_BANNER_AD_LOADED,
+    MAX_UNITY_EVENT_BANNER_AD_LOAD_FAILED,
+    MAX_UNITY_EVENT_BANNER_AD_CLICKED,
+    MAX_UNITY_EVENT_BANNER_AD_REVENUE_PAID,
+    MAX_UNITY_EVENT_BANNER_AD_REVIEW_CREATIVE_ID_GENERATED,
+    MAX_UNITY_EVENT_BANNER_AD_EXPANDED,
+    MAX_UNITY_EVENT_BANNER_AD_COLLAPSED,
+
+    MAX_UNITY_EVENT_MREC_AD_LOADED,
+    MAX_UNITY_EVENT_MREC_AD_LOAD_FAILED,
+    MAX_UNITY_EVENT_MREC_AD_CLICKED,
+    MAX_UNITY_EVENT_MREC_AD_REVENUE_PAID,
+    MAX_UNITY_EVENT_MREC_AD_REVIEW_CREATIVE_ID_GENERATED,
+    MAX_UNITY_EVENT_MREC_AD_EXPANDED,
+    MAX_UNITY_EVENT_MREC_AD_COLLAPSED,
+
+    MAX_UNITY_EVENT_INTERSTITIAL_LOADED,
+    MAX_UNITY_EVENT_INTERSTITIAL_LOAD_FAILED,
+    MAX_UNITY_EVENT_INTERSTITIAL_HIDDEN,
+    MAX_UNITY_EVENT_INTERSTITIAL_DISPLAYED,
+    MAX_UNITY_EVENT_INTERSTITIAL_FAILED_TO_DISPLAY,
+    MAX_UNITY_EVENT_INTERSTITIAL_CLICKED,
+    MAX_UNITY_EVENT_INTERSTITIAL_REVENUE_PAID,
+    MAX_UNITY_EVENT_INTERSTITIAL_REVIEW_CREATIVE_ID_GENERATED,
+
+    MAX_UNITY_EVENT_APP_OPEN_AD_LOADED,
+    MAX_UNITY_EVENT_APP_OPEN_AD_LOAD_FAILED,
+    MAX_UNITY_EVENT_APP_OPEN_AD_HIDDEN,
+    MAX_UNITY_EVENT_APP_OPEN_AD_DISPLAYED,
+    MAX_UNITY_EVENT_APP_OPEN_AD_FAILED_TO_DISPLAY,
+    MAX_UNITY_EVENT_APP_OPEN_AD_CLICKED,
+    MAX_UNITY_EVENT_APP_OPEN_AD_REVENUE_PAID,
+
+    MAX_UNITY_EVENT_REWARDED_AD_LOADED,
+    MAX_UNITY_EVENT_REWARDED_AD_LOAD_FAILED,
+    MAX_UNITY_EVENT_REWARDED_AD_DISPLAYED,
+    MAX_UNITY_EVENT_REWARDED_AD_HIDDEN,
+    MAX_UNITY_EVENT_REWARDED_AD_CLICKED,
+    MAX_UNITY_EVENT_REWARDED_AD_REVENUE_PAID,
+    MAX_UNITY_EVENT_REWARDED_AD_REVIEW_CREATIVE_ID_GENERATED,
+    MAX_UNITY_EVENT_REWARDED_AD_FAILED_TO_DISPLAY,
+    MAX_UNITY_EVENT_REWARDED_AD_RECEIVED_REWARD,
+
+    MAX_UNITY_EVENT_EXPIRED_INTERSTITIAL_AD_RELOADED,
+    MAX_UNITY_EVENT_EXPIRED_APP_OPEN_AD_RELOADED,
+    MAX_UNITY_EVENT_EXPIRED_REWARDED_AD_RELOADED,
+
+    MAX_UNITY_EVENT_BANNER_AD_LAYOUT_CHANGED,
+    MAX_UNITY_EVENT_MREC_AD_LAYOUT_CHANGED,
+
+    MAX_UNITY_EVENT_COUNT
+} max_unity_event_id;
+
+// NOTE: Must be kept in sync with `MaxEventCodec.Field*` in MaxEventCodec.cs
+typedef enum
+{
+    MAX_UNITY_FIELD_NONE = 0,
+
+    // Ad info
+    MAX_UNITY_FIELD_AD_UNIT_ID = 1,
+    MAX_UNITY_FIELD_AD_FORMAT = 2,
+    MAX_UNITY_FIELD_NETWORK_NAME = 3,
+    MAX_UNITY_FIELD_NETWORK_PLACEMENT = 4,
+    MAX_UNITY_FIELD_CREATIVE_ID = 5,
+    MAX_UNITY_FIELD_PLACEMENT = 6,
+    MAX_UNITY_FIELD_REVENUE = 7,
+    MAX_UNITY_FIELD_REVENUE_PRECISION = 8,
+    MAX_UNITY_FIELD_WATERFALL_INFO = 9,
+    MAX_UNITY_FIELD_LATENCY_MILLIS = 10,
+    MAX_UNITY_FIELD_DSP_NAME = 11,
+
+    // Error info
+    MAX_UNITY_FIELD_ERROR_CODE = 12,
+    MAX_UNITY_FIELD_ERROR_MESSAGE = 13,
+    MAX_UNITY_FIELD_MEDIATED_NETWORK_ERROR_CODE = 14,
+    MAX_UNITY_FIELD_MEDIATED_NETWORK_ERROR_MESSAGE = 15,
+    MAX_UNITY_FIELD_AD_LOAD_FAILURE_INFO = 16,
+
+    // Event specific
+    MAX_UNITY_FIELD_REWARD_LABEL = 17,
+    MAX_UNITY_FIELD_REWARD_AMOUNT = 18,
+    MAX_UNITY_FIELD_AD_REVIEW_CREATIVE_ID = 19,
+    MAX_UNITY_FIELD_EXPIRED_AD_INFO = 20,
+    MAX_UNITY_FIELD_NEW_AD_INFO = 21,
+
+    // Waterfall info
+    MAX_UNITY_FIELD_NAME = 22,
+    MAX_UNITY_FIELD_TEST_NAME = 23,
+    MAX_UNITY_FIELD_NETWORK_RESPONSES = 24,
+    MAX_UNITY_FIELD_AD_LOAD_STATE = 25,
+    MAX_UNITY_FIELD_MEDIATED_NETWORK = 26,
+    MAX_UNITY_FIELD_CREDENTIALS = 27,
+    MAX_UNITY_FIELD_IS_BIDDING = 28,
+    MAX_UNITY_FIELD_ERROR = 29,
+    MAX_UNITY_FIELD_ADAPTER_CLASS_NAME = 30,
+    MAX_UNITY_FIELD_ADAPTER_VERSION = 31,
+    MAX_UNITY_FIELD_SDK_VERSION = 32,
+    MAX_UNITY_FIELD_INITIALIZATION_STATUS = 33,
+
+    // Ad view layout
+    MAX_UNITY_FIELD_ORIGIN_X = 34,
+    MAX_UNITY_FIELD_ORIGIN_Y = 35,
+    MAX_UNITY_FIELD_WIDTH = 36,
+    MAX_UNITY_FIELD_HEIGHT = 37,
+
+    MAX_UNITY_FIELD_COUNT
+} max_unity_field_id;
+
+// MARK: - Writer
+
+typedef struct
+{
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+    size_t frame_start;
+    bool failed;
+} max_unity_event_writer;
+
+/**
+ * Initializes the writer. The buffer is retained across `max_unity_event_begin` calls so a long-lived writer does not allocate in steady state.
+ */
+void max_unity_event_writer_init(max_unity_event_writer *writer, size_t initial_capacity);
+void max_unity_event_writer_free(max_unity_event_writer *writer);
+
+/**
+ * Starts a new frame, discarding any previously written bytes.
+ */
+void max_unity_event_begin(max_unity_event_writer *writer, uint16_t event_id, uint8_t flags);
+
+/**
+ * Starts a new frame after the frames already in the writer, so several events can be sent in one buffer.
+ */
+void max_unity_event_begin_next(max_unity_event_writer *writer, uint16_t event_id, uint8_t flags);
+
+/**
+ * Drops the frame being written, keeping any frames completed before it.
+ */
+void max_unity_event_discard(max_unity_event_writer *writer);
+
+/**
+ * Patches the frame length. Returns @c false if any write failed (e.g. out of memory) and the frame must not be sent.
+ */
+bool max_unity_event_end(max_unity_event_writer *writer);
+
+void max_unity_event_write_string(max_unity_event_writer *writer, uint8_t field_id, const char *value, size_t length);
+void max_unity_event_write_double(max_unity_event_writer *writer, uint8_t field_id, double value);
+void max_unity_event_write_int64(max_unity_event_writer *writer, uint8_t field_id, int64_t value);
+void max_unity_event_write_bool(max_unity_event_writer *writer, uint8_t field_id, bool value);
+
+/**
+ * Opens an OBJECT, LIST or MAP container and returns a marker to pass to `max_unity_event_end_container`.
+ */
+size_t max_unity_event_begin_container(max_unity_event_writer *writer, uint8_t field_id, max_unity_value_type type);
+void max_unity_event_end_container(max_unity_event_writer *writer, size_t marker);
+
+// MARK: - Reader
+
+typedef struct
+{
+    const uint8_t *bytes;
+    size_t position;
+    size_t end;
+} max_unity_event_reader;
+
+typedef struct
+{
+    uint8_t field_id;
+    max_unity_value_type type;
+
+    const char *string_value;
+    uint32_t string_length;
+    double double_value;
+    int64_t int64_value;
+    bool bool_value;
+
+    // Cursor over the contents of an OBJECT, LIST or MAP value
+    max_unity_event_reader container;
+} max_unity_event_value;
+
+/**
+ * Validates the frame header and positions the reader at the first top-level field.
+ */
+bool max_unity_event_reader_open(max_unity_event_reader *reader, const uint8_t *bytes, size_t length, uint16_t *event_id, uint8_t *flags);
+
+/**
+ * Reads the next field. Returns @c false at the end of the current container or if the data is malformed.
+ */
+bool max_unity_event_reader_next(max_unity_event_reader *reader, max_unity_event_value *value);
+
+// MARK: - Lookup
+
+/**
+ * Returns the event id for the given event name, or @c MAX_UNITY_EVENT_UNKNOWN if the event is not binary-encodable.
+ */
+uint16_t max_unity_event_id_for_name(const char *name);
+const char *max_unity_event_name_for_id(uint16_t event_id);
+
+/**
+ * Returns the field id for the given payload key along with the value type it is encoded as, or @c MAX_UNITY_FIELD_NONE for keys that are not encoded.
+ */
+uint8_t max_unity_event_field_for_key(const char *key, max_unity_value_type *type);
+const char *max_unity_event_key_for_field(uint8_t field_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAUnityEventCodec_h */
@@ -0,0 +1,197 @@
+//
+//  MAUnityLogger.c
+//  AppLovin MAX Unity Plugin
+//
+
+#include "MAUnityLogger.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+// A bounded multi-producer, single-consumer ring. Producers claim a position with a CAS, then publish the slot through its sequence number.
+// Sequences are stored relative to the slot index so the zero-initialized ring is ready to use: slot `i` is free for position `p` once
+// `sequence + i == p`, and holds the message for position `p` once `sequence + i == p + 1`.
+typedef struct
+{
+    atomic_size_t sequence;
+    max_unity_log_level level;
+    size_t length;
+    char message[MAX_UNITY_LOG_MESSAGE_CAPACITY];
+} max_unity_log_slot;
+
+static atomic_int max_unity_log_level_value = MAX_UNITY_LOG_LEVEL_WARNING;
+static atomic_size_t max_unity_log_enqueue_position;
+static atomic_ullong max_unity_log_dropped;
+static max_unity_log_slot max_unity_log_slots[MAX_UNITY_LOG_SLOT_COUNT];
+
+// Only accessed by the writer thread
+static size_t max_unity_log_dequeue_position;
+static uint64_t max_unity_log_reported_dropped;
+
+static _Atomic(max_unity_log_writer) max_unity_log_current_writer;
+static atomic_bool max_unity_log_writer_started;
+static atomic_bool max_unity_log_writer_sleeping;
+static pthread_mutex_t max_unity_log_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t max_unity_log_condition = PTHREAD_COND_INITIALIZER;
+
+static bool max_unity_log_has_pending_message(void)
+{
+    size_t position = max_unity_log_dequeue_position;
+    size_t index = position % MAX_UNITY_LOG_SLOT_COUNT;
+    return atomic_load(&max_unity_log_slots[index].sequence) + index == position + 1;
+}
+
+static void max_unity_log_report_dropped(max_unity_log_writer writer)
+{
+    uint64_t dropped = atomic_load_explicit(&max_unity_log_dropped, memory_order_relaxed);
+    if ( dropped == max_unity_log_reported_dropped ) return;
+
+    char message[128];
+    int length = snprintf(message, sizeof(message), "Dropped %llu log messages since the log buffer was full", (unsigned long long) (dropped - max_unity_log_reported_dropped));
+    max_unity_log_reported_dropped = dropped;
+    writer(MAX_UNITY_LOG_LEVEL_WARNING, message, (size_t) length);
+}
+
+static void max_unity_log_drain(max_unity_log_writer writer)
+{
+    while ( max_unity_log_has_pending_message() )
+    {
+        size_t position = max_unity_log_dequeue_position;
+        size_t index = position % MAX_UNITY_LOG_SLOT_COUNT;
+        max_unity_log_slot *slot = &max_unity_log_slots[index];
+
+        writer(slot->level, slot->message, slot->length);
+
+        // Free the slot for the position one lap ahead
+        atomic_store_explicit(&slot->sequence, position + MAX_UNITY_LOG_SLOT_COUNT - index, memory_order_release);
+        max_unity_log_dequeue_position = position + 1;
+    }
+
+    max_unity_log_report_dropped(writer);
+}
+
+static void *max_unity_log_writer_main(void *argument)
+{
+    (void) argument;
+
+#ifdef __APPLE__
+    pthread_setname_np("com.applovin.max.unity.log");
+#endif
+
+    while ( true )
+    {
+        max_unity_log_drain(atomic_load(&max_unity_log_current_writer));
+
+        pthread_mutex_lock(&max_unity_log_mutex);
+        atomic_store(&max_unity_log_writer_sleeping, true);
+
+        // Producers only signal while the writer is sleeping, so check again after announcing it to avoid missing a message published in between
+        while ( !max_unity_log_has_pending_message() )
+        {
+            pthread_cond_wait(&max_unity_log_condition, &max_unity_log_mutex);
+        }
+
+        atomic_store(&max_unity_log_writer_sleeping, false);
+        pthread_mutex_unlock(&max_unity_log_mutex);
+    }
+
+    return NULL;
+}
+
+void max_unity_log_set_level(max_unity_log_level level)
+{
+    atomic_store_explicit(&max_unity_log_level_value, level, memory_order_relaxed);
+}
+
+max_unity_log_level max_unity_log_get_level(void)
+{
+    return (max_unity_log_level) atomic_load_explicit(&max_unity_log_level_value, memory_order_relaxed);
+}
+
+bool max_unity_log_is_enabled(max_unity_log_level level)
+{
+    return level < MAX_UNITY_LOG_LEVEL_NONE && (int) level >= atomic_load_explicit(&max_unity_log_level_value, memory_order_relaxed);
+}
+
+void max_unity_log_set_writer(max_unity_log_writer writer)
+{
+    if ( !writer ) return;
+
+    atomic_store(&max_unity_log_current_writer, writer);
+
+    bool started = false;
+    if ( !atomic_compare_exchange_strong(&max_unity_log_writer_started, &started, true) ) return;
+
+    pthread_t thread;
+    if ( pthread_create(&thread, NULL, max_unity_log_writer_main, NULL) != 0 )
+    {
+        atomic_store(&max_unity_log_writer_started, false);
+        return;
+    }
+
+    pthread_detach(thread);
+}
+
+bool max_unity_log_enqueue(max_unity_log_level level, const char *message, size_t length)
+{
+    if ( !message || !MAX_UNITY_LOG_IS_ENABLED(level) ) return false;
+
+    size_t position = atomic_load_explicit(&max_unity_log_enqueue_position, memory_order_relaxed);
+    max_unity_log_slot *slot;
+    while ( true )
+    {
+        size_t index = position % MAX_UNITY_LOG_SLOT_COUNT;
+        slot = &max_unity_log_slots[index];
+
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire) + index;
+        if ( sequence == position )
+        {
+            if ( atomic_compare_exchange_weak_explicit(&max_unity_log_enqueue_position, &position, position + 1, memory_order_relaxed, memory_order_relaxed) ) break;
+        }
+        else if ( (intptr_t) (sequence - position) < 0 )
+        {
+            // The writer has not freed this slot from the previous lap yet
+            atomic_fetch_add_explicit(&max_unity_log_dropped, 1, memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = atomic_load_explicit(&max_unity_log_enqueue_position, memory_order_relaxed);
+        }
+    }
+
+    if ( length > MAX_UNITY_LOG_MESSAGE_CAPACITY - 1 )
+    {
+        length = MAX_UNITY_LOG_MESSAGE_CAPACITY - 1;
+
+        // Do not cut a UTF-8 sequence in half
+        while ( length > 0 && ((unsigned char) message[length] & 0xC0) == 0x80 )
+        {
+            length--;
+        }
+    }
+
+    memcpy(slot->message, message, length);
+    slot->message[length] = '\0';
+    slot->length = length;
+    slot->level = level;
+
+    size_t index = position % MAX_UNITY_LOG_SLOT_COUNT;
+    atomic_store(&slot->sequence, position + 1 - index);
+
+    if ( atomic_load(&max_unity_log_writer_sleeping) )
+    {
+        pthread_mutex_lock(&max_unity_log_mutex);
+        pthread_cond_signal(&max_unity_log_condition);
+        pthread_mutex_unlock(&max_unity_log_mutex);
+    }
+
+    return true;
+}
+
+uint64_t max_unity_log_dropped_count(void)
+{
+    return atomic_load_explicit(&max_unity_log_dropped, memory_order_relaxed);
+}
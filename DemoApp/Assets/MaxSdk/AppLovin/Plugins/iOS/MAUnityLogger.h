@@ -0,0 +1,75 @@
+//
+//  MAUnityLogger.h
+//  AppLovin MAX Unity Plugin
+//
+//  Leveled logging for the native plugin. Messages are copied into a fixed-size ring without taking a lock and written out by a background thread,
+//  so logging never blocks the calling thread on console I/O. Written in plain C so it can be built and exercised off-device.
+//
+//  Levels below `MAX_UNITY_LOG_MIN_LEVEL` are compiled out. Levels below the runtime level cost a single atomic load, and callers should check
+//  `MAX_UNITY_LOG_IS_ENABLED` before formatting so disabled messages skip formatting and argument evaluation too.
+//
+
+#ifndef MAUnityLogger_h
+#define MAUnityLogger_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_UNITY_LOG_SLOT_COUNT 256
+#define MAX_UNITY_LOG_MESSAGE_CAPACITY 1024
+
+typedef enum
+{
+    MAX_UNITY_LOG_LEVEL_DEBUG = 0, // Setter and lifecycle messages, only logged while verbose logging is enabled
+    MAX_UNITY_LOG_LEVEL_WARNING,
+    MAX_UNITY_LOG_LEVEL_ERROR,
+    MAX_UNITY_LOG_LEVEL_NONE
+} max_unity_log_level;
+
+// Define as e.g. `MAX_UNITY_LOG_LEVEL_WARNING` in the build settings to compile out lower levels
+#ifndef MAX_UNITY_LOG_MIN_LEVEL
+#define MAX_UNITY_LOG_MIN_LEVEL MAX_UNITY_LOG_LEVEL_DEBUG
+#endif
+
+#define MAX_UNITY_LOG_IS_ENABLED(_LEVEL) ( (_LEVEL) >= MAX_UNITY_LOG_MIN_LEVEL && max_unity_log_is_enabled(_LEVEL) )
+
+/**
+ * Called on the background writer thread for each message, in the order the messages were enqueued. `message` is NUL-terminated.
+ */
+typedef void (*max_unity_log_writer)(max_unity_log_level level, const char *message, size_t length);
+
+/**
+ * Sets the lowest level that is logged. Defaults to `MAX_UNITY_LOG_LEVEL_WARNING`.
+ */
+void max_unity_log_set_level(max_unity_log_level level);
+
+max_unity_log_level max_unity_log_get_level(void);
+
+bool max_unity_log_is_enabled(max_unity_log_level level);
+
+/**
+ * Sets the function that writes messages out and starts the background writer thread if it is not running yet. Messages enqueued before a writer is set are kept until the ring fills up.
+ */
+void max_unity_log_set_writer(max_unity_log_writer writer);
+
+/**
+ * Copies the message into the ring, truncating it to `MAX_UNITY_LOG_MESSAGE_CAPACITY - 1` bytes. Never blocks.
+ * Returns false if the level is disabled or the ring is full, in which case the message is dropped and counted.
+ */
+bool max_unity_log_enqueue(max_unity_log_level level, const char *message, size_t length);
+
+/**
+ * Returns the number of messages dropped because the ring was full. The writer also reports drops as they happen.
+ */
+uint64_t max_unity_log_dropped_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAUnityLogger_h */
@@ -0,0 +1,86 @@
+//
+//  MAUnityPipelineStats.c
+//  AppLovin MAX Unity Plugin
+//
+
+// `clock_gettime` is POSIX rather than ISO C, so strict C modes such as `-std=c11` only declare it with a feature macro.
+// Apple's headers declare it anyway and hide their `_np` extensions once the macro is set, so it is left alone there.
+#if !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "MAUnityPipelineStats.h"
+
+#include <stdatomic.h>
+#include <time.h>
+
+#define MAX_UNITY_PIPELINE_VALUE_COUNT (MAX_UNITY_PIPELINE_EVENT_SLOT_COUNT * MAX_UNITY_PIPELINE_STAGE_COUNT * MAX_UNITY_PIPELINE_VALUES_PER_STAGE)
+
+static atomic_bool max_unity_pipeline_stats_enabled;
+static atomic_llong max_unity_pipeline_stats_values[MAX_UNITY_PIPELINE_VALUE_COUNT];
+
+static int max_unity_pipeline_bucket_for_micros(uint64_t micros)
+{
+    if ( micros == 0 ) return 0;
+
+    // Index of the highest set bit plus one, i.e. the smallest `n` for which `micros < 2^n`
+    int bucket = 64 - __builtin_clzll(micros);
+    return bucket < MAX_UNITY_PIPELINE_BUCKET_COUNT ? bucket : MAX_UNITY_PIPELINE_BUCKET_COUNT - 1;
+}
+
+void max_unity_pipeline_stats_set_enabled(bool enabled)
+{
+    if ( enabled && !atomic_load(&max_unity_pipeline_stats_enabled) )
+    {
+        for ( int i = 0; i < MAX_UNITY_PIPELINE_VALUE_COUNT; i++ )
+        {
+            atomic_store_explicit(&max_unity_pipeline_stats_values[i], 0, memory_order_relaxed);
+        }
+    }
+
+    atomic_store(&max_unity_pipeline_stats_enabled, enabled);
+}
+
+bool max_unity_pipeline_stats_is_enabled(void)
+{
+    return atomic_load_explicit(&max_unity_pipeline_stats_enabled, memory_order_relaxed);
+}
+
+uint64_t max_unity_pipeline_stats_now(void)
+{
+    if ( !max_unity_pipeline_stats_is_enabled() ) return 0;
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+void max_unity_pipeline_stats_record(uint16_t event_id, max_unity_pipeline_stage stage, uint64_t start_nanos, uint64_t end_nanos, uint64_t bytes)
+{
+    if ( start_nanos == 0 || end_nanos < start_nanos || stage >= MAX_UNITY_PIPELINE_STAGE_COUNT || !max_unity_pipeline_stats_is_enabled() ) return;
+
+    if ( event_id >= MAX_UNITY_PIPELINE_EVENT_SLOT_COUNT )
+    {
+        event_id = 0;
+    }
+
+    uint64_t micros = (end_nanos - start_nanos) / 1000;
+    atomic_llong *stage_values = &max_unity_pipeline_stats_values[(event_id * MAX_UNITY_PIPELINE_STAGE_COUNT + stage) * MAX_UNITY_PIPELINE_VALUES_PER_STAGE];
+
+    atomic_fetch_add_explicit(&stage_values[max_unity_pipeline_bucket_for_micros(micros)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stage_values[MAX_UNITY_PIPELINE_BUCKET_COUNT], (long long) micros, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stage_values[MAX_UNITY_PIPELINE_BUCKET_COUNT + 1], (long long) bytes, memory_order_relaxed);
+}
+
+int max_unity_pipeline_stats_copy(int64_t *values, int count)
+{
+    if ( !values || count <= 0 ) return 0;
+
+    int copy_count = count < MAX_UNITY_PIPELINE_VALUE_COUNT ? count : MAX_UNITY_PIPELINE_VALUE_COUNT;
+    for ( int i = 0; i < copy_count; i++ )
+    {
+        values[i] = atomic_load_explicit(&max_unity_pipeline_stats_values[i], memory_order_relaxed);
+    }
+
+    return copy_count;
+}
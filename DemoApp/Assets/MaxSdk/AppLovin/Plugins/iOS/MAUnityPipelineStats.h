@@ -0,0 +1,62 @@
+//
+//  MAUnityPipelineStats.h
+//  AppLovin MAX Unity Plugin
+//
+//  Latency histograms for the native half of the ad event pipeline, from the SDK calling a delegate method until the event is handed to Unity.
+//  Written in plain C so it can be built and exercised off-device.
+//
+//  Samples are recorded with relaxed atomics and never take a lock. While disabled, recording returns after a single atomic load.
+//
+
+#ifndef MAUnityPipelineStats_h
+#define MAUnityPipelineStats_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE: Must be kept in sync with `MaxPipelineStats` in MaxPipelineStats.cs
+#define MAX_UNITY_PIPELINE_BUCKET_COUNT 20
+#define MAX_UNITY_PIPELINE_EVENT_SLOT_COUNT 64
+#define MAX_UNITY_PIPELINE_VALUES_PER_STAGE (MAX_UNITY_PIPELINE_BUCKET_COUNT + 2)
+
+// Bucket `n` counts samples shorter than 2^n microseconds that did not fit in bucket `n - 1`. The last bucket counts everything longer.
+// Each stage is copied out as the bucket counts followed by the total duration in microseconds and the total bytes.
+typedef enum
+{
+    MAX_UNITY_PIPELINE_STAGE_BUILD = 0, // Delegate method called until the event is serialized, including any time spent in the batching window
+    MAX_UNITY_PIPELINE_STAGE_HANDOFF,   // Event serialized until it is handed to Unity, e.g. while the rest of its batch is serialized
+
+    MAX_UNITY_PIPELINE_STAGE_COUNT
+} max_unity_pipeline_stage;
+
+/**
+ * Enabling clears any previously recorded samples.
+ */
+void max_unity_pipeline_stats_set_enabled(bool enabled);
+
+bool max_unity_pipeline_stats_is_enabled(void);
+
+/**
+ * Returns a monotonic timestamp in nanoseconds, or 0 while disabled so callers can skip recording samples they did not time.
+ */
+uint64_t max_unity_pipeline_stats_now(void);
+
+/**
+ * Records a sample for an event id from `max_unity_event_id`. Events without an id are recorded under `MAX_UNITY_EVENT_UNKNOWN`. Samples with a zero start are ignored.
+ */
+void max_unity_pipeline_stats_record(uint16_t event_id, max_unity_pipeline_stage stage, uint64_t start_nanos, uint64_t end_nanos, uint64_t bytes);
+
+/**
+ * Copies the recorded stats into `values`, ordered by event id then stage, with `MAX_UNITY_PIPELINE_VALUES_PER_STAGE` values per stage. Returns the number of values written.
+ */
+int max_unity_pipeline_stats_copy(int64_t *values, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAUnityPipelineStats_h */
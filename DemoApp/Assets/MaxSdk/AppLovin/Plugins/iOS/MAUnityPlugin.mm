@@ -7,6 +7,8 @@
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
 
 #import "MAUnityAdManager.h"
+#import "MAUnityPipelineStats.h"
+#import "MAUnityTimelineTracer.h"
 
 #define VERSION @"8.4.1"
 #define NSSTRING(_X) ( (_X != NULL) ? [NSString stringWithCString: _X encoding: NSStringEncodingConversionAllowLossy].al_stringByTrimmingWhitespace : nil)
@@ -26,6 +28,15 @@
 extern "C"
 {
     static NSString *const TAG = @"MAUnityPlugin";
+    
+    // NOTE: Must be kept in sync with `NativeRect` in MaxSdkiOS.cs
+    typedef struct
+    {
+        float x;
+        float y;
+        float width;
+        float height;
+    } max_unity_rect;
     static NSString *const KeySdkKey = @"SdkKey";
     
     UIView* UnityGetGLView();
@@ -38,11 +49,13 @@ extern "C"
     static bool _initializeSdkCalled = false;
     static bool _disableAllLogs = false;
     
-    // Helper method to create C string copy
-    static const char * cStringCopy(NSString *string);
+    // Helper method to copy a string into a buffer owned by the caller. Returns the length of the string in bytes, and only writes it if it fits.
+    static int max_unity_copy_string(NSString *string, char *buffer, int bufferSize);
     // Helper method to log errors
     void max_unity_log_uninitialized_access_error(const char *callingMethod);
     void max_unity_log_error(NSString *message);
+    // Helper method to resolve an ad unit handle returned by `_MaxRegisterAdUnit`
+    static NSString *max_unity_ad_unit_identifier_for_handle(int adUnitHandle, const char *callingMethod);
 
     ALSdk *getSdk()
     {
@@ -75,9 +88,17 @@ extern "C"
         return _initConfigurationBuilder;
     }
 
-    bool max_unity_should_disable_all_logs()
+    // Setter and lifecycle messages are only logged while verbose logging is enabled, and nothing is logged once all logs are disabled
+    static void max_unity_update_log_level()
     {
-        return _disableAllLogs;
+        if ( _disableAllLogs )
+        {
+            max_unity_log_set_level(MAX_UNITY_LOG_LEVEL_NONE);
+        }
+        else
+        {
+            max_unity_log_set_level([getSdk().settings isVerboseLoggingEnabled] ? MAX_UNITY_LOG_LEVEL_DEBUG : MAX_UNITY_LOG_LEVEL_WARNING);
+        }
     }
 
     int getConsentStatusValue(NSNumber *consentStatus)
@@ -154,6 +175,61 @@ extern "C"
         [MAUnityAdManager setUnityBackgroundCallback: backgroundCallback];
     }
 
+    void _MaxSetBinaryBackgroundCallback(ALUnityBinaryBackgroundCallback binaryBackgroundCallback)
+    {
+        [MAUnityAdManager setUnityBinaryBackgroundCallback: binaryBackgroundCallback];
+    }
+
+    void _MaxSetBinaryEventEncodingEnabled(bool enabled)
+    {
+        [MAUnityAdManager setBinaryEventEncodingEnabled: enabled];
+    }
+
+    void _MaxSetEventSubscriptionMask(uint64_t mask)
+    {
+        [MAUnityAdManager setEventSubscriptionMask: mask];
+    }
+
+    void _MaxSetEventPayloadVersion(int version)
+    {
+        [MAUnityAdManager setEventPayloadVersion: version];
+    }
+
+    void _MaxSetCallbackPayloadLevel(int eventIdentifier, int level)
+    {
+        [MAUnityAdManager setPayloadLevel: level forEventIdentifier: eventIdentifier];
+    }
+
+    void _MaxSetEventBatchingWindowMillis(int millis)
+    {
+        [MAUnityAdManager setEventBatchingWindowMillis: millis];
+    }
+
+    void _MaxSetPipelineStatsEnabled(bool enabled)
+    {
+        max_unity_pipeline_stats_set_enabled(enabled);
+    }
+    
+    int _MaxCopyPipelineStats(int64_t *values, int count)
+    {
+        return max_unity_pipeline_stats_copy(values, count);
+    }
+    
+    void _MaxSetTimelineTracingEnabled(bool enabled)
+    {
+        max_unity_timeline_set_enabled(enabled);
+    }
+    
+    int64_t _MaxGetTimelineClock()
+    {
+        return (int64_t) max_unity_timeline_clock();
+    }
+    
+    int _MaxCopyTimelineSpans(int64_t *values, int count)
+    {
+        return max_unity_timeline_copy(values, count);
+    }
+
     void _MaxSetSdkKey(const char *sdkKey)
     {
         if (!sdkKey) return;
@@ -173,6 +249,9 @@ extern "C"
         
         ALSdkInitializationConfiguration *initConfig = [initConfigurationBuilder build];
         
+        // Verbose logging may also have been enabled in Info.plist
+        max_unity_update_log_level();
+        
         [getAdManager() initializeSdkWithConfiguration: initConfig andCompletionHandler:^(ALSdkConfiguration *configuration) {
             _isSdkInitialized = true;
         }];
@@ -185,7 +264,7 @@ extern "C"
         return _isSdkInitialized;
     }
 
-    const char * _MaxGetAvailableMediatedNetworks()
+    int _MaxCopyAvailableMediatedNetworks(char *buffer, int bufferSize)
     {
         NSArray<MAMediatedNetworkInfo *> *availableMediatedNetworks = [getSdk() availableMediatedNetworks];
         
@@ -202,7 +281,12 @@ extern "C"
         }
         
         NSData *jsonData = [NSJSONSerialization dataWithJSONObject: serializedNetworks options: 0 error: nil];
-        return cStringCopy([[NSString alloc] initWithData: jsonData encoding: NSUTF8StringEncoding]);
+        if ( buffer && jsonData.length <= bufferSize )
+        {
+            memcpy(buffer, jsonData.bytes, jsonData.length);
+        }
+        
+        return (int) jsonData.length;
     }
     
     void _MaxShowMediationDebugger()
@@ -243,24 +327,25 @@ extern "C"
         getInitConfigurationBuilder().segmentCollection = getSegmentCollection(collectionJson);
     }
 
-    const char * _MaxGetSdkConfiguration()
+    int _MaxCopySdkConfiguration(char *buffer, int bufferSize)
     {
         if ( !_initializeSdkCalled )
         {
-            max_unity_log_uninitialized_access_error("_MaxGetSdkConfiguration");
-            return cStringCopy(@"");
+            max_unity_log_uninitialized_access_error("_MaxCopySdkConfiguration");
+            return 0;
         }
         
         NSString *consentFlowUserGeographyStr = @(getSdk().configuration.consentFlowUserGeography).stringValue;
         NSString *consentDialogStateStr = @(getSdk().configuration.consentDialogState).stringValue;
         NSString *appTrackingStatus = @(getSdk().configuration.appTrackingTransparencyStatus).stringValue; // Deliberately name it `appTrackingStatus` to be a bit more generic (in case Android introduces a similar concept)
 
-        return cStringCopy([MAUnityAdManager serializeParameters: @{@"consentFlowUserGeography" : consentFlowUserGeographyStr,
-                                                                    @"consentDialogState" : consentDialogStateStr,
-                                                                    @"countryCode" : getSdk().configuration.countryCode,
-                                                                    @"appTrackingStatus" : appTrackingStatus,
-                                                                    @"isSuccessfullyInitialized" : @([getSdk() isInitialized]),
-                                                                    @"isTestModeEnabled" : @([getSdk().configuration isTestModeEnabled])}]);
+        NSString *serializedConfiguration = [MAUnityAdManager serializeParameters: @{@"consentFlowUserGeography" : consentFlowUserGeographyStr,
+                                                                                     @"consentDialogState" : consentDialogStateStr,
+                                                                                     @"countryCode" : getSdk().configuration.countryCode,
+                                                                                     @"appTrackingStatus" : appTrackingStatus,
+                                                                                     @"isSuccessfullyInitialized" : @([getSdk() isInitialized]),
+                                                                                     @"isTestModeEnabled" : @([getSdk().configuration isTestModeEnabled])}];
+        return max_unity_copy_string(serializedConfiguration, buffer, bufferSize);
     }
     
     void _MaxSetHasUserConsent(bool hasUserConsent)
@@ -410,6 +495,32 @@ extern "C"
                                                                   value: value];
     }
     
+    void _MaxSetBannerExtraParameters(const char *adUnitIdentifier, const char *serializedExtraParameters)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetBannerExtraParameters");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *extraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(serializedExtraParameters)];
+        [getAdManager() setBannerExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                    extraParameters: extraParameters];
+    }
+    
+    void _MaxSetBannerLocalExtraParametersJSON(const char *adUnitIdentifier, const char *json)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetBannerLocalExtraParametersJSON");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *localExtraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(json)];
+        [getAdManager() setBannerLocalExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                    localExtraParameters: localExtraParameters];
+    }
+    
     void _MaxSetBannerCustomData(const char *adUnitIdentifier, const char *customData)
     {
         if ( !_initializeSdkCalled )
@@ -487,15 +598,21 @@ extern "C"
         [getAdManager() hideBannerWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
-    const char * _MaxGetBannerLayout(const char *adUnitIdentifier)
+    void _MaxGetBannerFrame(const char *adUnitIdentifier, max_unity_rect *frame)
     {
+        memset(frame, 0, sizeof(*frame));
+        
         if ( !_initializeSdkCalled )
         {
-            max_unity_log_uninitialized_access_error("_MaxGetBannerLayout");
-            return cStringCopy(@"");
+            max_unity_log_uninitialized_access_error("_MaxGetBannerFrame");
+            return;
         }
                 
-        return cStringCopy([getAdManager() bannerLayoutForAdUnitIdentifier: NSSTRING(adUnitIdentifier)]);
+        CGRect adViewFrame = [getAdManager() bannerFrameForAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
+        frame->x = CGRectGetMinX(adViewFrame);
+        frame->y = CGRectGetMinY(adViewFrame);
+        frame->width = CGRectGetWidth(adViewFrame);
+        frame->height = CGRectGetHeight(adViewFrame);
     }
     
     void _MaxCreateMRec(const char *adUnitIdentifier, const char *mrecPosition)
@@ -659,6 +776,32 @@ extern "C"
                                                                 value: value];
     }
     
+    void _MaxSetMRecExtraParameters(const char *adUnitIdentifier, const char *serializedExtraParameters)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetMRecExtraParameters");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *extraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(serializedExtraParameters)];
+        [getAdManager() setMRecExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                  extraParameters: extraParameters];
+    }
+    
+    void _MaxSetMRecLocalExtraParametersJSON(const char *adUnitIdentifier, const char *json)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetMRecLocalExtraParametersJSON");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *localExtraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(json)];
+        [getAdManager() setMRecLocalExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                  localExtraParameters: localExtraParameters];
+    }
+    
     void _MaxSetMRecCustomData(const char *adUnitIdentifier, const char *customData)
     {
         if ( !_initializeSdkCalled )
@@ -670,15 +813,21 @@ extern "C"
         [getAdManager() setMRecCustomData: NSSTRING(customData) forAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
 
-    const char * _MaxGetMRecLayout(const char *adUnitIdentifier)
+    void _MaxGetMRecFrame(const char *adUnitIdentifier, max_unity_rect *frame)
     {
+        memset(frame, 0, sizeof(*frame));
+        
         if ( !_initializeSdkCalled )
         {
-            max_unity_log_uninitialized_access_error("_MaxGetMRecLayout");
-            return cStringCopy(@"");
+            max_unity_log_uninitialized_access_error("_MaxGetMRecFrame");
+            return;
         }
                 
-        return cStringCopy([getAdManager() mrecLayoutForAdUnitIdentifier: NSSTRING(adUnitIdentifier)]);
+        CGRect adViewFrame = [getAdManager() mrecFrameForAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
+        frame->x = CGRectGetMinX(adViewFrame);
+        frame->y = CGRectGetMinY(adViewFrame);
+        frame->width = CGRectGetWidth(adViewFrame);
+        frame->height = CGRectGetHeight(adViewFrame);
     }
     
     void _MaxLoadInterstitial(const char *adUnitIdentifier)
@@ -692,6 +841,20 @@ extern "C"
         [getAdManager() loadInterstitialWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    void _MaxLoadInterstitialWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxLoadInterstitialWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxLoadInterstitialWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() loadInterstitialWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxSetInterstitialExtraParameter(const char *adUnitIdentifier, const char *key, const char *value)
     {
         if ( !_initializeSdkCalled )
@@ -731,6 +894,32 @@ extern "C"
                                                                           key: NSSTRING(key)
                                                                         value: value];
     }
+    
+    void _MaxSetInterstitialExtraParameters(const char *adUnitIdentifier, const char *serializedExtraParameters)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetInterstitialExtraParameters");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *extraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(serializedExtraParameters)];
+        [getAdManager() setInterstitialExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                          extraParameters: extraParameters];
+    }
+    
+    void _MaxSetInterstitialLocalExtraParametersJSON(const char *adUnitIdentifier, const char *json)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetInterstitialLocalExtraParametersJSON");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *localExtraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(json)];
+        [getAdManager() setInterstitialLocalExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                          localExtraParameters: localExtraParameters];
+    }
 
     bool _MaxIsInterstitialReady(const char *adUnitIdentifier)
     {
@@ -743,6 +932,20 @@ extern "C"
         return [getAdManager() isInterstitialReadyWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    bool _MaxIsInterstitialReadyWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxIsInterstitialReadyWithHandle");
+            return false;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxIsInterstitialReadyWithHandle");
+        if ( !adUnitIdentifier ) return false;
+        
+        return [getAdManager() isInterstitialReadyWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxShowInterstitial(const char *adUnitIdentifier, const char *placement, const char *customData)
     {
         if ( !_initializeSdkCalled )
@@ -754,6 +957,20 @@ extern "C"
         [getAdManager() showInterstitialWithAdUnitIdentifier: NSSTRING(adUnitIdentifier) placement: NSSTRING(placement) customData: NSSTRING(customData)];
     }
     
+    void _MaxShowInterstitialWithHandle(int adUnitHandle, const char *placement, const char *customData)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxShowInterstitialWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxShowInterstitialWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() showInterstitialWithAdUnitIdentifier: adUnitIdentifier placement: NSSTRING(placement) customData: NSSTRING(customData)];
+    }
+    
     void _MaxLoadAppOpenAd(const char *adUnitIdentifier)
     {
         if ( !_initializeSdkCalled )
@@ -765,6 +982,20 @@ extern "C"
         [getAdManager() loadAppOpenAdWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    void _MaxLoadAppOpenAdWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxLoadAppOpenAdWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxLoadAppOpenAdWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() loadAppOpenAdWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxSetAppOpenAdExtraParameter(const char *adUnitIdentifier, const char *key, const char *value)
     {
         if ( !_initializeSdkCalled )
@@ -805,6 +1036,32 @@ extern "C"
                                                                      value: value];
     }
     
+    void _MaxSetAppOpenAdExtraParameters(const char *adUnitIdentifier, const char *serializedExtraParameters)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetAppOpenAdExtraParameters");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *extraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(serializedExtraParameters)];
+        [getAdManager() setAppOpenAdExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                       extraParameters: extraParameters];
+    }
+    
+    void _MaxSetAppOpenAdLocalExtraParametersJSON(const char *adUnitIdentifier, const char *json)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetAppOpenAdLocalExtraParametersJSON");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *localExtraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(json)];
+        [getAdManager() setAppOpenAdLocalExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                       localExtraParameters: localExtraParameters];
+    }
+    
     bool _MaxIsAppOpenAdReady(const char *adUnitIdentifier)
     {
         if ( !_initializeSdkCalled )
@@ -816,6 +1073,20 @@ extern "C"
         return [getAdManager() isAppOpenAdReadyWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    bool _MaxIsAppOpenAdReadyWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxIsAppOpenAdReadyWithHandle");
+            return false;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxIsAppOpenAdReadyWithHandle");
+        if ( !adUnitIdentifier ) return false;
+        
+        return [getAdManager() isAppOpenAdReadyWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxShowAppOpenAd(const char *adUnitIdentifier, const char *placement, const char *customData)
     {
         if ( !_initializeSdkCalled )
@@ -827,6 +1098,20 @@ extern "C"
         [getAdManager() showAppOpenAdWithAdUnitIdentifier: NSSTRING(adUnitIdentifier) placement: NSSTRING(placement) customData: NSSTRING(customData)];
     }
     
+    void _MaxShowAppOpenAdWithHandle(int adUnitHandle, const char *placement, const char *customData)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxShowAppOpenAdWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxShowAppOpenAdWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() showAppOpenAdWithAdUnitIdentifier: adUnitIdentifier placement: NSSTRING(placement) customData: NSSTRING(customData)];
+    }
+    
     void _MaxLoadRewardedAd(const char *adUnitIdentifier)
     {
         if ( !_initializeSdkCalled )
@@ -838,6 +1123,20 @@ extern "C"
         [getAdManager() loadRewardedAdWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    void _MaxLoadRewardedAdWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxLoadRewardedAdWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxLoadRewardedAdWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() loadRewardedAdWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxSetRewardedAdExtraParameter(const char *adUnitIdentifier, const char *key, const char *value)
     {
         if ( !_initializeSdkCalled )
@@ -877,6 +1176,32 @@ extern "C"
                                                                         key: NSSTRING(key)
                                                                       value: value];
     }
+    
+    void _MaxSetRewardedAdExtraParameters(const char *adUnitIdentifier, const char *serializedExtraParameters)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetRewardedAdExtraParameters");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *extraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(serializedExtraParameters)];
+        [getAdManager() setRewardedAdExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                        extraParameters: extraParameters];
+    }
+    
+    void _MaxSetRewardedAdLocalExtraParametersJSON(const char *adUnitIdentifier, const char *json)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxSetRewardedAdLocalExtraParametersJSON");
+            return;
+        }
+        
+        NSDictionary<NSString *, id> *localExtraParameters = [MAUnityAdManager deserializeParameters: NSSTRING(json)];
+        [getAdManager() setRewardedAdLocalExtraParametersForAdUnitIdentifier: NSSTRING(adUnitIdentifier)
+                                                        localExtraParameters: localExtraParameters];
+    }
 
     bool _MaxIsRewardedAdReady(const char *adUnitIdentifier)
     {
@@ -889,6 +1214,20 @@ extern "C"
         return [getAdManager() isRewardedAdReadyWithAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
     }
     
+    bool _MaxIsRewardedAdReadyWithHandle(int adUnitHandle)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxIsRewardedAdReadyWithHandle");
+            return false;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxIsRewardedAdReadyWithHandle");
+        if ( !adUnitIdentifier ) return false;
+        
+        return [getAdManager() isRewardedAdReadyWithAdUnitIdentifier: adUnitIdentifier];
+    }
+    
     void _MaxShowRewardedAd(const char *adUnitIdentifier, const char *placement, const char *customData)
     {
         if ( !_initializeSdkCalled )
@@ -900,6 +1239,20 @@ extern "C"
         [getAdManager() showRewardedAdWithAdUnitIdentifier: NSSTRING(adUnitIdentifier) placement: NSSTRING(placement) customData: NSSTRING(customData)];
     }
     
+    void _MaxShowRewardedAdWithHandle(int adUnitHandle, const char *placement, const char *customData)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxShowRewardedAdWithHandle");
+            return;
+        }
+        
+        NSString *adUnitIdentifier = max_unity_ad_unit_identifier_for_handle(adUnitHandle, "_MaxShowRewardedAdWithHandle");
+        if ( !adUnitIdentifier ) return;
+        
+        [getAdManager() showRewardedAdWithAdUnitIdentifier: adUnitIdentifier placement: NSSTRING(placement) customData: NSSTRING(customData)];
+    }
+    
     void _MaxTrackEvent(const char *event, const char *parameters)
     {
         if ( !_initializeSdkCalled )
@@ -945,10 +1298,25 @@ extern "C"
         return getConsentStatusValue(consentStatus);
     }
     
-    static const char * cStringCopy(NSString *string)
+    static int max_unity_copy_string(NSString *string, char *buffer, int bufferSize)
     {
-        const char *value = string.UTF8String;
-        return value ? strdup(value) : NULL;
+        if ( !string ) return 0;
+        
+        NSUInteger length = [string lengthOfBytesUsingEncoding: NSUTF8StringEncoding];
+        
+        // A negative size would convert to a huge unsigned value, so it is treated as no buffer
+        if ( buffer && bufferSize >= 0 && length <= (NSUInteger) bufferSize )
+        {
+            [string getBytes: buffer
+                   maxLength: (NSUInteger) bufferSize
+                  usedLength: &length
+                    encoding: NSUTF8StringEncoding
+                     options: 0
+                       range: NSMakeRange(0, string.length)
+              remainingRange: NULL];
+        }
+        
+        return (int) length;
     }
     
     void _MaxSetMuted(bool muted)
@@ -966,14 +1334,31 @@ extern "C"
         return [UIScreen.mainScreen nativeScale];
     }
     
-    const char * _MaxGetAdValue(const char *adUnitIdentifier, const char *key)
+    int _MaxCopyAdValue(const char *adUnitIdentifier, const char *key, char *buffer, int bufferSize)
+    {
+        return max_unity_copy_string([getAdManager() adValueForAdUnitIdentifier: NSSTRING(adUnitIdentifier) withKey: NSSTRING(key)], buffer, bufferSize);
+    }
+    
+    int _MaxRegisterAdUnit(const char *adUnitIdentifier)
     {
-        return cStringCopy([getAdManager() adValueForAdUnitIdentifier: NSSTRING(adUnitIdentifier) withKey: NSSTRING(key)]);
+        return [getAdManager() registerAdUnitIdentifier: NSSTRING(adUnitIdentifier)];
+    }
+    
+    int _MaxCopyAdUnitStateDump(char *buffer, int bufferSize)
+    {
+        if ( !_initializeSdkCalled )
+        {
+            max_unity_log_uninitialized_access_error("_MaxCopyAdUnitStateDump");
+            return 0;
+        }
+        
+        return max_unity_copy_string([getAdManager() adUnitStateDebugDump], buffer, bufferSize);
     }
 
     void _MaxSetVerboseLogging(bool enabled)
     {
         getSdk().settings.verboseLoggingEnabled = enabled;
+        max_unity_update_log_level();
     }
     
     bool _MaxIsVerboseLoggingEnabled()
@@ -1023,6 +1408,7 @@ extern "C"
         if ( [@"disable_all_logs" isEqualToString: stringKey] )
         {
             _disableAllLogs = [@"true" al_isEqualToStringIgnoringCase: stringValue];
+            max_unity_update_log_level();
         }
         
         ALSdkSettings *settings = getSdk().settings;
@@ -1069,12 +1455,20 @@ extern "C"
         max_unity_log_error(message);
     }
 
-    void max_unity_log_error(NSString *message)
+    static NSString *max_unity_ad_unit_identifier_for_handle(int adUnitHandle, const char *callingMethod)
     {
-        if (_disableAllLogs) return;
+        NSString *adUnitIdentifier = [getAdManager() adUnitIdentifierForHandle: adUnitHandle];
+        if ( !adUnitIdentifier )
+        {
+            max_unity_log_error([NSString stringWithFormat: @"Failed to execute: %s - invalid ad unit handle: %d", callingMethod, adUnitHandle]);
+        }
         
-        NSString *logMessage = [NSString stringWithFormat: @"[%@] %@", TAG, message];
-        NSLog(@"%@", logMessage);
+        return adUnitIdentifier;
+    }
+    
+    void max_unity_log_error(NSString *message)
+    {
+        MAX_UNITY_LOG_ERROR(@"%@", message);
     }
 }
 
@@ -0,0 +1,141 @@
+//
+//  MAUnityTimelineTracer.c
+//  AppLovin MAX Unity Plugin
+//
+
+// `clock_gettime` is POSIX rather than ISO C, so strict C modes such as `-std=c11` only declare it with a feature macro.
+// Apple's headers declare it anyway and hide their `_np` extensions once the macro is set, so it is left alone there.
+#if !defined(__APPLE__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "MAUnityTimelineTracer.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define MAX_UNITY_TIMELINE_MAIN_THREAD_FLAG (1ULL << 8)
+
+// Each slot is guarded by a sequence number: 0 while empty or being written, and the span's index plus one once written. Readers discard slots whose sequence changed while copying.
+typedef struct
+{
+    atomic_ullong sequence;
+    atomic_ullong start_nanos;
+    atomic_ullong end_nanos;
+    atomic_ullong thread_id;
+    atomic_ullong info;
+} max_unity_timeline_slot;
+
+static atomic_bool max_unity_timeline_enabled;
+static atomic_ullong max_unity_timeline_span_count;
+static max_unity_timeline_slot max_unity_timeline_slots[MAX_UNITY_TIMELINE_SPAN_CAPACITY];
+
+static uint64_t max_unity_timeline_thread_id(void)
+{
+#ifdef __APPLE__
+    uint64_t thread_id = 0;
+    pthread_threadid_np(NULL, &thread_id);
+    return thread_id;
+#else
+    return (uint64_t) pthread_self();
+#endif
+}
+
+static bool max_unity_timeline_is_main_thread(void)
+{
+#ifdef __APPLE__
+    return pthread_main_np() != 0;
+#else
+    return false;
+#endif
+}
+
+void max_unity_timeline_set_enabled(bool enabled)
+{
+    if ( enabled && !atomic_load(&max_unity_timeline_enabled) )
+    {
+        for ( int i = 0; i < MAX_UNITY_TIMELINE_SPAN_CAPACITY; i++ )
+        {
+            atomic_store_explicit(&max_unity_timeline_slots[i].sequence, 0, memory_order_relaxed);
+        }
+
+        atomic_store(&max_unity_timeline_span_count, 0);
+    }
+
+    atomic_store(&max_unity_timeline_enabled, enabled);
+}
+
+bool max_unity_timeline_is_enabled(void)
+{
+    return atomic_load_explicit(&max_unity_timeline_enabled, memory_order_relaxed);
+}
+
+uint64_t max_unity_timeline_now(void)
+{
+    return max_unity_timeline_is_enabled() ? max_unity_timeline_clock() : 0;
+}
+
+uint64_t max_unity_timeline_clock(void)
+{
+    struct timespec now;
+#ifdef __APPLE__
+    // Matches `mach_absolute_time()`, which Unity's Stopwatch is based on, so the clocks do not drift apart while the device sleeps
+    clock_gettime(CLOCK_UPTIME_RAW, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+void max_unity_timeline_record(max_unity_timeline_span_kind kind, uint32_t argument, uint64_t start_nanos, uint64_t end_nanos)
+{
+    if ( start_nanos == 0 || end_nanos < start_nanos || kind >= MAX_UNITY_TIMELINE_SPAN_COUNT || !max_unity_timeline_is_enabled() ) return;
+
+    uint64_t index = atomic_fetch_add(&max_unity_timeline_span_count, 1);
+    max_unity_timeline_slot *slot = &max_unity_timeline_slots[index % MAX_UNITY_TIMELINE_SPAN_CAPACITY];
+
+    uint64_t info = (uint64_t) kind | ((uint64_t) argument << 32);
+    if ( max_unity_timeline_is_main_thread() )
+    {
+        info |= MAX_UNITY_TIMELINE_MAIN_THREAD_FLAG;
+    }
+
+    atomic_store_explicit(&slot->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&slot->start_nanos, start_nanos, memory_order_relaxed);
+    atomic_store_explicit(&slot->end_nanos, end_nanos, memory_order_relaxed);
+    atomic_store_explicit(&slot->thread_id, max_unity_timeline_thread_id(), memory_order_relaxed);
+    atomic_store_explicit(&slot->info, info, memory_order_relaxed);
+    atomic_store_explicit(&slot->sequence, index + 1, memory_order_release);
+}
+
+int max_unity_timeline_copy(int64_t *values, int count)
+{
+    if ( !values || count < MAX_UNITY_TIMELINE_VALUES_PER_SPAN ) return 0;
+
+    uint64_t span_count = atomic_load(&max_unity_timeline_span_count);
+    uint64_t first_index = span_count > MAX_UNITY_TIMELINE_SPAN_CAPACITY ? span_count - MAX_UNITY_TIMELINE_SPAN_CAPACITY : 0;
+
+    int value_count = 0;
+    for ( uint64_t index = first_index; index < span_count && value_count + MAX_UNITY_TIMELINE_VALUES_PER_SPAN <= count; index++ )
+    {
+        max_unity_timeline_slot *slot = &max_unity_timeline_slots[index % MAX_UNITY_TIMELINE_SPAN_CAPACITY];
+        if ( atomic_load_explicit(&slot->sequence, memory_order_acquire) != index + 1 ) continue;
+
+        int64_t start_nanos = (int64_t) atomic_load_explicit(&slot->start_nanos, memory_order_relaxed);
+        int64_t end_nanos = (int64_t) atomic_load_explicit(&slot->end_nanos, memory_order_relaxed);
+        int64_t thread_id = (int64_t) atomic_load_explicit(&slot->thread_id, memory_order_relaxed);
+        int64_t info = (int64_t) atomic_load_explicit(&slot->info, memory_order_relaxed);
+
+        atomic_thread_fence(memory_order_acquire);
+        if ( atomic_load_explicit(&slot->sequence, memory_order_relaxed) != index + 1 ) continue;
+
+        values[value_count++] = start_nanos;
+        values[value_count++] = end_nanos;
+        values[value_count++] = thread_id;
+        values[value_count++] = info;
+    }
+
+    return value_count;
+}
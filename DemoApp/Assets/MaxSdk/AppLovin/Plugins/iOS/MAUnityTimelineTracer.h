@@ -0,0 +1,67 @@
+//
+//  MAUnityTimelineTracer.h
+//  AppLovin MAX Unity Plugin
+//
+//  Timeline spans for the native half of the plugin, e.g. delegate handling and ad view layout passes, kept in a preallocated ring buffer
+//  that Unity merges with its own spans and exports as Chrome trace-event JSON. Written in plain C so it can be built and exercised off-device.
+//
+//  Spans are written without taking a lock. Once the buffer is full, the oldest spans are overwritten. While disabled, recording returns after a single atomic load.
+//
+
+#ifndef MAUnityTimelineTracer_h
+#define MAUnityTimelineTracer_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOTE: Must be kept in sync with `MaxTimelineTracer` in MaxTimelineTracer.cs
+#define MAX_UNITY_TIMELINE_SPAN_CAPACITY 4096
+#define MAX_UNITY_TIMELINE_VALUES_PER_SPAN 4
+
+typedef enum
+{
+    MAX_UNITY_TIMELINE_SPAN_DELEGATE = 0,   // An SDK delegate callback being turned into events on the event pipeline queue. The argument is the id of the last event it forwarded.
+    MAX_UNITY_TIMELINE_SPAN_AD_VIEW_LAYOUT, // A layout pass over the ad views that need to be positioned. The argument is the number of ad views.
+    MAX_UNITY_TIMELINE_SPAN_MAIN_THREAD,    // A block dispatched to the main thread. The argument is how long it waited to run, in microseconds.
+
+    MAX_UNITY_TIMELINE_SPAN_COUNT
+} max_unity_timeline_span_kind;
+
+/**
+ * Enabling clears any previously recorded spans.
+ */
+void max_unity_timeline_set_enabled(bool enabled);
+
+bool max_unity_timeline_is_enabled(void);
+
+/**
+ * Returns a monotonic timestamp in nanoseconds, or 0 while disabled so callers can skip recording spans they did not time.
+ */
+uint64_t max_unity_timeline_now(void);
+
+/**
+ * Returns the same clock as `max_unity_timeline_now()` regardless of whether tracing is enabled, so Unity can line the native spans up with its own clock.
+ */
+uint64_t max_unity_timeline_clock(void);
+
+/**
+ * Records a span on the calling thread. Spans with a zero start are ignored.
+ */
+void max_unity_timeline_record(max_unity_timeline_span_kind kind, uint32_t argument, uint64_t start_nanos, uint64_t end_nanos);
+
+/**
+ * Copies the recorded spans into `values`, oldest first, with `MAX_UNITY_TIMELINE_VALUES_PER_SPAN` values per span: start and end in nanoseconds, the thread id,
+ * and the kind in the low 8 bits, a main thread flag in bit 8, and the argument in the high 32 bits. Returns the number of values written.
+ * Spans overwritten while being copied are skipped.
+ */
+int max_unity_timeline_copy(int64_t *values, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAUnityTimelineTracer_h */
@@ -0,0 +1,614 @@
+//
+//  MaxAdInventory.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using UnityEngine;
+
+namespace AppLovinMax.Scripts
+{
+    /// <summary>
+    /// Keeps fullscreen ads loaded ahead of time so they are ready when the game wants to show them.
+    ///
+    /// Each placement is backed by one or more ad units of the same format, and the inventory keeps up to a target number of them loaded.
+    /// Loads are started from the Unity main thread, at most <see cref="MaxConcurrentLoads"/> at a time with higher priority placements first,
+    /// and failed loads are retried with exponential backoff. Loads can be deferred while the game is doing something that should not be disturbed, e.g. loading a level.
+    ///
+    /// Ad units managed by the inventory should not be loaded or shown directly.
+    /// </summary>
+    public class MaxAdInventory : MonoBehaviour
+    {
+        public enum AdFormat
+        {
+            Interstitial,
+            AppOpen,
+            Rewarded
+        }
+
+        /// <summary>
+        /// Placements with a higher priority are loaded first when more loads are needed than <see cref="MaxAdInventory.MaxConcurrentLoads"/> allows.
+        /// </summary>
+        public enum Priority
+        {
+            Low = 0,
+            Normal = 1,
+            High = 2
+        }
+
+        /// <summary>
+        /// Stats about a placement since it was added. See <see cref="MaxAdInventory.GetStats"/>.
+        /// </summary>
+        public class PlacementStats
+        {
+            public int ReadyCount { get; private set; }
+
+            public int TargetReadyCount { get; private set; }
+
+            /// <summary>
+            /// The number of loads started, including retries.
+            /// </summary>
+            public int LoadCount { get; private set; }
+
+            public int LoadFailureCount { get; private set; }
+
+            /// <summary>
+            /// The number of ads that became ready, each counted once regardless of how many retries it took.
+            /// </summary>
+            public int ReadyAdCount { get; private set; }
+
+            /// <summary>
+            /// The average time, in seconds, from an ad unit needing an ad until it had one, including any failed attempts in between.
+            /// </summary>
+            public double AverageTimeToReadySeconds { get; private set; }
+
+            public double MaxTimeToReadySeconds { get; private set; }
+
+            /// <summary>
+            /// The number of times <see cref="MaxAdInventory.TryShow"/> found an ad ready.
+            /// </summary>
+            public int ShowHitCount { get; private set; }
+
+            /// <summary>
+            /// The number of times <see cref="MaxAdInventory.TryShow"/> was called while no ad was ready.
+            /// </summary>
+            public int ShowMissCount { get; private set; }
+
+            public double ShowHitRate
+            {
+                get { return ShowHitCount + ShowMissCount > 0 ? (double) ShowHitCount / (ShowHitCount + ShowMissCount) : 0; }
+            }
+
+            internal PlacementStats(Placement placement)
+            {
+                foreach (var adUnit in placement.AdUnits)
+                {
+                    if (adUnit.State == AdUnitState.Ready)
+                    {
+                        ReadyCount++;
+                    }
+                }
+
+                TargetReadyCount = placement.TargetReadyCount;
+                LoadCount = placement.LoadCount;
+                LoadFailureCount = placement.LoadFailureCount;
+                ReadyAdCount = placement.ReadyAdCount;
+                AverageTimeToReadySeconds = placement.ReadyAdCount > 0 ? TicksToSeconds(placement.TotalTimeToReadyTicks) / placement.ReadyAdCount : 0;
+                MaxTimeToReadySeconds = TicksToSeconds(placement.MaxTimeToReadyTicks);
+                ShowHitCount = placement.ShowHitCount;
+                ShowMissCount = placement.ShowMissCount;
+            }
+
+            public override string ToString()
+            {
+                return "[PlacementStats readyCount: " + ReadyCount +
+                       ", targetReadyCount: " + TargetReadyCount +
+                       ", loadCount: " + LoadCount +
+                       ", loadFailureCount: " + LoadFailureCount +
+                       ", readyAdCount: " + ReadyAdCount +
+                       ", averageTimeToReadySeconds: " + AverageTimeToReadySeconds +
+                       ", maxTimeToReadySeconds: " + MaxTimeToReadySeconds +
+                       ", showHitCount: " + ShowHitCount +
+                       ", showMissCount: " + ShowMissCount + "]";
+            }
+        }
+
+        internal enum AdUnitState
+        {
+            Idle,           // Needs an ad, but no load has been started
+            WaitingToRetry, // The last load failed and the next one is due at `RetryTimestamp`
+            Loading,
+            Ready,
+            Showing
+        }
+
+        internal sealed class AdUnit
+        {
+            public string AdUnitIdentifier;
+            public Placement Placement;
+            public AdUnitState State;
+            public int RetryAttempt;
+            public long RetryTimestamp;
+            public long NeededSinceTimestamp; // When the ad unit last started needing an ad, used for time-to-ready
+        }
+
+        internal sealed class Placement
+        {
+            public string Name;
+            public AdFormat Format;
+            public Priority Priority;
+            public int TargetReadyCount;
+            public readonly List<AdUnit> AdUnits = new List<AdUnit>();
+
+            public int LoadCount;
+            public int LoadFailureCount;
+            public int ReadyAdCount;
+            public long TotalTimeToReadyTicks;
+            public long MaxTimeToReadyTicks;
+            public int ShowHitCount;
+            public int ShowMissCount;
+        }
+
+        // Failed loads are retried after 2, 4, 8, ... seconds, up to this many seconds
+        private const int MaxRetryDelaySeconds = 64;
+
+        private static MaxAdInventory _instance;
+
+        // Placements and ad units are only added on the main thread, but ad events may arrive on a background thread if `MaxSdk.InvokeEventsOnUnityMainThread` is false
+        private readonly object _lock = new object();
+        private readonly List<Placement> _placementsByPriority = new List<Placement>();
+        private readonly Dictionary<string, Placement> _placements = new Dictionary<string, Placement>();
+        private readonly Dictionary<string, AdUnit> _adUnits = new Dictionary<string, AdUnit>();
+        private readonly bool[] _isSubscribedToFormat = new bool[3];
+        private readonly List<AdUnit> _adUnitsToLoad = new List<AdUnit>(); // Only used on the main thread, from `Update()`
+        private int _maxConcurrentLoads = 2;
+        private int _deferLoadsCount;
+
+        /// <summary>
+        /// The shared inventory. Created the first time it is accessed, and kept alive across scene loads. Must first be accessed from the Unity main thread.
+        /// </summary>
+        public static MaxAdInventory Instance
+        {
+            get
+            {
+                if (_instance != null) return _instance;
+
+                var inventory = new GameObject("MaxAdInventory");
+                inventory.hideFlags = HideFlags.HideAndDontSave;
+                DontDestroyOnLoad(inventory);
+                _instance = inventory.AddComponent<MaxAdInventory>();
+
+                return _instance;
+            }
+        }
+
+        /// <summary>
+        /// The maximum number of loads in flight at once, across every placement. Defaults to <c>2</c>.
+        /// </summary>
+        public int MaxConcurrentLoads
+        {
+            get { lock (_lock) return _maxConcurrentLoads; }
+            set { lock (_lock) _maxConcurrentLoads = Math.Max(value, 1); }
+        }
+
+        /// <summary>
+        /// Whether new loads are currently deferred. See <see cref="DeferLoads"/>.
+        /// </summary>
+        public bool IsDeferringLoads
+        {
+            get { lock (_lock) return _deferLoadsCount > 0; }
+        }
+
+        /// <summary>
+        /// Adds a placement backed by the given ad units. Showing a placement shows one of its ready ad units, with the placement name as the MAX placement.
+        /// </summary>
+        /// <param name="placement">The name of the placement, e.g. <c>"level_complete"</c>.</param>
+        /// <param name="format">The format of every ad unit of the placement.</param>
+        /// <param name="targetReadyCount">How many of the ad units to keep loaded. At most the number of ad units.</param>
+        /// <param name="priority">How urgently the placement should be loaded relative to other placements.</param>
+        /// <param name="adUnitIdentifiers">The ad units backing the placement. An ad unit can only back a single placement.</param>
+        public void AddPlacement(string placement, AdFormat format, int targetReadyCount, Priority priority, params string[] adUnitIdentifiers)
+        {
+            if (string.IsNullOrEmpty(placement) || adUnitIdentifiers == null || adUnitIdentifiers.Length == 0)
+            {
+                MaxSdkLogger.UserError("Unable to add placement to the ad inventory: a placement name and at least one ad unit identifier are required");
+                return;
+            }
+
+            lock (_lock)
+            {
+                if (_placements.ContainsKey(placement))
+                {
+                    MaxSdkLogger.UserError("Unable to add placement '" + placement + "' to the ad inventory since it was already added");
+                    return;
+                }
+
+                var newPlacement = new Placement
+                {
+                    Name = placement,
+                    Format = format,
+                    Priority = priority,
+                    TargetReadyCount = Math.Min(Math.Max(targetReadyCount, 0), adUnitIdentifiers.Length)
+                };
+
+                var now = Stopwatch.GetTimestamp();
+                foreach (var adUnitIdentifier in adUnitIdentifiers)
+                {
+                    if (string.IsNullOrEmpty(adUnitIdentifier) || _adUnits.ContainsKey(adUnitIdentifier))
+                    {
+                        MaxSdkLogger.UserError("Skipping ad unit '" + adUnitIdentifier + "' for placement '" + placement + "' since it is empty or already backs a placement");
+                        continue;
+                    }
+
+                    var adUnit = new AdUnit {AdUnitIdentifier = adUnitIdentifier, Placement = newPlacement, State = AdUnitState.Idle, NeededSinceTimestamp = now};
+                    newPlacement.AdUnits.Add(adUnit);
+                    _adUnits[adUnitIdentifier] = adUnit;
+                }
+
+                _placements[placement] = newPlacement;
+
+                // Stable, so placements with the same priority are loaded in the order they were added
+                var index = _placementsByPriority.Count;
+                while (index > 0 && _placementsByPriority[index - 1].Priority < priority)
+                {
+                    index--;
+                }
+
+                _placementsByPriority.Insert(index, newPlacement);
+            }
+
+            SubscribeIfNeeded(format);
+        }
+
+        /// <summary>
+        /// Changes how many ads a placement keeps loaded, e.g. to keep more rewarded ads around ahead of a store screen.
+        /// </summary>
+        public void SetTargetReadyCount(string placement, int targetReadyCount)
+        {
+            lock (_lock)
+            {
+                Placement existingPlacement;
+                if (!_placements.TryGetValue(placement, out existingPlacement)) return;
+
+                existingPlacement.TargetReadyCount = Math.Min(Math.Max(targetReadyCount, 0), existingPlacement.AdUnits.Count);
+            }
+        }
+
+        /// <summary>
+        /// Stops starting new loads until <see cref="ResumeLoads"/> is called the same number of times, e.g. while a critical scene is loading. Loads already in flight are not affected.
+        /// </summary>
+        public void DeferLoads()
+        {
+            lock (_lock)
+            {
+                _deferLoadsCount++;
+            }
+        }
+
+        public void ResumeLoads()
+        {
+            lock (_lock)
+            {
+                _deferLoadsCount = Math.Max(_deferLoadsCount - 1, 0);
+            }
+        }
+
+        /// <summary>
+        /// Returns whether the placement has an ad ready to show.
+        /// </summary>
+        public bool IsReady(string placement)
+        {
+            Placement existingPlacement;
+            lock (_lock)
+            {
+                if (!_placements.TryGetValue(placement, out existingPlacement)) return false;
+            }
+
+            return FindReadyAdUnit(existingPlacement) != null;
+        }
+
+        /// <summary>
+        /// Shows an ad for the placement if one is ready. Either way, the call counts towards the placement's show hit rate.
+        /// </summary>
+        /// <param name="placement">The placement to show.</param>
+        /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+        /// <returns><c>true</c> if an ad was shown.</returns>
+        public bool TryShow(string placement, string customData = null)
+        {
+            Placement existingPlacement;
+            lock (_lock)
+            {
+                if (!_placements.TryGetValue(placement, out existingPlacement))
+                {
+                    MaxSdkLogger.UserError("Unable to show placement '" + placement + "' since it was not added to the ad inventory");
+                    return false;
+                }
+            }
+
+            var adUnit = FindReadyAdUnit(existingPlacement);
+            lock (_lock)
+            {
+                // An ad event may have changed the ad unit's state since it was checked
+                if (adUnit == null || adUnit.State != AdUnitState.Ready)
+                {
+                    existingPlacement.ShowMissCount++;
+                    return false;
+                }
+
+                existingPlacement.ShowHitCount++;
+                adUnit.State = AdUnitState.Showing;
+            }
+
+            switch (adUnit.Placement.Format)
+            {
+                case AdFormat.Interstitial:
+                    MaxSdk.ShowInterstitial(adUnit.AdUnitIdentifier, placement, customData);
+                    break;
+                case AdFormat.AppOpen:
+                    MaxSdk.ShowAppOpenAd(adUnit.AdUnitIdentifier, placement, customData);
+                    break;
+                case AdFormat.Rewarded:
+                    MaxSdk.ShowRewardedAd(adUnit.AdUnitIdentifier, placement, customData);
+                    break;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Returns the stats of a placement, or <c>null</c> if it was not added.
+        /// </summary>
+        public PlacementStats GetStats(string placement)
+        {
+            lock (_lock)
+            {
+                Placement existingPlacement;
+                return _placements.TryGetValue(placement, out existingPlacement) ? new PlacementStats(existingPlacement) : null;
+            }
+        }
+
+        private void Update()
+        {
+            if (!MaxSdk.IsInitialized()) return;
+
+            CollectAdUnitsToLoad();
+
+            // Loads are started after releasing the lock, since the SDK may fire ad events synchronously
+            foreach (var adUnit in _adUnitsToLoad)
+            {
+                Load(adUnit);
+            }
+
+            _adUnitsToLoad.Clear();
+        }
+
+        private void CollectAdUnitsToLoad()
+        {
+            lock (_lock)
+            {
+                if (_deferLoadsCount > 0 || _adUnits.Count == 0) return;
+
+                var loadingCount = 0;
+                foreach (var adUnit in _adUnits.Values)
+                {
+                    if (adUnit.State == AdUnitState.Loading)
+                    {
+                        loadingCount++;
+                    }
+                }
+
+                var now = Stopwatch.GetTimestamp();
+                foreach (var placement in _placementsByPriority)
+                {
+                    if (loadingCount >= _maxConcurrentLoads) return;
+
+                    // Ads that are loading or showing count towards the target, so a placement does not load more ads than it needs
+                    var neededCount = placement.TargetReadyCount;
+                    foreach (var adUnit in placement.AdUnits)
+                    {
+                        if (adUnit.State == AdUnitState.Loading || adUnit.State == AdUnitState.Ready || adUnit.State == AdUnitState.Showing)
+                        {
+                            neededCount--;
+                        }
+                    }
+
+                    foreach (var adUnit in placement.AdUnits)
+                    {
+                        if (neededCount <= 0 || loadingCount >= _maxConcurrentLoads) break;
+
+                        var isDue = adUnit.State == AdUnitState.Idle || (adUnit.State == AdUnitState.WaitingToRetry && now >= adUnit.RetryTimestamp);
+                        if (!isDue) continue;
+
+                        adUnit.State = AdUnitState.Loading;
+                        adUnit.Placement.LoadCount++;
+                        _adUnitsToLoad.Add(adUnit);
+                        neededCount--;
+                        loadingCount++;
+                    }
+                }
+            }
+        }
+
+        private static void Load(AdUnit adUnit)
+        {
+            switch (adUnit.Placement.Format)
+            {
+                case AdFormat.Interstitial:
+                    MaxSdk.LoadInterstitial(adUnit.AdUnitIdentifier);
+                    break;
+                case AdFormat.AppOpen:
+                    MaxSdk.LoadAppOpenAd(adUnit.AdUnitIdentifier);
+                    break;
+                case AdFormat.Rewarded:
+                    MaxSdk.LoadRewardedAd(adUnit.AdUnitIdentifier);
+                    break;
+            }
+        }
+
+        /// <summary>
+        /// Returns the first ad unit of the placement that the inventory and the SDK both consider ready. Ad units the SDK no longer considers ready are
+        /// marked idle so they are loaded again. Must be called without holding the lock, since the SDK is asked about each candidate and may fire ad events synchronously.
+        /// </summary>
+        private AdUnit FindReadyAdUnit(Placement placement)
+        {
+            // A placement's ad units are only added before it is published, so they can be indexed outside the lock
+            var index = 0;
+            while (true)
+            {
+                AdUnit candidate = null;
+                lock (_lock)
+                {
+                    while (index < placement.AdUnits.Count)
+                    {
+                        var adUnit = placement.AdUnits[index++];
+                        if (adUnit.State != AdUnitState.Ready) continue;
+
+                        candidate = adUnit;
+                        break;
+                    }
+                }
+
+                if (candidate == null) return null;
+                if (IsAdReady(candidate)) return candidate;
+
+                // The SDK no longer has the ad, e.g. it expired without being reloaded, so load it again instead of counting it as ready
+                lock (_lock)
+                {
+                    if (candidate.State == AdUnitState.Ready)
+                    {
+                        candidate.State = AdUnitState.Idle;
+                        candidate.NeededSinceTimestamp = Stopwatch.GetTimestamp();
+                    }
+                }
+            }
+        }
+
+        private static bool IsAdReady(AdUnit adUnit)
+        {
+            switch (adUnit.Placement.Format)
+            {
+                case AdFormat.Interstitial:
+                    return MaxSdk.IsInterstitialReady(adUnit.AdUnitIdentifier);
+                case AdFormat.AppOpen:
+                    return MaxSdk.IsAppOpenAdReady(adUnit.AdUnitIdentifier);
+                case AdFormat.Rewarded:
+                    return MaxSdk.IsRewardedAdReady(adUnit.AdUnitIdentifier);
+                default:
+                    return false;
+            }
+        }
+
+        #region Ad Events
+
+        private void SubscribeIfNeeded(AdFormat format)
+        {
+            if (_isSubscribedToFormat[(int) format]) return;
+
+            _isSubscribedToFormat[(int) format] = true;
+            switch (format)
+            {
+                case AdFormat.Interstitial:
+                    MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += OnAdLoadedEvent;
+                    MaxSdkCallbacks.Interstitial.OnAdLoadFailedEvent += OnAdLoadFailedEvent;
+                    MaxSdkCallbacks.Interstitial.OnAdDisplayFailedEvent += OnAdDisplayFailedEvent;
+                    MaxSdkCallbacks.Interstitial.OnAdHiddenEvent += OnAdHiddenEvent;
+                    MaxSdkCallbacks.Interstitial.OnExpiredAdReloadedEvent += OnExpiredAdReloadedEvent;
+                    break;
+                case AdFormat.AppOpen:
+                    MaxSdkCallbacks.AppOpen.OnAdLoadedEvent += OnAdLoadedEvent;
+                    MaxSdkCallbacks.AppOpen.OnAdLoadFailedEvent += OnAdLoadFailedEvent;
+                    MaxSdkCallbacks.AppOpen.OnAdDisplayFailedEvent += OnAdDisplayFailedEvent;
+                    MaxSdkCallbacks.AppOpen.OnAdHiddenEvent += OnAdHiddenEvent;
+                    MaxSdkCallbacks.AppOpen.OnExpiredAdReloadedEvent += OnExpiredAdReloadedEvent;
+                    break;
+                case AdFormat.Rewarded:
+                    MaxSdkCallbacks.Rewarded.OnAdLoadedEvent += OnAdLoadedEvent;
+                    MaxSdkCallbacks.Rewarded.OnAdLoadFailedEvent += OnAdLoadFailedEvent;
+                    MaxSdkCallbacks.Rewarded.OnAdDisplayFailedEvent += OnAdDisplayFailedEvent;
+                    MaxSdkCallbacks.Rewarded.OnAdHiddenEvent += OnAdHiddenEvent;
+                    MaxSdkCallbacks.Rewarded.OnExpiredAdReloadedEvent += OnExpiredAdReloadedEvent;
+                    break;
+            }
+        }
+
+        private void OnAdLoadedEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo)
+        {
+            lock (_lock)
+            {
+                AdUnit adUnit;
+                if (!_adUnits.TryGetValue(adUnitIdentifier, out adUnit) || adUnit.State == AdUnitState.Ready) return;
+
+                var timeToReadyTicks = Stopwatch.GetTimestamp() - adUnit.NeededSinceTimestamp;
+                var placement = adUnit.Placement;
+                placement.ReadyAdCount++;
+                placement.TotalTimeToReadyTicks += timeToReadyTicks;
+                placement.MaxTimeToReadyTicks = Math.Max(placement.MaxTimeToReadyTicks, timeToReadyTicks);
+
+                adUnit.State = AdUnitState.Ready;
+                adUnit.RetryAttempt = 0;
+            }
+        }
+
+        private void OnAdLoadFailedEvent(string adUnitIdentifier, MaxSdkBase.ErrorInfo errorInfo)
+        {
+            lock (_lock)
+            {
+                AdUnit adUnit;
+                if (!_adUnits.TryGetValue(adUnitIdentifier, out adUnit)) return;
+
+                adUnit.Placement.LoadFailureCount++;
+                adUnit.RetryAttempt++;
+
+                var retryDelaySeconds = Math.Pow(2, Math.Min(adUnit.RetryAttempt, 6));
+                adUnit.State = AdUnitState.WaitingToRetry;
+                adUnit.RetryTimestamp = Stopwatch.GetTimestamp() + (long) (Math.Min(retryDelaySeconds, MaxRetryDelaySeconds) * Stopwatch.Frequency);
+            }
+        }
+
+        private void OnAdDisplayFailedEvent(string adUnitIdentifier, MaxSdkBase.ErrorInfo errorInfo, MaxSdkBase.AdInfo adInfo)
+        {
+            OnAdConsumed(adUnitIdentifier);
+        }
+
+        private void OnAdHiddenEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo)
+        {
+            OnAdConsumed(adUnitIdentifier);
+        }
+
+        private void OnExpiredAdReloadedEvent(string adUnitIdentifier, MaxSdkBase.AdInfo expiredAdInfo, MaxSdkBase.AdInfo newAdInfo)
+        {
+            // The SDK replaced an expired ad on its own, so the ad unit is still ready
+            lock (_lock)
+            {
+                AdUnit adUnit;
+                if (!_adUnits.TryGetValue(adUnitIdentifier, out adUnit) || adUnit.State == AdUnitState.Showing) return;
+
+                adUnit.State = AdUnitState.Ready;
+                adUnit.RetryAttempt = 0;
+            }
+        }
+
+        private void OnAdConsumed(string adUnitIdentifier)
+        {
+            lock (_lock)
+            {
+                AdUnit adUnit;
+                if (!_adUnits.TryGetValue(adUnitIdentifier, out adUnit)) return;
+
+                adUnit.State = AdUnitState.Idle;
+                adUnit.NeededSinceTimestamp = Stopwatch.GetTimestamp();
+            }
+        }
+
+        #endregion
+
+        private static double TicksToSeconds(long ticks)
+        {
+            return (double) ticks / Stopwatch.Frequency;
+        }
+    }
+}
@@ -0,0 +1,223 @@
+//
+//  MaxAdStateSnapshot.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.Collections.Generic;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// A managed copy of each fullscreen ad unit's readiness and of the ad values queried through <see cref="MaxSdk.GetAdValue"/>,
+    /// kept current from the ad events sent by the native plugin, so hot queries do not need to call into native code.
+    ///
+    /// Both tables are replaced rather than mutated, so reads are plain memory reads without a lock. Ad units with no entry fall back to the native plugin.
+    /// </summary>
+    internal static class MaxAdStateSnapshot
+    {
+        private enum EventAction
+        {
+            AdLoaded,           // Fullscreen ad is ready and its ad values changed
+            AdLoadFailed,       // Fullscreen ad is not ready and its ad values were cleared
+            AdConsumed,         // Fullscreen ad is no longer ready
+            AdViewAdChanged     // Banner or MREC ad values changed
+        }
+
+        private static readonly Dictionary<string, EventAction> EventActions = new Dictionary<string, EventAction>
+        {
+            {"OnBannerAdLoadedEvent", EventAction.AdViewAdChanged},
+            {"OnBannerAdLoadFailedEvent", EventAction.AdViewAdChanged},
+            {"OnMRecAdLoadedEvent", EventAction.AdViewAdChanged},
+            {"OnMRecAdLoadFailedEvent", EventAction.AdViewAdChanged},
+
+            {"OnInterstitialLoadedEvent", EventAction.AdLoaded},
+            {"OnInterstitialLoadFailedEvent", EventAction.AdLoadFailed},
+            {"OnInterstitialHiddenEvent", EventAction.AdConsumed},
+            {"OnInterstitialAdFailedToDisplayEvent", EventAction.AdConsumed},
+            {"OnExpiredInterstitialAdReloadedEvent", EventAction.AdLoaded},
+
+            {"OnAppOpenAdLoadedEvent", EventAction.AdLoaded},
+            {"OnAppOpenAdLoadFailedEvent", EventAction.AdLoadFailed},
+            {"OnAppOpenAdHiddenEvent", EventAction.AdConsumed},
+            {"OnAppOpenAdFailedToDisplayEvent", EventAction.AdConsumed},
+            {"OnExpiredAppOpenAdReloadedEvent", EventAction.AdLoaded},
+
+            {"OnRewardedAdLoadedEvent", EventAction.AdLoaded},
+            {"OnRewardedAdLoadFailedEvent", EventAction.AdLoadFailed},
+            {"OnRewardedAdHiddenEvent", EventAction.AdConsumed},
+            {"OnRewardedAdFailedToDisplayEvent", EventAction.AdConsumed},
+            {"OnExpiredRewardedAdReloadedEvent", EventAction.AdLoaded}
+        };
+
+        private static readonly object WriteLock = new object();
+        private static volatile Dictionary<string, bool> _readyAdUnits = new Dictionary<string, bool>();
+        private static volatile Dictionary<string, Dictionary<string, string>> _adValues = new Dictionary<string, Dictionary<string, string>>();
+        private static volatile bool _strictReadinessCheck;
+
+        /// <summary>
+        /// Bitmask of the events in <see cref="MaxEventCodec.EventNames"/> that keep the snapshot current. The native plugin must send these even when nobody is listening.
+        /// </summary>
+        internal static readonly ulong EventMask = CreateEventMask();
+
+        /// <summary>
+        /// Whether showing an ad asks the native plugin if the ad is ready instead of trusting the snapshot, which can lag behind native by the time it takes an event to arrive.
+        /// </summary>
+        internal static bool StrictReadinessCheck
+        {
+            get { return _strictReadinessCheck; }
+            set { _strictReadinessCheck = value; }
+        }
+
+        internal static bool TracksEvent(string eventName)
+        {
+            return eventName != null && EventActions.ContainsKey(eventName);
+        }
+
+        /// <summary>
+        /// Updates the snapshot for an ad event. Can be called from any thread.
+        /// </summary>
+        internal static void OnAdEvent(string eventName, string adUnitIdentifier)
+        {
+            EventAction action;
+            if (string.IsNullOrEmpty(adUnitIdentifier) || eventName == null || !EventActions.TryGetValue(eventName, out action)) return;
+
+            lock (WriteLock)
+            {
+                switch (action)
+                {
+                    case EventAction.AdLoaded:
+                        SetReadyLocked(adUnitIdentifier, true);
+                        RemoveAdValuesLocked(adUnitIdentifier);
+                        break;
+                    case EventAction.AdLoadFailed:
+                        SetReadyLocked(adUnitIdentifier, false);
+                        RemoveAdValuesLocked(adUnitIdentifier);
+                        break;
+                    case EventAction.AdConsumed:
+                        SetReadyLocked(adUnitIdentifier, false);
+                        break;
+                    case EventAction.AdViewAdChanged:
+                        RemoveAdValuesLocked(adUnitIdentifier);
+                        break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns <c>false</c> if the snapshot does not know whether the ad unit is ready, in which case the caller should ask the native plugin.
+        /// </summary>
+        internal static bool TryGetReady(string adUnitIdentifier, out bool isReady)
+        {
+            if (adUnitIdentifier == null)
+            {
+                isReady = false;
+                return false;
+            }
+
+            return _readyAdUnits.TryGetValue(adUnitIdentifier, out isReady);
+        }
+
+        /// <summary>
+        /// Forgets the readiness of an ad unit that is about to load, since loading an ad unit that is already ready may not send another event.
+        /// </summary>
+        internal static void OnLoad(string adUnitIdentifier)
+        {
+            if (adUnitIdentifier == null) return;
+
+            lock (WriteLock)
+            {
+                if (!_readyAdUnits.ContainsKey(adUnitIdentifier)) return;
+
+                var readyAdUnits = new Dictionary<string, bool>(_readyAdUnits);
+                readyAdUnits.Remove(adUnitIdentifier);
+                _readyAdUnits = readyAdUnits;
+            }
+        }
+
+        /// <summary>
+        /// Marks an ad unit as not ready as soon as it is shown, so it is not shown twice before the native plugin reports the ad was hidden.
+        /// </summary>
+        internal static void OnShow(string adUnitIdentifier)
+        {
+            if (adUnitIdentifier == null) return;
+
+            lock (WriteLock)
+            {
+                SetReadyLocked(adUnitIdentifier, false);
+            }
+        }
+
+        internal static bool TryGetAdValue(string adUnitIdentifier, string key, out string value)
+        {
+            value = null;
+            if (adUnitIdentifier == null || key == null) return false;
+
+            Dictionary<string, string> adValues;
+            return _adValues.TryGetValue(adUnitIdentifier, out adValues) && adValues.TryGetValue(key, out value);
+        }
+
+        /// <summary>
+        /// Remembers an ad value returned by the native plugin until the ad unit loads a different ad. Missing values are not remembered.
+        /// </summary>
+        internal static void SetAdValue(string adUnitIdentifier, string key, string value)
+        {
+            if (adUnitIdentifier == null || key == null || string.IsNullOrEmpty(value)) return;
+
+            lock (WriteLock)
+            {
+                Dictionary<string, string> currentAdValues;
+                var adValues = _adValues.TryGetValue(adUnitIdentifier, out currentAdValues) ? new Dictionary<string, string>(currentAdValues) : new Dictionary<string, string>();
+                adValues[key] = value;
+
+                var allAdValues = new Dictionary<string, Dictionary<string, string>>(_adValues);
+                allAdValues[adUnitIdentifier] = adValues;
+                _adValues = allAdValues;
+            }
+        }
+
+        internal static void Reset()
+        {
+            lock (WriteLock)
+            {
+                _readyAdUnits = new Dictionary<string, bool>();
+                _adValues = new Dictionary<string, Dictionary<string, string>>();
+            }
+        }
+
+        private static void SetReadyLocked(string adUnitIdentifier, bool isReady)
+        {
+            bool currentIsReady;
+            if (_readyAdUnits.TryGetValue(adUnitIdentifier, out currentIsReady) && currentIsReady == isReady) return;
+
+            var readyAdUnits = new Dictionary<string, bool>(_readyAdUnits);
+            readyAdUnits[adUnitIdentifier] = isReady;
+            _readyAdUnits = readyAdUnits;
+        }
+
+        private static void RemoveAdValuesLocked(string adUnitIdentifier)
+        {
+            if (!_adValues.ContainsKey(adUnitIdentifier)) return;
+
+            var allAdValues = new Dictionary<string, Dictionary<string, string>>(_adValues);
+            allAdValues.Remove(adUnitIdentifier);
+            _adValues = allAdValues;
+        }
+
+        private static ulong CreateEventMask()
+        {
+            ulong mask = 0;
+            foreach (var eventName in EventActions.Keys)
+            {
+                var eventId = MaxEventCodec.EventIdForName(eventName);
+                if (eventId > 0)
+                {
+                    mask |= 1UL << eventId;
+                }
+            }
+
+            return mask;
+        }
+    }
+}
@@ -0,0 +1,247 @@
+//
+//  MaxCallbackPayloadPool.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Text;
+using System.Threading;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Implemented by callback payloads that can be reused by <see cref="MaxCallbackPayloadPool"/>.
+    /// </summary>
+    internal interface IMaxPooledPayload
+    {
+        /// <summary>
+        /// Whether the payload was rented from the pool and has not been recycled, retained or poisoned since.
+        /// </summary>
+        bool IsPooled { get; }
+
+        bool IsRetained { get; }
+
+        /// <summary>
+        /// Adds an owner. The payload is recycled once every owner has released it.
+        /// </summary>
+        void AddReference();
+
+        /// <summary>
+        /// Removes an owner and returns the number of owners left.
+        /// </summary>
+        int ReleaseReference();
+
+        /// <summary>
+        /// Detaches the payload from the pool and overwrites its fields so that reading it after the callback is easy to spot.
+        /// </summary>
+        void Poison();
+
+        /// <summary>
+        /// Marks the payload as no longer rented, either because it is going back to the pool or because it now belongs to the garbage collector.
+        /// </summary>
+        void Detach();
+    }
+
+    /// <summary>
+    /// Reuses the <see cref="MaxSdkBase.AdInfo"/> and <see cref="MaxSdkBase.ErrorInfo"/> objects passed to ad event callbacks while
+    /// <see cref="MaxSdkBase.PooledCallbackPayloadsEnabled"/> is set. See that property for the lifetime contract.
+    ///
+    /// A rented payload is owned by the callback that forwards it, and by the main thread queue while it waits there. It is recycled once both
+    /// have released it, unless a listener retained it. Strings decoded from binary events are interned while pooling is enabled, so repeated
+    /// values such as ad unit identifiers and network names do not allocate either.
+    /// </summary>
+    internal static class MaxCallbackPayloadPool
+    {
+        internal const string PoisonedString = "<recycled MAX callback payload>";
+
+        private const int Capacity = 16;
+        private const int StringCacheSize = 256;
+        private const int MaxInternedStringLength = 128;
+
+        private static volatile bool _enabled;
+        private static volatile bool _poisonRecycled;
+
+        private static readonly object PoolLock = new object();
+        private static readonly MaxSdkBase.AdInfo[] AdInfos = new MaxSdkBase.AdInfo[Capacity];
+        private static readonly MaxSdkBase.ErrorInfo[] ErrorInfos = new MaxSdkBase.ErrorInfo[Capacity];
+        private static int _adInfoCount;
+        private static int _errorInfoCount;
+
+        // Direct-mapped by the hash of the UTF-8 bytes. Entries are immutable, so slots can be read and replaced without a lock.
+        private static readonly InternedString[] StringCache = new InternedString[StringCacheSize];
+
+        private sealed class InternedString
+        {
+            public readonly byte[] Bytes;
+            public readonly string Value;
+
+            public InternedString(byte[] bytes, string value)
+            {
+                Bytes = bytes;
+                Value = value;
+            }
+        }
+
+        internal static bool IsEnabled
+        {
+            get { return _enabled; }
+            set { _enabled = value; }
+        }
+
+        internal static bool PoisonRecycled
+        {
+            get { return _poisonRecycled; }
+            set { _poisonRecycled = value; }
+        }
+
+        internal static MaxSdkBase.AdInfo RentAdInfo(MaxEventReader reader)
+        {
+            if (!_enabled) return new MaxSdkBase.AdInfo(reader);
+
+            MaxSdkBase.AdInfo adInfo = null;
+            lock (PoolLock)
+            {
+                if (_adInfoCount > 0)
+                {
+                    _adInfoCount--;
+                    adInfo = AdInfos[_adInfoCount];
+                    AdInfos[_adInfoCount] = null;
+                }
+            }
+
+            if (adInfo == null)
+            {
+                adInfo = new MaxSdkBase.AdInfo();
+            }
+
+            adInfo.Initialize(reader, true);
+            return adInfo;
+        }
+
+        internal static MaxSdkBase.ErrorInfo RentErrorInfo(MaxEventReader reader)
+        {
+            if (!_enabled) return new MaxSdkBase.ErrorInfo(reader);
+
+            MaxSdkBase.ErrorInfo errorInfo = null;
+            lock (PoolLock)
+            {
+                if (_errorInfoCount > 0)
+                {
+                    _errorInfoCount--;
+                    errorInfo = ErrorInfos[_errorInfoCount];
+                    ErrorInfos[_errorInfoCount] = null;
+                }
+            }
+
+            if (errorInfo == null)
+            {
+                errorInfo = new MaxSdkBase.ErrorInfo();
+            }
+
+            errorInfo.Initialize(reader, true);
+            return errorInfo;
+        }
+
+        /// <summary>
+        /// Adds an owner to <paramref name="payload"/> if it is a pooled payload. Does nothing otherwise.
+        /// </summary>
+        internal static void AddReference(object payload)
+        {
+            var pooledPayload = payload as IMaxPooledPayload;
+            if (pooledPayload == null || !pooledPayload.IsPooled) return;
+
+            pooledPayload.AddReference();
+        }
+
+        /// <summary>
+        /// Removes an owner from <paramref name="payload"/> if it is a pooled payload, and recycles it once it has no owners left. Does nothing otherwise.
+        /// </summary>
+        internal static void Release(object payload)
+        {
+            var pooledPayload = payload as IMaxPooledPayload;
+            if (pooledPayload == null || !pooledPayload.IsPooled) return;
+
+            if (pooledPayload.ReleaseReference() > 0) return;
+
+            if (pooledPayload.IsRetained)
+            {
+                pooledPayload.Detach();
+            }
+            else if (_poisonRecycled)
+            {
+                // Poisoned payloads are never reused, so a stale reference keeps reading the poisoned values instead of another event's
+                pooledPayload.Poison();
+            }
+            else
+            {
+                Return(pooledPayload);
+            }
+        }
+
+        /// <summary>
+        /// Returns the string for the UTF-8 bytes, reusing the instance returned for the same bytes before if it is still cached.
+        /// </summary>
+        internal static string InternString(byte[] bytes, int offset, int length)
+        {
+            if (length > MaxInternedStringLength) return Encoding.UTF8.GetString(bytes, offset, length);
+
+            var hash = 2166136261u;
+            for (var i = offset; i < offset + length; i++)
+            {
+                hash = (hash ^ bytes[i]) * 16777619u;
+            }
+
+            var slot = (int) (hash % StringCacheSize);
+            var internedString = Volatile.Read(ref StringCache[slot]);
+            if (internedString != null && BytesEqual(internedString.Bytes, bytes, offset, length)) return internedString.Value;
+
+            var internedBytes = new byte[length];
+            Buffer.BlockCopy(bytes, offset, internedBytes, 0, length);
+            var value = Encoding.UTF8.GetString(bytes, offset, length);
+            Volatile.Write(ref StringCache[slot], new InternedString(internedBytes, value));
+
+            return value;
+        }
+
+        private static void Return(IMaxPooledPayload pooledPayload)
+        {
+            pooledPayload.Detach();
+
+            var adInfo = pooledPayload as MaxSdkBase.AdInfo;
+            var errorInfo = pooledPayload as MaxSdkBase.ErrorInfo;
+
+            lock (PoolLock)
+            {
+                if (adInfo != null && _adInfoCount < Capacity)
+                {
+                    AdInfos[_adInfoCount] = adInfo;
+                    _adInfoCount++;
+                    return;
+                }
+
+                if (errorInfo != null && _errorInfoCount < Capacity)
+                {
+                    ErrorInfos[_errorInfoCount] = errorInfo;
+                    _errorInfoCount++;
+                    return;
+                }
+            }
+
+            // The pool is full, leave the payload to the garbage collector
+        }
+
+        private static bool BytesEqual(byte[] internedBytes, byte[] bytes, int offset, int length)
+        {
+            if (internedBytes.Length != length) return false;
+
+            for (var i = 0; i < length; i++)
+            {
+                if (internedBytes[i] != bytes[offset + i]) return false;
+            }
+
+            return true;
+        }
+    }
+}
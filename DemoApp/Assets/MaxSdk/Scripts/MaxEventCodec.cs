@@ -0,0 +1,567 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Text;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Decoder for the compact binary ad event encoding produced by <c>MAUnityEventCodec.c</c>.
+    ///
+    /// Ad events decoded from this format are materialized directly into <see cref="MaxSdkBase.AdInfo"/> and <see cref="MaxSdkBase.ErrorInfo"/>
+    /// without building an intermediate JSON dictionary. See <c>MAUnityEventCodec.h</c> for the frame layout.
+    /// </summary>
+    internal static class MaxEventCodec
+    {
+        internal const byte Version = 1;
+        internal const int HeaderSize = 8;
+        internal const byte FlagKeepInBackground = 0x01;
+
+        // NOTE: Must be kept in sync with `MAX_UNITY_EVENT_PAYLOAD_VERSION_*` in MAUnityEventCodec.h
+        // The payload version reported to the native plugin. From version 2, numeric values such as revenue and latencies are sent as numbers instead of strings.
+        internal const int PayloadVersion = 2;
+
+        internal const byte ValueTypeNone = 0;
+        internal const byte ValueTypeString = 1;
+        internal const byte ValueTypeDouble = 2;
+        internal const byte ValueTypeInt64 = 3;
+        internal const byte ValueTypeBool = 4;
+        internal const byte ValueTypeObject = 5;
+        internal const byte ValueTypeList = 6;
+        internal const byte ValueTypeMap = 7;
+
+        // NOTE: Must be kept in sync with `max_unity_field_id` in MAUnityEventCodec.h
+        internal const byte FieldNone = 0;
+        internal const byte FieldAdUnitId = 1;
+        internal const byte FieldAdFormat = 2;
+        internal const byte FieldNetworkName = 3;
+        internal const byte FieldNetworkPlacement = 4;
+        internal const byte FieldCreativeId = 5;
+        internal const byte FieldPlacement = 6;
+        internal const byte FieldRevenue = 7;
+        internal const byte FieldRevenuePrecision = 8;
+        internal const byte FieldWaterfallInfo = 9;
+        internal const byte FieldLatencyMillis = 10;
+        internal const byte FieldDspName = 11;
+        internal const byte FieldErrorCode = 12;
+        internal const byte FieldErrorMessage = 13;
+        internal const byte FieldMediatedNetworkErrorCode = 14;
+        internal const byte FieldMediatedNetworkErrorMessage = 15;
+        internal const byte FieldAdLoadFailureInfo = 16;
+        internal const byte FieldRewardLabel = 17;
+        internal const byte FieldRewardAmount = 18;
+        internal const byte FieldAdReviewCreativeId = 19;
+        internal const byte FieldExpiredAdInfo = 20;
+        internal const byte FieldNewAdInfo = 21;
+        internal const byte FieldName = 22;
+        internal const byte FieldTestName = 23;
+        internal const byte FieldNetworkResponses = 24;
+        internal const byte FieldAdLoadState = 25;
+        internal const byte FieldMediatedNetwork = 26;
+        internal const byte FieldCredentials = 27;
+        internal const byte FieldIsBidding = 28;
+        internal const byte FieldError = 29;
+        internal const byte FieldAdapterClassName = 30;
+        internal const byte FieldAdapterVersion = 31;
+        internal const byte FieldSdkVersion = 32;
+        internal const byte FieldInitializationStatus = 33;
+        internal const byte FieldOriginX = 34;
+        internal const byte FieldOriginY = 35;
+        internal const byte FieldWidth = 36;
+        internal const byte FieldHeight = 37;
+
+        // NOTE: Indexed by field id. Must be kept in sync with `max_unity_field_descriptors` in MAUnityEventCodec.c
+        private static readonly string[] FieldKeys =
+        {
+            null,
+            "adUnitId",
+            "adFormat",
+            "networkName",
+            "networkPlacement",
+            "creativeId",
+            "placement",
+            "revenue",
+            "revenuePrecision",
+            "waterfallInfo",
+            "latencyMillis",
+            "dspName",
+            "errorCode",
+            "errorMessage",
+            "mediatedNetworkErrorCode",
+            "mediatedNetworkErrorMessage",
+            "adLoadFailureInfo",
+            "rewardLabel",
+            "rewardAmount",
+            "adReviewCreativeId",
+            "expiredAdInfo",
+            "newAdInfo",
+            "name",
+            "testName",
+            "networkResponses",
+            "adLoadState",
+            "mediatedNetwork",
+            "credentials",
+            "isBidding",
+            "error",
+            "adapterClassName",
+            "adapterVersion",
+            "sdkVersion",
+            "initializationStatus",
+            "origin_x",
+            "origin_y",
+            "width",
+            "height"
+        };
+
+        // NOTE: Indexed by `max_unity_event_id` in MAUnityEventCodec.h
+        internal static readonly string[] EventNames =
+        {
+            null,
+
+            "OnBannerAdLoadedEvent",
+            "OnBannerAdLoadFailedEvent",
+            "OnBannerAdClickedEvent",
+            "OnBannerAdRevenuePaidEvent",
+            "OnBannerAdReviewCreativeIdGeneratedEvent",
+            "OnBannerAdExpandedEvent",
+            "OnBannerAdCollapsedEvent",
+
+            "OnMRecAdLoadedEvent",
+            "OnMRecAdLoadFailedEvent",
+            "OnMRecAdClickedEvent",
+            "OnMRecAdRevenuePaidEvent",
+            "OnMRecAdReviewCreativeIdGeneratedEvent",
+            "OnMRecAdExpandedEvent",
+            "OnMRecAdCollapsedEvent",
+
+            "OnInterstitialLoadedEvent",
+            "OnInterstitialLoadFailedEvent",
+            "OnInterstitialHiddenEvent",
+            "OnInterstitialDisplayedEvent",
+            "OnInterstitialAdFailedToDisplayEvent",
+            "OnInterstitialClickedEvent",
+            "OnInterstitialAdRevenuePaidEvent",
+            "OnInterstitialAdReviewCreativeIdGeneratedEvent",
+
+            "OnAppOpenAdLoadedEvent",
+            "OnAppOpenAdLoadFailedEvent",
+            "OnAppOpenAdHiddenEvent",
+            "OnAppOpenAdDisplayedEvent",
+            "OnAppOpenAdFailedToDisplayEvent",
+            "OnAppOpenAdClickedEvent",
+            "OnAppOpenAdRevenuePaidEvent",
+
+            "OnRewardedAdLoadedEvent",
+            "OnRewardedAdLoadFailedEvent",
+            "OnRewardedAdDisplayedEvent",
+            "OnRewardedAdHiddenEvent",
+            "OnRewardedAdClickedEvent",
+            "OnRewardedAdRevenuePaidEvent",
+            "OnRewardedAdReviewCreativeIdGeneratedEvent",
+            "OnRewardedAdFailedToDisplayEvent",
+            "OnRewardedAdReceivedRewardEvent",
+
+            "OnExpiredInterstitialAdReloadedEvent",
+            "OnExpiredAppOpenAdReloadedEvent",
+            "OnExpiredRewardedAdReloadedEvent",
+
+            "OnBannerAdLayoutChangedEvent",
+            "OnMRecAdLayoutChangedEvent"
+        };
+
+        private static readonly Dictionary<string, int> EventIds = CreateEventIds();
+
+        /// <summary>
+        /// Returns the event id for <paramref name="eventName"/>, or <c>0</c> if the event does not have one.
+        /// </summary>
+        internal static int EventIdForName(string eventName)
+        {
+            int eventId;
+            return eventName != null && EventIds.TryGetValue(eventName, out eventId) ? eventId : 0;
+        }
+
+        private static Dictionary<string, int> CreateEventIds()
+        {
+            var eventIds = new Dictionary<string, int>(EventNames.Length, StringComparer.Ordinal);
+            for (var i = 1; i < EventNames.Length; i++)
+            {
+                eventIds[EventNames[i]] = i;
+            }
+
+            return eventIds;
+        }
+
+        /// <summary>
+        /// Returns the length of the frame starting at <paramref name="offset"/>, or <c>0</c> if the remaining <paramref name="length"/> bytes do not hold a complete frame.
+        /// The native plugin may send several frames back to back in one buffer.
+        /// </summary>
+        internal static int GetFrameLength(byte[] bytes, int offset, int length)
+        {
+            if (bytes == null || offset < 0 || length < HeaderSize || offset + length > bytes.Length) return 0;
+
+            var frameLength = MaxEventReader.ReadInt32(bytes, offset);
+            return frameLength >= HeaderSize && frameLength <= length ? frameLength : 0;
+        }
+
+        /// <summary>
+        /// Validates the header of the frame starting at <paramref name="offset"/> and returns a reader positioned at its first top-level field.
+        /// </summary>
+        internal static bool TryOpen(byte[] bytes, int offset, int length, out string eventName, out bool keepInBackground, out MaxEventReader reader)
+        {
+            eventName = null;
+            keepInBackground = false;
+            reader = default(MaxEventReader);
+
+            var frameLength = GetFrameLength(bytes, offset, length);
+            if (frameLength == 0) return false;
+            if (bytes[offset + 4] != Version) return false;
+
+            var eventId = bytes[offset + 6] | (bytes[offset + 7] << 8);
+            if (eventId <= 0 || eventId >= EventNames.Length) return false;
+
+            eventName = EventNames[eventId];
+            keepInBackground = (bytes[offset + 5] & FlagKeepInBackground) != 0;
+            reader = new MaxEventReader(bytes, offset + HeaderSize, offset + frameLength);
+            return true;
+        }
+
+        /// <summary>
+        /// Returns the field id for the payload key stored in <paramref name="source"/> at the given range, or <see cref="FieldNone"/> if the key is not known.
+        /// Used by <see cref="MaxJsonReader"/> to map JSON property names onto the same field ids as the binary encoding without allocating the name.
+        /// </summary>
+        internal static byte FieldForKey(string source, int start, int length)
+        {
+            for (var fieldId = 1; fieldId < FieldKeys.Length; fieldId++)
+            {
+                var key = FieldKeys[fieldId];
+                if (key.Length == length && string.CompareOrdinal(source, start, key, 0, length) == 0) return (byte) fieldId;
+            }
+
+            return FieldNone;
+        }
+    }
+
+    /// <summary>
+    /// Forward-only cursor over the fields of a binary encoded event, or of a single OBJECT, LIST or MAP value within it.
+    /// A cursor can also wrap a <see cref="MaxJsonReader"/>, in which case JSON property names are mapped onto the same field ids,
+    /// so the payload types decode both encodings with the same code.
+    ///
+    /// This is a struct so a payload type can take its own copy of the cursor and scan for the fields it needs
+    /// without affecting the position of the caller.
+    /// </summary>
+    internal struct MaxEventReader
+    {
+        private readonly byte[] _bytes;
+        private readonly int _end;
+        private int _position;
+        private int _valueOffset;
+        private int _valueLength;
+        private MaxJsonReader _jsonReader;
+        private readonly bool _isJson;
+
+        internal byte FieldId { get; private set; }
+        internal byte ValueType { get; private set; }
+
+        internal MaxEventReader(byte[] bytes, int start, int end) : this()
+        {
+            _bytes = bytes;
+            _position = start;
+            _end = end;
+        }
+
+        internal MaxEventReader(MaxJsonReader jsonReader) : this()
+        {
+            _jsonReader = jsonReader;
+            _isJson = true;
+        }
+
+        /// <summary>
+        /// Advances to the next field. Returns <c>false</c> at the end of the current container or if the data is malformed.
+        /// </summary>
+        internal bool MoveNext()
+        {
+            if (_isJson)
+            {
+                if (!_jsonReader.MoveNext()) return false;
+
+                FieldId = _jsonReader.GetFieldId();
+                ValueType = _jsonReader.ValueType;
+                return true;
+            }
+
+            if (_bytes == null || _position + 2 > _end) return false;
+
+            var fieldId = _bytes[_position];
+            var valueType = _bytes[_position + 1];
+            var position = _position + 2;
+
+            int length;
+            switch (valueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                case MaxEventCodec.ValueTypeObject:
+                case MaxEventCodec.ValueTypeList:
+                case MaxEventCodec.ValueTypeMap:
+                    if (position + 4 > _end) return false;
+
+                    length = ReadInt32(_bytes, position);
+                    position += 4;
+                    break;
+                case MaxEventCodec.ValueTypeDouble:
+                case MaxEventCodec.ValueTypeInt64:
+                    length = 8;
+                    break;
+                case MaxEventCodec.ValueTypeBool:
+                    length = 1;
+                    break;
+                default:
+                    return false;
+            }
+
+            if (length < 0 || length > _end - position) return false;
+
+            FieldId = fieldId;
+            ValueType = valueType;
+            _valueOffset = position;
+            _valueLength = length;
+            _position = position + length;
+            return true;
+        }
+
+        internal string ReadString()
+        {
+            if (_isJson) return _jsonReader.ReadString();
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                    if (_valueLength == 0) return "";
+
+                    return MaxCallbackPayloadPool.IsEnabled ? MaxCallbackPayloadPool.InternString(_bytes, _valueOffset, _valueLength) : Encoding.UTF8.GetString(_bytes, _valueOffset, _valueLength);
+                case MaxEventCodec.ValueTypeDouble:
+                    return ReadDouble().ToString(CultureInfo.InvariantCulture);
+                case MaxEventCodec.ValueTypeInt64:
+                    return ReadLong().ToString(CultureInfo.InvariantCulture);
+                case MaxEventCodec.ValueTypeBool:
+                    return ReadBool() ? "true" : "false";
+                default:
+                    return "";
+            }
+        }
+
+        internal double ReadDouble(double defaultValue = 0)
+        {
+            if (_isJson) return _jsonReader.ReadDouble(defaultValue);
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeDouble:
+                    return BitConverter.Int64BitsToDouble(ReadInt64(_bytes, _valueOffset));
+                case MaxEventCodec.ValueTypeInt64:
+                    return ReadInt64(_bytes, _valueOffset);
+                case MaxEventCodec.ValueTypeString:
+                    double value;
+                    return double.TryParse(ReadString(), NumberStyles.Any, CultureInfo.InvariantCulture, out value) ? value : defaultValue;
+                default:
+                    return defaultValue;
+            }
+        }
+
+        internal long ReadLong(long defaultValue = 0)
+        {
+            if (_isJson) return _jsonReader.ReadLong(defaultValue);
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeInt64:
+                    return ReadInt64(_bytes, _valueOffset);
+                case MaxEventCodec.ValueTypeDouble:
+                    return (long) BitConverter.Int64BitsToDouble(ReadInt64(_bytes, _valueOffset));
+                case MaxEventCodec.ValueTypeBool:
+                    return ReadBool() ? 1 : 0;
+                case MaxEventCodec.ValueTypeString:
+                    long value;
+                    return long.TryParse(ReadString(), NumberStyles.Any, CultureInfo.InvariantCulture, out value) ? value : defaultValue;
+                default:
+                    return defaultValue;
+            }
+        }
+
+        internal int ReadInt(int defaultValue = 0)
+        {
+            return (int) ReadLong(defaultValue);
+        }
+
+        internal bool ReadBool()
+        {
+            if (_isJson) return _jsonReader.ReadBool();
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeBool:
+                    return _bytes[_valueOffset] != 0;
+                case MaxEventCodec.ValueTypeInt64:
+                    return ReadInt64(_bytes, _valueOffset) != 0;
+                case MaxEventCodec.ValueTypeString:
+                    bool value;
+                    return bool.TryParse(ReadString(), out value) && value;
+                default:
+                    return false;
+            }
+        }
+
+        /// <summary>
+        /// Returns a cursor over the contents of the current OBJECT, LIST or MAP value. For any other value type the returned cursor is empty.
+        /// </summary>
+        internal MaxEventReader ReadContainer()
+        {
+            if (_isJson) return new MaxEventReader(_jsonReader.ReadContainer());
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeObject:
+                case MaxEventCodec.ValueTypeList:
+                case MaxEventCodec.ValueTypeMap:
+                    return new MaxEventReader(_bytes, _valueOffset, _valueOffset + _valueLength);
+                default:
+                    return default(MaxEventReader);
+            }
+        }
+
+        /// <summary>
+        /// Same as <see cref="ReadContainer"/>, but the returned cursor stays valid after this event's buffer is reused for the next event.
+        /// Binary payloads are copied into a shared block, JSON payloads are immutable strings and are shared as-is.
+        /// </summary>
+        internal MaxEventReader ReadRetainedContainer()
+        {
+            if (_isJson) return ReadContainer();
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeObject:
+                case MaxEventCodec.ValueTypeList:
+                case MaxEventCodec.ValueTypeMap:
+                    return RetainBytes(_bytes, _valueOffset, _valueLength);
+                default:
+                    return default(MaxEventReader);
+            }
+        }
+
+        /// <summary>
+        /// Same as <see cref="ReadRetainedContainer()"/>, but copies binary payloads into <paramref name="buffer"/>, which is only replaced if it is too small.
+        /// Used by pooled payloads, which own their buffer and only reuse it once they are recycled.
+        /// </summary>
+        internal MaxEventReader ReadRetainedContainer(ref byte[] buffer)
+        {
+            if (_isJson) return ReadContainer();
+
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeObject:
+                case MaxEventCodec.ValueTypeList:
+                case MaxEventCodec.ValueTypeMap:
+                    if (buffer == null || buffer.Length < _valueLength)
+                    {
+                        buffer = new byte[_valueLength];
+                    }
+
+                    Buffer.BlockCopy(_bytes, _valueOffset, buffer, 0, _valueLength);
+                    return new MaxEventReader(buffer, 0, _valueLength);
+                default:
+                    return default(MaxEventReader);
+            }
+        }
+
+        /// <summary>
+        /// Reads the current MAP value into a dictionary, with values boxed the same way MiniJSON boxes them (string, long, double, bool,
+        /// or a nested dictionary or list).
+        /// </summary>
+        internal Dictionary<string, object> ReadMap()
+        {
+            if (_isJson) return _jsonReader.ReadMap();
+
+            var map = new Dictionary<string, object>();
+            var entries = ReadContainer();
+            while (entries.MoveNext())
+            {
+                var key = entries.ReadString();
+                if (!entries.MoveNext()) break;
+
+                map[key] = entries.ReadBoxedValue();
+            }
+
+            return map;
+        }
+
+        private object ReadBoxedValue()
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeDouble:
+                    return ReadDouble();
+                case MaxEventCodec.ValueTypeInt64:
+                    return ReadLong();
+                case MaxEventCodec.ValueTypeBool:
+                    return ReadBool();
+                case MaxEventCodec.ValueTypeMap:
+                    return ReadMap();
+                case MaxEventCodec.ValueTypeList:
+                    var list = new List<object>();
+                    var items = ReadContainer();
+                    while (items.MoveNext())
+                    {
+                        list.Add(items.ReadBoxedValue());
+                    }
+
+                    return list;
+                default:
+                    return ReadString();
+            }
+        }
+
+        // Retained copies are appended to a per-thread block that is never written over, so a copy stays valid for as long as it is referenced
+        // and a new block is only allocated once the current one is full, rather than one array per event.
+        private const int RetainedBlockSize = 32 * 1024;
+        private const int MaxRetainedBlockCopyLength = RetainedBlockSize / 4;
+
+        [ThreadStatic] private static byte[] _retainedBlock;
+        [ThreadStatic] private static int _retainedBlockPosition;
+
+        private static MaxEventReader RetainBytes(byte[] bytes, int offset, int length)
+        {
+            // Large payloads would use up a block after a few events, so they get an array of their own
+            if (length > MaxRetainedBlockCopyLength)
+            {
+                var copy = new byte[length];
+                Buffer.BlockCopy(bytes, offset, copy, 0, length);
+                return new MaxEventReader(copy, 0, length);
+            }
+
+            var block = _retainedBlock;
+            if (block == null || RetainedBlockSize - _retainedBlockPosition < length)
+            {
+                block = new byte[RetainedBlockSize];
+                _retainedBlock = block;
+                _retainedBlockPosition = 0;
+            }
+
+            var start = _retainedBlockPosition;
+            Buffer.BlockCopy(bytes, offset, block, start, length);
+            _retainedBlockPosition = start + length;
+
+            return new MaxEventReader(block, start, start + length);
+        }
+
+        internal static int ReadInt32(byte[] bytes, int offset)
+        {
+            return bytes[offset] | (bytes[offset + 1] << 8) | (bytes[offset + 2] << 16) | (bytes[offset + 3] << 24);
+        }
+
+        private static long ReadInt64(byte[] bytes, int offset)
+        {
+            var low = (uint) ReadInt32(bytes, offset);
+            var high = (uint) ReadInt32(bytes, offset + 4);
+            return (long) (((ulong) high << 32) | low);
+        }
+    }
+}
@@ -7,7 +7,8 @@
 //
 
 using System;
-using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
 using UnityEngine;
 using UnityEngine.Events;
 
@@ -15,22 +16,23 @@ namespace AppLovinMax.Internal
 {
     public class MaxEventExecutor : MonoBehaviour
     {
+        private const int AdEventsQueueCapacity = 256;
+
         private static MaxEventExecutor _instance;
-        private static readonly List<MaxAction> AdEventsQueue = new List<MaxAction>();
+        private static readonly MaxEventQueue AdEventsQueue = new MaxEventQueue(AdEventsQueueCapacity);
 
-        private static volatile bool _adEventsQueueEmpty = true;
+        // Events are moved out of the queue into this buffer before being scheduled, so producers can keep enqueueing while callbacks run. Only accessed on the main thread.
+        private static MaxQueuedEvent[] _dequeuedEvents = new MaxQueuedEvent[AdEventsQueueCapacity];
 
-        struct MaxAction
-        {
-            public readonly Action ActionToExecute;
-            public readonly string EventName;
+        // Events waiting to be dispatched, indexed by MaxEventPriority. Only accessed on the main thread.
+        private static readonly PendingEvents[] PendingEventsByPriority = {new PendingEvents(), new PendingEvents(), new PendingEvents()};
 
-            public MaxAction(Action actionToExecute, string nameOfEvent)
-            {
-                ActionToExecute = actionToExecute;
-                EventName = nameOfEvent;
-            }
-        }
+        private static long _frameBudgetTicks;
+
+        // Dispatch stats. Only updated on the main thread.
+        private static long _dispatchedEventCount;
+        private static long _deferredEventCount;
+        private static long _maxQueueAgeTicks;
 
         public static void InitializeIfNeeded()
         {
@@ -57,52 +59,258 @@ namespace AppLovinMax.Internal
 
         public static void ExecuteOnMainThread(Action action, string eventName)
         {
-            lock (AdEventsQueue)
+            Enqueue(MaxActionInvoker.Instance, action, eventName);
+        }
+
+        public static void InvokeOnMainThread(UnityEvent unityEvent, string eventName)
+        {
+            Enqueue(MaxUnityEventInvoker.Instance, unityEvent, eventName);
+        }
+
+        #endregion
+
+        #region Internal
+
+        /// <summary>
+        /// The time callbacks may take per frame before the remaining events are deferred to the next frame, or <c>0</c> to dispatch every queued event each frame.
+        ///
+        /// Urgent events (rewards, display failures) are always dispatched. Revenue and review creative ID events are deferred first.
+        /// While a budget is set, events are dispatched by priority rather than strictly in the order they were received.
+        /// </summary>
+        internal static double FrameBudgetMilliseconds
+        {
+            get { return Interlocked.Read(ref _frameBudgetTicks) * 1000.0 / Stopwatch.Frequency; }
+            set { Interlocked.Exchange(ref _frameBudgetTicks, value > 0 ? (long) (value * Stopwatch.Frequency / 1000.0) : 0); }
+        }
+
+        /// <summary>
+        /// Returns a snapshot of the dispatch stats. Should be called from the main thread.
+        /// </summary>
+        internal static MaxSdkBase.EventDispatchStats GetDispatchStats()
+        {
+            var pendingEventCount = 0;
+            var oldestEnqueueTimestamp = long.MaxValue;
+            foreach (var pendingEvents in PendingEventsByPriority)
             {
-                AdEventsQueue.Add(new MaxAction(action, eventName));
-                _adEventsQueueEmpty = false;
+                pendingEventCount += pendingEvents.Count;
+                if (pendingEvents.Count > 0)
+                {
+                    oldestEnqueueTimestamp = Math.Min(oldestEnqueueTimestamp, pendingEvents.Peek().EnqueueTimestamp);
+                }
             }
+
+            var oldestPendingEventAgeTicks = pendingEventCount > 0 ? Stopwatch.GetTimestamp() - oldestEnqueueTimestamp : 0;
+            return new MaxSdkBase.EventDispatchStats(_dispatchedEventCount, _deferredEventCount, pendingEventCount, TicksToMilliseconds(_maxQueueAgeTicks), TicksToMilliseconds(oldestPendingEventAgeTicks));
         }
 
-        public static void InvokeOnMainThread(UnityEvent unityEvent, string eventName)
+        internal static void ExecuteOnMainThread<T>(Action<T> action, T param, string eventName)
+        {
+            var queuedEvent = new MaxQueuedEvent {Invoker = MaxActionInvoker<T>.Instance, Target = action};
+            queuedEvent.Param1 = queuedEvent.StoreParam(param, 1);
+            Enqueue(ref queuedEvent, eventName);
+        }
+
+        internal static void ExecuteOnMainThread<T1, T2>(Action<T1, T2> action, T1 param1, T2 param2, string eventName)
+        {
+            var queuedEvent = new MaxQueuedEvent {Invoker = MaxActionInvoker<T1, T2>.Instance, Target = action};
+            queuedEvent.Param1 = queuedEvent.StoreParam(param1, 1);
+            queuedEvent.Param2 = queuedEvent.StoreParam(param2, 2);
+            Enqueue(ref queuedEvent, eventName);
+        }
+
+        internal static void ExecuteOnMainThread<T1, T2, T3>(Action<T1, T2, T3> action, T1 param1, T2 param2, T3 param3, string eventName)
+        {
+            var queuedEvent = new MaxQueuedEvent {Invoker = MaxActionInvoker<T1, T2, T3>.Instance, Target = action};
+            queuedEvent.Param1 = queuedEvent.StoreParam(param1, 1);
+            queuedEvent.Param2 = queuedEvent.StoreParam(param2, 2);
+            queuedEvent.Param3 = queuedEvent.StoreParam(param3, 3);
+            Enqueue(ref queuedEvent, eventName);
+        }
+
+        private static void Enqueue(MaxEventInvoker invoker, object target, string eventName)
+        {
+            var queuedEvent = new MaxQueuedEvent {Invoker = invoker, Target = target};
+            Enqueue(ref queuedEvent, eventName);
+        }
+
+        private static void Enqueue(ref MaxQueuedEvent queuedEvent, string eventName)
+        {
+            queuedEvent.EventName = eventName;
+            queuedEvent.Priority = Interlocked.Read(ref _frameBudgetTicks) > 0 ? GetPriority(eventName) : MaxEventPriority.Normal;
+            queuedEvent.EnqueueTimestamp = Stopwatch.GetTimestamp();
+
+            // The queue owns pooled payloads until the event is dispatched
+            MaxCallbackPayloadPool.AddReference(queuedEvent.Param1);
+            MaxCallbackPayloadPool.AddReference(queuedEvent.Param2);
+            MaxCallbackPayloadPool.AddReference(queuedEvent.Param3);
+
+            AdEventsQueue.Enqueue(ref queuedEvent);
+        }
+
+        private static MaxEventPriority GetPriority(string eventName)
+        {
+            if (eventName == null) return MaxEventPriority.Normal;
+
+            if (eventName.EndsWith("ReceivedRewardEvent", StringComparison.Ordinal) || eventName.EndsWith("FailedToDisplayEvent", StringComparison.Ordinal))
+            {
+                return MaxEventPriority.Urgent;
+            }
+
+            if (eventName.EndsWith("RevenuePaidEvent", StringComparison.Ordinal) || eventName.EndsWith("ReviewCreativeIdGeneratedEvent", StringComparison.Ordinal))
+            {
+                return MaxEventPriority.Deferrable;
+            }
+
+            return MaxEventPriority.Normal;
+        }
+
+        private static double TicksToMilliseconds(long ticks)
         {
-            ExecuteOnMainThread(() => unityEvent.Invoke(), eventName);
+            return ticks * 1000.0 / Stopwatch.Frequency;
         }
 
         #endregion
 
         public void Update()
         {
-            if (_adEventsQueueEmpty) return;
+            var frameStartTimestamp = Stopwatch.GetTimestamp();
+            if (MaxTimelineTracer.IsEnabled)
+            {
+                MaxTimelineTracer.RecordFrame(Time.frameCount);
+            }
 
-            var actionsToExecute = new List<MaxAction>();
-            lock (AdEventsQueue)
+            if (!AdEventsQueue.IsEmpty)
             {
-                actionsToExecute.AddRange(AdEventsQueue);
-                AdEventsQueue.Clear();
-                _adEventsQueueEmpty = true;
+                var eventCount = AdEventsQueue.DrainTo(ref _dequeuedEvents, 0);
+                for (var i = 0; i < eventCount; i++)
+                {
+                    PendingEventsByPriority[(int) _dequeuedEvents[i].Priority].Enqueue(_dequeuedEvents[i]);
+                }
+
+                Array.Clear(_dequeuedEvents, 0, eventCount);
             }
 
-            foreach (var maxAction in actionsToExecute)
+            // Urgent events are never deferred
+            var urgentEvents = PendingEventsByPriority[(int) MaxEventPriority.Urgent];
+            while (urgentEvents.Count > 0)
             {
-                if (maxAction.ActionToExecute.Target != null)
+                Dispatch(urgentEvents.Dequeue());
+            }
+
+            var frameBudgetTicks = Interlocked.Read(ref _frameBudgetTicks);
+            var hasDispatchedEvent = false;
+            for (var priority = (int) MaxEventPriority.Normal; priority <= (int) MaxEventPriority.Deferrable; priority++)
+            {
+                var pendingEvents = PendingEventsByPriority[priority];
+                while (pendingEvents.Count > 0)
                 {
-                    try
-                    {
-                        maxAction.ActionToExecute.Invoke();
-                    }
-                    catch (Exception exception)
+                    // Always dispatch at least one event per frame so a slow callback cannot stall the queue
+                    if (frameBudgetTicks > 0 && hasDispatchedEvent && Stopwatch.GetTimestamp() - frameStartTimestamp >= frameBudgetTicks)
                     {
-                        MaxSdkLogger.UserError("Caught exception in publisher event: " + maxAction.EventName + ", exception: " + exception);
-                        MaxSdkLogger.LogException(exception);
+                        _deferredEventCount += PendingEventsByPriority[(int) MaxEventPriority.Normal].MarkDeferred() + PendingEventsByPriority[(int) MaxEventPriority.Deferrable].MarkDeferred();
+                        return;
                     }
+
+                    Dispatch(pendingEvents.Dequeue());
+                    hasDispatchedEvent = true;
                 }
             }
         }
 
+        private static void Dispatch(MaxQueuedEvent queuedEvent)
+        {
+            var queueAgeTicks = Stopwatch.GetTimestamp() - queuedEvent.EnqueueTimestamp;
+            if (queueAgeTicks > _maxQueueAgeTicks)
+            {
+                _maxQueueAgeTicks = queueAgeTicks;
+            }
+
+            _dispatchedEventCount++;
+
+            var handlerSample = MaxPipelineStats.OnEventDequeued(queuedEvent.EventName, queuedEvent.EnqueueTimestamp);
+            var traceTimestamp = MaxTimelineTracer.GetTimestamp();
+            try
+            {
+                queuedEvent.Invoke();
+            }
+            catch (Exception exception)
+            {
+                MaxSdkLogger.UserError("Caught exception in publisher event: " + queuedEvent.EventName + ", exception: " + exception);
+                MaxSdkLogger.LogException(exception);
+            }
+
+            MaxPipelineStats.OnHandlerReturned(queuedEvent.EventName, handlerSample);
+            MaxTimelineTracer.Record(MaxTimelineTracer.SpanKind.Handler, queuedEvent.EventName, traceTimestamp - queuedEvent.EnqueueTimestamp, traceTimestamp);
+
+            MaxCallbackPayloadPool.Release(queuedEvent.Param1);
+            MaxCallbackPayloadPool.Release(queuedEvent.Param2);
+            MaxCallbackPayloadPool.Release(queuedEvent.Param3);
+        }
+
         public void Disable()
         {
             _instance = null;
         }
+
+        /// <summary>
+        /// A growable FIFO of events waiting to be dispatched on the main thread.
+        /// </summary>
+        private sealed class PendingEvents
+        {
+            private MaxQueuedEvent[] _events = new MaxQueuedEvent[16];
+            private int _head;
+
+            // The number of events at the head that were already counted as deferred. New events are only added at the tail, so these always come first.
+            private int _deferredCount;
+
+            public int Count { get; private set; }
+
+            /// <summary>
+            /// Marks every pending event as deferred and returns how many of them were not deferred before.
+            /// </summary>
+            public int MarkDeferred()
+            {
+                var newlyDeferredCount = Count - _deferredCount;
+                _deferredCount = Count;
+                return newlyDeferredCount;
+            }
+
+            public void Enqueue(MaxQueuedEvent queuedEvent)
+            {
+                if (Count == _events.Length)
+                {
+                    var events = new MaxQueuedEvent[_events.Length * 2];
+                    for (var i = 0; i < Count; i++)
+                    {
+                        events[i] = _events[(_head + i) % _events.Length];
+                    }
+
+                    _events = events;
+                    _head = 0;
+                }
+
+                _events[(_head + Count) % _events.Length] = queuedEvent;
+                Count++;
+            }
+
+            public MaxQueuedEvent Peek()
+            {
+                return _events[_head];
+            }
+
+            public MaxQueuedEvent Dequeue()
+            {
+                var queuedEvent = _events[_head];
+                _events[_head] = default(MaxQueuedEvent);
+                _head = (_head + 1) % _events.Length;
+                Count--;
+                if (_deferredCount > 0)
+                {
+                    _deferredCount--;
+                }
+
+                return queuedEvent;
+            }
+        }
     }
 }
@@ -0,0 +1,393 @@
+//
+//  MaxEventQueue.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using UnityEngine;
+using UnityEngine.Events;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// How urgently a queued callback should be dispatched when the executor has a frame budget. See <see cref="MaxEventExecutor.FrameBudgetMilliseconds"/>.
+    /// </summary>
+    internal enum MaxEventPriority
+    {
+        /// <summary>
+        /// Always dispatched in the frame it is dequeued, regardless of the frame budget.
+        /// </summary>
+        Urgent = 0,
+
+        Normal = 1,
+
+        /// <summary>
+        /// Dispatched only after urgent and normal events, and pushed to a later frame first when over budget.
+        /// </summary>
+        Deferrable = 2
+    }
+
+    /// <summary>
+    /// A queued callback. The callback and its parameters are stored as-is and invoked through a shared typed <see cref="MaxEventInvoker"/>,
+    /// so queueing an event does not allocate a closure.
+    ///
+    /// One struct parameter with a <see cref="MaxQueuedValueSlot{T}"/> layout, such as a reward or an ad view layout, is stored inline in <see cref="Value"/>
+    /// instead of being boxed into its <c>Param</c> field. <see cref="ValueParamIndex"/> tells which parameter it is.
+    /// </summary>
+    internal struct MaxQueuedEvent
+    {
+        public MaxEventInvoker Invoker;
+        public object Target;
+        public object Param1;
+        public object Param2;
+        public object Param3;
+        public MaxQueuedValue Value;
+        public byte ValueParamIndex; // 1 to 3, or 0 if no parameter is stored inline
+        public string EventName;
+        public MaxEventPriority Priority;
+        public long EnqueueTimestamp;
+
+        public void Invoke()
+        {
+            Invoker.Invoke(ref this);
+        }
+
+        /// <summary>
+        /// Stores a parameter, inline if its type has a value slot layout and the slot is still free. Returns what to store in the <c>Param</c> field.
+        /// </summary>
+        public object StoreParam<T>(T param, byte paramIndex)
+        {
+            var write = MaxQueuedValueSlot<T>.Write;
+            if (write == null || ValueParamIndex != 0) return param;
+
+            write(param, ref Value);
+            ValueParamIndex = paramIndex;
+            return null;
+        }
+
+        public T GetParam<T>(object param, byte paramIndex)
+        {
+            return ValueParamIndex == paramIndex ? MaxQueuedValueSlot<T>.Read(ref Value) : (T) param;
+        }
+    }
+
+    /// <summary>
+    /// Inline storage for one struct parameter of a <see cref="MaxQueuedEvent"/>.
+    /// </summary>
+    internal struct MaxQueuedValue
+    {
+        public string String;
+        public int Int;
+        public float X;
+        public float Y;
+        public float Width;
+        public float Height;
+    }
+
+    /// <summary>
+    /// Copies parameters of type <typeparamref name="T"/> into and out of a <see cref="MaxQueuedValue"/>. Both delegates are <c>null</c> for types without
+    /// a layout, whose parameters are stored as objects.
+    /// </summary>
+    internal static class MaxQueuedValueSlot<T>
+    {
+        internal delegate void Writer(T value, ref MaxQueuedValue slot);
+
+        internal delegate T Reader(ref MaxQueuedValue slot);
+
+        internal static readonly Writer Write;
+        internal static readonly Reader Read;
+
+        static MaxQueuedValueSlot()
+        {
+            // The casts through object only succeed for the matching T, and are resolved once per type
+            if (typeof(T) == typeof(MaxSdkBase.Reward))
+            {
+                Write = (Writer) (object) new MaxQueuedValueSlot<MaxSdkBase.Reward>.Writer(MaxQueuedValueLayouts.WriteReward);
+                Read = (Reader) (object) new MaxQueuedValueSlot<MaxSdkBase.Reward>.Reader(MaxQueuedValueLayouts.ReadReward);
+            }
+            else if (typeof(T) == typeof(Rect))
+            {
+                Write = (Writer) (object) new MaxQueuedValueSlot<Rect>.Writer(MaxQueuedValueLayouts.WriteRect);
+                Read = (Reader) (object) new MaxQueuedValueSlot<Rect>.Reader(MaxQueuedValueLayouts.ReadRect);
+            }
+            else if (typeof(T) == typeof(bool))
+            {
+                Write = (Writer) (object) new MaxQueuedValueSlot<bool>.Writer(MaxQueuedValueLayouts.WriteBool);
+                Read = (Reader) (object) new MaxQueuedValueSlot<bool>.Reader(MaxQueuedValueLayouts.ReadBool);
+            }
+        }
+    }
+
+    internal static class MaxQueuedValueLayouts
+    {
+        internal static void WriteReward(MaxSdkBase.Reward reward, ref MaxQueuedValue slot)
+        {
+            slot.String = reward.Label;
+            slot.Int = reward.Amount;
+        }
+
+        internal static MaxSdkBase.Reward ReadReward(ref MaxQueuedValue slot)
+        {
+            return new MaxSdkBase.Reward {Label = slot.String, Amount = slot.Int};
+        }
+
+        internal static void WriteRect(Rect rect, ref MaxQueuedValue slot)
+        {
+            slot.X = rect.x;
+            slot.Y = rect.y;
+            slot.Width = rect.width;
+            slot.Height = rect.height;
+        }
+
+        internal static Rect ReadRect(ref MaxQueuedValue slot)
+        {
+            return new Rect(slot.X, slot.Y, slot.Width, slot.Height);
+        }
+
+        internal static void WriteBool(bool value, ref MaxQueuedValue slot)
+        {
+            slot.Int = value ? 1 : 0;
+        }
+
+        internal static bool ReadBool(ref MaxQueuedValue slot)
+        {
+            return slot.Int != 0;
+        }
+    }
+
+    /// <summary>
+    /// Invokes the callback stored in a <see cref="MaxQueuedEvent"/>. There is a single instance per callback signature.
+    /// </summary>
+    internal abstract class MaxEventInvoker
+    {
+        public abstract void Invoke(ref MaxQueuedEvent queuedEvent);
+    }
+
+    internal sealed class MaxActionInvoker : MaxEventInvoker
+    {
+        public static readonly MaxActionInvoker Instance = new MaxActionInvoker();
+
+        public override void Invoke(ref MaxQueuedEvent queuedEvent)
+        {
+            var action = (Action) queuedEvent.Target;
+
+            // NOTE: Preserves the existing behavior of dropping actions that are not bound to an instance
+            if (action.Target == null) return;
+
+            action();
+        }
+    }
+
+    internal sealed class MaxActionInvoker<T> : MaxEventInvoker
+    {
+        public static readonly MaxActionInvoker<T> Instance = new MaxActionInvoker<T>();
+
+        public override void Invoke(ref MaxQueuedEvent queuedEvent)
+        {
+            ((Action<T>) queuedEvent.Target)(queuedEvent.GetParam<T>(queuedEvent.Param1, 1));
+        }
+    }
+
+    internal sealed class MaxActionInvoker<T1, T2> : MaxEventInvoker
+    {
+        public static readonly MaxActionInvoker<T1, T2> Instance = new MaxActionInvoker<T1, T2>();
+
+        public override void Invoke(ref MaxQueuedEvent queuedEvent)
+        {
+            ((Action<T1, T2>) queuedEvent.Target)(queuedEvent.GetParam<T1>(queuedEvent.Param1, 1), queuedEvent.GetParam<T2>(queuedEvent.Param2, 2));
+        }
+    }
+
+    internal sealed class MaxActionInvoker<T1, T2, T3> : MaxEventInvoker
+    {
+        public static readonly MaxActionInvoker<T1, T2, T3> Instance = new MaxActionInvoker<T1, T2, T3>();
+
+        public override void Invoke(ref MaxQueuedEvent queuedEvent)
+        {
+            var action = (Action<T1, T2, T3>) queuedEvent.Target;
+            action(queuedEvent.GetParam<T1>(queuedEvent.Param1, 1), queuedEvent.GetParam<T2>(queuedEvent.Param2, 2), queuedEvent.GetParam<T3>(queuedEvent.Param3, 3));
+        }
+    }
+
+    internal sealed class MaxUnityEventInvoker : MaxEventInvoker
+    {
+        public static readonly MaxUnityEventInvoker Instance = new MaxUnityEventInvoker();
+
+        public override void Invoke(ref MaxQueuedEvent queuedEvent)
+        {
+            ((UnityEvent) queuedEvent.Target).Invoke();
+        }
+    }
+
+    /// <summary>
+    /// A bounded lock-free multi-producer single-consumer queue of <see cref="MaxQueuedEvent"/>s.
+    ///
+    /// Producers claim a slot with a single compare-and-swap and publish it by bumping the slot's sequence number, so they never wait on the consumer.
+    /// If the ring is full, events spill into a locked overflow list instead of being dropped or blocking. Events enqueued by the same thread are always
+    /// dequeued in the order they were enqueued.
+    /// </summary>
+    internal sealed class MaxEventQueue
+    {
+        private struct Slot
+        {
+            public long Sequence;
+            public MaxQueuedEvent Event;
+        }
+
+        private readonly Slot[] _slots;
+        private readonly long _mask;
+        private readonly List<MaxQueuedEvent> _overflowEvents = new List<MaxQueuedEvent>();
+
+        private long _enqueuePosition;
+        private long _dequeuePosition; // Only accessed by the consumer
+        private volatile bool _isOverflowing;
+
+        /// <param name="capacity">The number of preallocated slots. Rounded up to a power of two.</param>
+        public MaxEventQueue(int capacity)
+        {
+            var size = 2;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+
+            _slots = new Slot[size];
+            _mask = size - 1;
+            for (var i = 0; i < size; i++)
+            {
+                _slots[i].Sequence = i;
+            }
+        }
+
+        public int Capacity
+        {
+            get { return _slots.Length; }
+        }
+
+        /// <summary>
+        /// Whether the queue has no published events. Only meaningful on the consumer thread.
+        /// </summary>
+        public bool IsEmpty
+        {
+            get
+            {
+                if (_isOverflowing) return false;
+
+                var sequence = Volatile.Read(ref _slots[_dequeuePosition & _mask].Sequence);
+                return sequence != _dequeuePosition + 1;
+            }
+        }
+
+        /// <summary>
+        /// Adds an event to the queue. Safe to call from any thread.
+        /// </summary>
+        public void Enqueue(ref MaxQueuedEvent queuedEvent)
+        {
+            // Once an event has spilled over, keep spilling until the consumer catches up so per-thread ordering is preserved
+            if (_isOverflowing || !TryEnqueue(ref queuedEvent))
+            {
+                lock (_overflowEvents)
+                {
+                    _overflowEvents.Add(queuedEvent);
+                    _isOverflowing = true;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Moves every published event into <paramref name="events"/>, in order, and returns the number of events moved. Must only be called from the consumer thread.
+        /// The caller owns <paramref name="events"/>, which is grown as needed, so the slots are released back to producers before any callback runs.
+        /// </summary>
+        public int DrainTo(ref MaxQueuedEvent[] events, int count)
+        {
+            var start = count;
+            count = DrainRing(ref events, count);
+
+            if (_isOverflowing)
+            {
+                lock (_overflowEvents)
+                {
+                    // Events that made it into the ring before a producer spilled over must be dispatched first. If a slot is claimed but not
+                    // published yet, the events behind it may precede an overflowed event of the same producer, so the overflow waits for the next drain.
+                    count = DrainRing(ref events, count);
+                    if (_dequeuePosition != Volatile.Read(ref _enqueuePosition)) return count - start;
+
+                    for (var i = 0; i < _overflowEvents.Count; i++)
+                    {
+                        Append(ref events, ref count, _overflowEvents[i]);
+                    }
+
+                    _overflowEvents.Clear();
+                    _isOverflowing = false;
+                }
+            }
+
+            return count - start;
+        }
+
+        private bool TryEnqueue(ref MaxQueuedEvent queuedEvent)
+        {
+            var position = Volatile.Read(ref _enqueuePosition);
+            while (true)
+            {
+                var index = position & _mask;
+                var sequence = Volatile.Read(ref _slots[index].Sequence);
+                var difference = sequence - position;
+                if (difference == 0)
+                {
+                    if (Interlocked.CompareExchange(ref _enqueuePosition, position + 1, position) == position)
+                    {
+                        _slots[index].Event = queuedEvent;
+                        Volatile.Write(ref _slots[index].Sequence, position + 1);
+                        return true;
+                    }
+
+                    position = Volatile.Read(ref _enqueuePosition);
+                }
+                else if (difference < 0)
+                {
+                    // The consumer has not released this slot yet, so the ring is full
+                    return false;
+                }
+                else
+                {
+                    // Another producer claimed this slot
+                    position = Volatile.Read(ref _enqueuePosition);
+                }
+            }
+        }
+
+        private int DrainRing(ref MaxQueuedEvent[] events, int count)
+        {
+            while (true)
+            {
+                var index = _dequeuePosition & _mask;
+                var sequence = Volatile.Read(ref _slots[index].Sequence);
+
+                // Either empty or the producer that claimed this slot has not published it yet
+                if (sequence != _dequeuePosition + 1) return count;
+
+                Append(ref events, ref count, _slots[index].Event);
+
+                // Release references so they can be collected, then hand the slot back to producers
+                _slots[index].Event = default(MaxQueuedEvent);
+                Volatile.Write(ref _slots[index].Sequence, _dequeuePosition + _slots.Length);
+                _dequeuePosition++;
+            }
+        }
+
+        private static void Append(ref MaxQueuedEvent[] events, ref int count, MaxQueuedEvent queuedEvent)
+        {
+            if (count == events.Length)
+            {
+                Array.Resize(ref events, Math.Max(events.Length * 2, 16));
+            }
+
+            events[count++] = queuedEvent;
+        }
+    }
+}
@@ -0,0 +1,205 @@
+//
+//  MaxEventTrace.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Text;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Records the events the native plugin sends to Unity, exactly as they were passed to the background callback, into an append-only trace file
+    /// that the Unity Editor can replay. See <see cref="MaxSdkBase.StartEventTraceRecording"/>.
+    ///
+    /// File layout (all integers little-endian):
+    ///
+    ///   trace   := "MAXTRACE" | u8 version | record*
+    ///   record  := u8 kind | i64 microseconds since recording started | i32 length | payload
+    ///
+    /// JSON payloads are stored as UTF-8, and may hold several events separated by newlines if the native plugin batched them.
+    /// Binary payloads are stored as received, and may hold several frames back to back.
+    /// </summary>
+    internal static class MaxEventTrace
+    {
+        internal const byte KindJson = 1;
+        internal const byte KindBinary = 2;
+
+        private const byte Version = 1;
+        private const int RecordHeaderSize = 13;
+        private const string Magic = "MAXTRACE";
+        private static readonly byte[] MagicBytes = Encoding.ASCII.GetBytes(Magic);
+
+        /// <summary>
+        /// A callback read back from a trace file.
+        /// </summary>
+        internal struct TracedCallback
+        {
+            public long TimestampMicroseconds;
+            public byte Kind;
+            public string Json;     // Set for KindJson
+            public byte[] Bytes;    // Set for KindBinary
+        }
+
+        private static readonly object WriteLock = new object();
+        private static volatile BinaryWriter _writer;
+        private static long _startTimestamp;
+
+        internal static bool IsRecording
+        {
+            get { return _writer != null; }
+        }
+
+        /// <summary>
+        /// Starts recording to <paramref name="path"/>, replacing any existing file, and stops any recording already in progress.
+        /// Returns <c>false</c> if the file could not be created.
+        /// </summary>
+        internal static bool StartRecording(string path)
+        {
+            lock (WriteLock)
+            {
+                StopRecordingLocked();
+
+                try
+                {
+                    var writer = new BinaryWriter(new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read, 64 * 1024));
+                    writer.Write(MagicBytes);
+                    writer.Write(Version);
+
+                    _startTimestamp = Stopwatch.GetTimestamp();
+                    _writer = writer;
+                    return true;
+                }
+                catch (Exception exception)
+                {
+                    MaxSdkLogger.E("Failed to start recording event trace to " + path + ": " + exception.Message);
+                    return false;
+                }
+            }
+        }
+
+        internal static void StopRecording()
+        {
+            lock (WriteLock)
+            {
+                StopRecordingLocked();
+            }
+        }
+
+        internal static void Record(string propsStr)
+        {
+            if (_writer == null || propsStr == null) return;
+
+            var payload = Encoding.UTF8.GetBytes(propsStr);
+            Record(KindJson, payload, payload.Length);
+        }
+
+        internal static void Record(byte[] eventBytes, int length)
+        {
+            if (_writer == null || eventBytes == null) return;
+
+            Record(KindBinary, eventBytes, length);
+        }
+
+        /// <summary>
+        /// Reads every callback from a trace file, in the order they were recorded. Returns <c>null</c> if the file could not be read.
+        /// A record cut short, e.g. because the app was killed while recording, ends the trace.
+        /// </summary>
+        internal static List<TracedCallback> Read(string path)
+        {
+            try
+            {
+                using (var reader = new BinaryReader(File.OpenRead(path)))
+                {
+                    var magic = reader.ReadBytes(MagicBytes.Length);
+                    if (magic.Length != MagicBytes.Length || Encoding.ASCII.GetString(magic) != Magic || reader.ReadByte() != Version)
+                    {
+                        MaxSdkLogger.E("Failed to read event trace " + path + " since it is not a trace file or was recorded by a different plugin version");
+                        return null;
+                    }
+
+                    var tracedCallbacks = new List<TracedCallback>();
+                    var stream = reader.BaseStream;
+                    while (stream.Length - stream.Position >= RecordHeaderSize)
+                    {
+                        var tracedCallback = new TracedCallback
+                        {
+                            Kind = reader.ReadByte(),
+                            TimestampMicroseconds = reader.ReadInt64()
+                        };
+
+                        var length = reader.ReadInt32();
+                        if (length < 0 || stream.Length - stream.Position < length) break;
+
+                        var payload = reader.ReadBytes(length);
+                        if (tracedCallback.Kind == KindJson)
+                        {
+                            tracedCallback.Json = Encoding.UTF8.GetString(payload);
+                        }
+                        else if (tracedCallback.Kind == KindBinary)
+                        {
+                            tracedCallback.Bytes = payload;
+                        }
+                        else
+                        {
+                            continue;
+                        }
+
+                        tracedCallbacks.Add(tracedCallback);
+                    }
+
+                    return tracedCallbacks;
+                }
+            }
+            catch (Exception exception)
+            {
+                MaxSdkLogger.E("Failed to read event trace " + path + ": " + exception.Message);
+                return null;
+            }
+        }
+
+        private static void Record(byte kind, byte[] payload, int length)
+        {
+            lock (WriteLock)
+            {
+                var writer = _writer;
+                if (writer == null) return;
+
+                try
+                {
+                    writer.Write(kind);
+                    writer.Write((Stopwatch.GetTimestamp() - _startTimestamp) * 1000000 / Stopwatch.Frequency);
+                    writer.Write(length);
+                    writer.Write(payload, 0, length);
+                }
+                catch (Exception exception)
+                {
+                    MaxSdkLogger.E("Stopped recording event trace due to an error: " + exception.Message);
+                    StopRecordingLocked();
+                }
+            }
+        }
+
+        private static void StopRecordingLocked()
+        {
+            var writer = _writer;
+            if (writer == null) return;
+
+            _writer = null;
+
+            try
+            {
+                writer.Close();
+            }
+            catch (Exception exception)
+            {
+                MaxSdkLogger.E("Failed to finish recording event trace: " + exception.Message);
+            }
+        }
+    }
+}
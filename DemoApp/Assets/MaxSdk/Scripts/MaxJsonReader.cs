@@ -0,0 +1,739 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Text;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Forward-only, pull-based reader for the JSON payloads sent by the native plugins.
+    ///
+    /// Unlike <c>MiniJSON</c>, the reader does not build a dictionary for the payload. Callers walk the properties of an object and only
+    /// materialize the values they need, so the only allocations in steady state are the strings returned by <see cref="ReadString"/>.
+    /// The whole document is validated once in <see cref="TryOpen"/>, so the rest of the reader can assume well-formed input.
+    /// </summary>
+    internal struct MaxJsonReader
+    {
+        private const int MaxDepth = 64;
+
+        // Powers of ten that are exactly representable as a double
+        private static readonly double[] PowersOfTen =
+        {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        [ThreadStatic] private static StringBuilder _stringBuilder;
+
+        private readonly string _json;
+        private readonly int _end;
+        private readonly bool _isObject;
+        private int _position;
+        private int _nameStart;
+        private int _nameLength;
+        private bool _nameEscaped;
+        private int _valueStart;
+        private int _valueEnd;
+
+        /// <summary>
+        /// The type of the current value as one of the <c>MaxEventCodec.ValueType*</c> constants. JSON <c>null</c> is reported as <c>0</c>.
+        /// </summary>
+        internal byte ValueType { get; private set; }
+
+        private MaxJsonReader(string json, int start, int end, bool isObject) : this()
+        {
+            _json = json;
+            _position = start;
+            _end = end;
+            _isObject = isObject;
+        }
+
+        /// <summary>
+        /// Validates the given JSON document and returns a reader over the properties of its root object.
+        /// Returns <c>false</c> if the document is malformed or its root is not an object.
+        /// </summary>
+        internal static bool TryOpen(string json, out MaxJsonReader reader)
+        {
+            return TryOpen(json, 0, json != null ? json.Length : 0, out reader);
+        }
+
+        /// <summary>
+        /// Same as <see cref="TryOpen(string, out MaxJsonReader)"/> for the document in the given range of <paramref name="json"/>,
+        /// so one event of a batch can be read without copying it out.
+        /// </summary>
+        internal static bool TryOpen(string json, int start, int length, out MaxJsonReader reader)
+        {
+            reader = default(MaxJsonReader);
+            if (json == null) return false;
+
+            var end = start + length;
+            var position = SkipWhitespace(json, start, end);
+            var objectStart = position;
+            if (objectStart >= end || json[objectStart] != '{') return false;
+            if (!TryValidateValue(json, ref position, end, 0)) return false;
+            if (SkipWhitespace(json, position, end) != end) return false;
+
+            reader = new MaxJsonReader(json, objectStart + 1, position - 1, true);
+            return true;
+        }
+
+        /// <summary>
+        /// Advances to the next property of the current object, or the next element of the current array.
+        /// Returns <c>false</c> once the end of the container is reached.
+        /// </summary>
+        internal bool MoveNext()
+        {
+            if (_json == null) return false;
+
+            var position = SkipWhitespace(_json, _position, _end);
+            if (position < _end && _json[position] == ',')
+            {
+                position = SkipWhitespace(_json, position + 1, _end);
+            }
+
+            if (position >= _end) return false;
+
+            if (_isObject)
+            {
+                _nameStart = position + 1;
+                position = SkipString(_json, position, out _nameEscaped);
+                _nameLength = position - _nameStart - 1;
+
+                // Skip the ':' separating the name from the value
+                position = SkipWhitespace(_json, SkipWhitespace(_json, position, _end) + 1, _end);
+            }
+
+            _valueStart = position;
+            _valueEnd = SkipValue(_json, position);
+            ValueType = GetValueType(_json, _valueStart, _valueEnd);
+            _position = _valueEnd;
+            return true;
+        }
+
+        /// <summary>
+        /// Compares the name of the current property against <paramref name="name"/> without allocating.
+        /// </summary>
+        internal bool NameEquals(string name)
+        {
+            if (!_isObject) return false;
+
+            if (!_nameEscaped)
+            {
+                return _nameLength == name.Length && string.CompareOrdinal(_json, _nameStart, name, 0, _nameLength) == 0;
+            }
+
+            var builder = Unescape(_json, _nameStart, _nameLength);
+            if (builder.Length != name.Length) return false;
+
+            for (var i = 0; i < name.Length; i++)
+            {
+                if (builder[i] != name[i]) return false;
+            }
+
+            return true;
+        }
+
+        internal string ReadName()
+        {
+            if (!_isObject) return "";
+
+            return _nameEscaped ? Unescape(_json, _nameStart, _nameLength).ToString() : _json.Substring(_nameStart, _nameLength);
+        }
+
+        /// <summary>
+        /// Returns the <c>MaxEventCodec.Field*</c> id of the current property, or <c>MaxEventCodec.FieldNone</c> if it is not a known payload key.
+        /// </summary>
+        internal byte GetFieldId()
+        {
+            if (!_isObject) return MaxEventCodec.FieldNone;
+
+            if (!_nameEscaped) return MaxEventCodec.FieldForKey(_json, _nameStart, _nameLength);
+
+            var name = ReadName();
+            return MaxEventCodec.FieldForKey(name, 0, name.Length);
+        }
+
+        internal string ReadString()
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                    var start = _valueStart + 1;
+                    var length = _valueEnd - _valueStart - 2;
+                    if (length == 0) return "";
+
+                    return IsEscaped(_json, start, length) ? Unescape(_json, start, length).ToString() : _json.Substring(start, length);
+                case MaxEventCodec.ValueTypeDouble:
+                case MaxEventCodec.ValueTypeInt64:
+                case MaxEventCodec.ValueTypeBool:
+                    return _json.Substring(_valueStart, _valueEnd - _valueStart);
+                default:
+                    return "";
+            }
+        }
+
+        internal double ReadDouble(double defaultValue = 0)
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeDouble:
+                case MaxEventCodec.ValueTypeInt64:
+                    return ParseDouble(_json, _valueStart, _valueEnd);
+                case MaxEventCodec.ValueTypeString:
+                    double value;
+                    return double.TryParse(ReadString(), NumberStyles.Any, CultureInfo.InvariantCulture, out value) ? value : defaultValue;
+                default:
+                    return defaultValue;
+            }
+        }
+
+        internal long ReadLong(long defaultValue = 0)
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeInt64:
+                    long integer;
+                    return TryParseLong(_json, _valueStart, _valueEnd, out integer) ? integer : (long) ParseDouble(_json, _valueStart, _valueEnd);
+                case MaxEventCodec.ValueTypeDouble:
+                    return (long) ParseDouble(_json, _valueStart, _valueEnd);
+                case MaxEventCodec.ValueTypeString:
+                    long value;
+                    return long.TryParse(ReadString(), NumberStyles.Any, CultureInfo.InvariantCulture, out value) ? value : defaultValue;
+                default:
+                    return defaultValue;
+            }
+        }
+
+        internal int ReadInt(int defaultValue = 0)
+        {
+            return (int) ReadLong(defaultValue);
+        }
+
+        internal bool ReadBool()
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeBool:
+                    return _json[_valueStart] == 't';
+                case MaxEventCodec.ValueTypeString:
+                    bool value;
+                    return bool.TryParse(ReadString(), out value) && value;
+                default:
+                    return false;
+            }
+        }
+
+        /// <summary>
+        /// Returns a reader over the contents of the current object or array value. For any other value type the returned reader is empty.
+        /// </summary>
+        internal MaxJsonReader ReadContainer()
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeObject:
+                case MaxEventCodec.ValueTypeList:
+                    return new MaxJsonReader(_json, _valueStart + 1, _valueEnd - 1, ValueType == MaxEventCodec.ValueTypeObject);
+                default:
+                    return default(MaxJsonReader);
+            }
+        }
+
+        /// <summary>
+        /// Reads the current object value into a dictionary, with values boxed the same way MiniJSON boxes them.
+        /// </summary>
+        internal Dictionary<string, object> ReadMap()
+        {
+            var map = new Dictionary<string, object>();
+            var properties = ReadContainer();
+            if (!properties._isObject) return map;
+
+            while (properties.MoveNext())
+            {
+                map[properties.ReadName()] = properties.ReadBoxedValue();
+            }
+
+            return map;
+        }
+
+        private object ReadBoxedValue()
+        {
+            switch (ValueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                    return ReadString();
+                case MaxEventCodec.ValueTypeDouble:
+                    return ReadDouble();
+                case MaxEventCodec.ValueTypeInt64:
+                    long integer;
+                    return TryParseLong(_json, _valueStart, _valueEnd, out integer) ? (object) integer : ParseDouble(_json, _valueStart, _valueEnd);
+                case MaxEventCodec.ValueTypeBool:
+                    return ReadBool();
+                case MaxEventCodec.ValueTypeObject:
+                    return ReadMap();
+                case MaxEventCodec.ValueTypeList:
+                    var list = new List<object>();
+                    var items = ReadContainer();
+                    while (items.MoveNext())
+                    {
+                        list.Add(items.ReadBoxedValue());
+                    }
+
+                    return list;
+                default:
+                    return null;
+            }
+        }
+
+        #region Scanning
+
+        private static int SkipWhitespace(string json, int position, int end)
+        {
+            while (position < end)
+            {
+                var c = json[position];
+                if (c != ' ' && c != '\t' && c != '\n' && c != '\r') break;
+
+                position++;
+            }
+
+            return position;
+        }
+
+        /// <summary>
+        /// Returns the position just past the closing quote of the string starting at <paramref name="position"/>. Assumes validated input.
+        /// </summary>
+        private static int SkipString(string json, int position, out bool escaped)
+        {
+            escaped = false;
+            position++;
+
+            while (true)
+            {
+                var c = json[position];
+                if (c == '"') return position + 1;
+
+                if (c == '\\')
+                {
+                    escaped = true;
+                    position++;
+                }
+
+                position++;
+            }
+        }
+
+        /// <summary>
+        /// Returns the position just past the value starting at <paramref name="position"/>. Assumes validated input.
+        /// </summary>
+        private static int SkipValue(string json, int position)
+        {
+            bool escaped;
+            var c = json[position];
+            if (c == '"') return SkipString(json, position, out escaped);
+
+            if (c == '{' || c == '[')
+            {
+                var depth = 0;
+                while (true)
+                {
+                    c = json[position];
+                    if (c == '"')
+                    {
+                        position = SkipString(json, position, out escaped);
+                        continue;
+                    }
+
+                    if (c == '{' || c == '[')
+                    {
+                        depth++;
+                    }
+                    else if ((c == '}' || c == ']') && --depth == 0)
+                    {
+                        return position + 1;
+                    }
+
+                    position++;
+                }
+            }
+
+            // Literal or number
+            while (position < json.Length)
+            {
+                c = json[position];
+                if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r') break;
+
+                position++;
+            }
+
+            return position;
+        }
+
+        private static byte GetValueType(string json, int start, int end)
+        {
+            switch (json[start])
+            {
+                case '"':
+                    return MaxEventCodec.ValueTypeString;
+                case '{':
+                    return MaxEventCodec.ValueTypeObject;
+                case '[':
+                    return MaxEventCodec.ValueTypeList;
+                case 't':
+                case 'f':
+                    return MaxEventCodec.ValueTypeBool;
+                case 'n':
+                    return MaxEventCodec.ValueTypeNone;
+            }
+
+            for (var i = start; i < end; i++)
+            {
+                var c = json[i];
+                if (c == '.' || c == 'e' || c == 'E') return MaxEventCodec.ValueTypeDouble;
+            }
+
+            return MaxEventCodec.ValueTypeInt64;
+        }
+
+        #endregion
+
+        #region Validation
+
+        private static bool TryValidateValue(string json, ref int position, int end, int depth)
+        {
+            position = SkipWhitespace(json, position, end);
+            if (position >= end) return false;
+
+            switch (json[position])
+            {
+                case '{':
+                    return TryValidateContainer(json, ref position, end, depth, true);
+                case '[':
+                    return TryValidateContainer(json, ref position, end, depth, false);
+                case '"':
+                    return TryValidateString(json, ref position, end);
+                case 't':
+                    return TryValidateLiteral(json, ref position, end, "true");
+                case 'f':
+                    return TryValidateLiteral(json, ref position, end, "false");
+                case 'n':
+                    return TryValidateLiteral(json, ref position, end, "null");
+                default:
+                    return TryValidateNumber(json, ref position, end);
+            }
+        }
+
+        private static bool TryValidateContainer(string json, ref int position, int end, int depth, bool isObject)
+        {
+            if (depth >= MaxDepth) return false;
+
+            var closingChar = isObject ? '}' : ']';
+            position = SkipWhitespace(json, position + 1, end);
+            if (position < end && json[position] == closingChar)
+            {
+                position++;
+                return true;
+            }
+
+            while (true)
+            {
+                if (isObject)
+                {
+                    position = SkipWhitespace(json, position, end);
+                    if (position >= end || json[position] != '"') return false;
+                    if (!TryValidateString(json, ref position, end)) return false;
+
+                    position = SkipWhitespace(json, position, end);
+                    if (position >= end || json[position] != ':') return false;
+
+                    position++;
+                }
+
+                if (!TryValidateValue(json, ref position, end, depth + 1)) return false;
+
+                position = SkipWhitespace(json, position, end);
+                if (position >= end) return false;
+
+                var c = json[position++];
+                if (c == closingChar) return true;
+                if (c != ',') return false;
+            }
+        }
+
+        private static bool TryValidateString(string json, ref int position, int end)
+        {
+            position++;
+            while (position < end)
+            {
+                var c = json[position++];
+                if (c == '"') return true;
+                if (c < ' ') return false;
+                if (c != '\\') continue;
+
+                if (position >= end) return false;
+
+                switch (json[position++])
+                {
+                    case '"':
+                    case '\\':
+                    case '/':
+                    case 'b':
+                    case 'f':
+                    case 'n':
+                    case 'r':
+                    case 't':
+                        break;
+                    case 'u':
+                        if (position + 4 > end) return false;
+
+                        for (var i = 0; i < 4; i++)
+                        {
+                            if (HexValue(json[position++]) < 0) return false;
+                        }
+
+                        break;
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+
+        private static bool TryValidateLiteral(string json, ref int position, int end, string literal)
+        {
+            if (position + literal.Length > end || string.CompareOrdinal(json, position, literal, 0, literal.Length) != 0) return false;
+
+            position += literal.Length;
+            return true;
+        }
+
+        private static bool TryValidateNumber(string json, ref int position, int end)
+        {
+            if (position < end && json[position] == '-')
+            {
+                position++;
+            }
+
+            if (position >= end || !IsDigit(json[position])) return false;
+
+            // Leading zeros are not allowed
+            if (json[position] == '0')
+            {
+                position++;
+            }
+            else
+            {
+                SkipDigits(json, ref position, end);
+            }
+
+            if (position < end && json[position] == '.')
+            {
+                position++;
+                if (position >= end || !IsDigit(json[position])) return false;
+
+                SkipDigits(json, ref position, end);
+            }
+
+            if (position < end && (json[position] == 'e' || json[position] == 'E'))
+            {
+                position++;
+                if (position < end && (json[position] == '+' || json[position] == '-'))
+                {
+                    position++;
+                }
+
+                if (position >= end || !IsDigit(json[position])) return false;
+
+                SkipDigits(json, ref position, end);
+            }
+
+            return true;
+        }
+
+        private static void SkipDigits(string json, ref int position, int end)
+        {
+            while (position < end && IsDigit(json[position]))
+            {
+                position++;
+            }
+        }
+
+        #endregion
+
+        #region Decoding
+
+        private static bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        private static int HexValue(char c)
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+
+            return -1;
+        }
+
+        private static bool IsEscaped(string json, int start, int length)
+        {
+            return json.IndexOf('\\', start, length) >= 0;
+        }
+
+        /// <summary>
+        /// Decodes the escaped string contents into a per-thread builder. The returned builder is only valid until the next call.
+        /// </summary>
+        private static StringBuilder Unescape(string json, int start, int length)
+        {
+            var builder = _stringBuilder ?? (_stringBuilder = new StringBuilder(64));
+            builder.Length = 0;
+
+            var end = start + length;
+            for (var i = start; i < end; i++)
+            {
+                var c = json[i];
+                if (c != '\\')
+                {
+                    builder.Append(c);
+                    continue;
+                }
+
+                c = json[++i];
+                switch (c)
+                {
+                    case 'b':
+                        builder.Append('\b');
+                        break;
+                    case 'f':
+                        builder.Append('\f');
+                        break;
+                    case 'n':
+                        builder.Append('\n');
+                        break;
+                    case 'r':
+                        builder.Append('\r');
+                        break;
+                    case 't':
+                        builder.Append('\t');
+                        break;
+                    case 'u':
+                        var codeUnit = (HexValue(json[i + 1]) << 12) | (HexValue(json[i + 2]) << 8) | (HexValue(json[i + 3]) << 4) | HexValue(json[i + 4]);
+                        builder.Append((char) codeUnit);
+                        i += 4;
+                        break;
+                    default:
+                        // '"', '\\' and '/'
+                        builder.Append(c);
+                        break;
+                }
+            }
+
+            return builder;
+        }
+
+        private static bool TryParseLong(string json, int start, int end, out long value)
+        {
+            value = 0;
+
+            var negative = json[start] == '-';
+            var position = negative ? start + 1 : start;
+
+            // 19 digits always fit in a ulong, values outside the range of a long go through the double path
+            if (end - position > 19) return false;
+
+            ulong magnitude = 0;
+            for (; position < end; position++)
+            {
+                magnitude = magnitude * 10 + (ulong) (json[position] - '0');
+            }
+
+            if (magnitude > (negative ? (ulong) long.MaxValue + 1 : long.MaxValue)) return false;
+
+            value = negative ? (long) (0 - magnitude) : (long) magnitude;
+            return true;
+        }
+
+        /// <summary>
+        /// Parses a validated JSON number. Values with up to 15 significant digits and a small exponent are computed exactly without
+        /// allocating, anything else falls back to <see cref="double.Parse(string, NumberStyles, IFormatProvider)"/>.
+        /// </summary>
+        private static double ParseDouble(string json, int start, int end)
+        {
+            var position = start;
+            var negative = json[position] == '-';
+            if (negative)
+            {
+                position++;
+            }
+
+            ulong mantissa = 0;
+            var significantDigits = 0;
+            var exponent = 0;
+            var isFraction = false;
+
+            for (; position < end; position++)
+            {
+                var c = json[position];
+                if (c == '.')
+                {
+                    isFraction = true;
+                    continue;
+                }
+
+                if (!IsDigit(c)) break;
+
+                if (isFraction)
+                {
+                    exponent--;
+                }
+
+                // Leading zeros are not significant
+                if (mantissa == 0 && c == '0') continue;
+
+                mantissa = mantissa * 10 + (ulong) (c - '0');
+                if (++significantDigits > 15) return ParseDoubleSlow(json, start, end);
+            }
+
+            if (position < end)
+            {
+                // Skip 'e' or 'E'
+                position++;
+
+                var negativeExponent = json[position] == '-';
+                if (negativeExponent || json[position] == '+')
+                {
+                    position++;
+                }
+
+                var explicitExponent = 0;
+                for (; position < end; position++)
+                {
+                    explicitExponent = explicitExponent * 10 + (json[position] - '0');
+                    if (explicitExponent > 1000) return ParseDoubleSlow(json, start, end);
+                }
+
+                exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            }
+
+            double value = mantissa;
+            if (mantissa != 0)
+            {
+                if (exponent < -22 || exponent > 22) return ParseDoubleSlow(json, start, end);
+
+                value = exponent < 0 ? value / PowersOfTen[-exponent] : value * PowersOfTen[exponent];
+            }
+
+            return negative ? -value : value;
+        }
+
+        private static double ParseDoubleSlow(string json, int start, int end)
+        {
+            double value;
+            double.TryParse(json.Substring(start, end - start), NumberStyles.Float, CultureInfo.InvariantCulture, out value);
+            return value;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,212 @@
+//
+//  MaxLogWriter.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Threading;
+using UnityEngine;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Writes <see cref="MaxSdkLogger"/> messages to the Unity console from a background thread, so logging does not block the caller on the console and stack trace capture.
+    ///
+    /// Messages are handed over through a bounded multi-producer, single-consumer ring without taking a lock. If the ring is full, the message is dropped and counted,
+    /// and the writer reports the drops once it catches up. Messages are logged synchronously in the Unity Editor, and if the platform cannot start the writer thread.
+    /// </summary>
+    internal static class MaxLogWriter
+    {
+        private const int Capacity = 256;
+
+        // Entry `i` is free for position `p` once its sequence is `p`, and holds the message for position `p` once its sequence is `p + 1`
+        private struct Entry
+        {
+            public long Sequence;
+            public LogType Type;
+            public string Message;
+            public Exception Exception;
+        }
+
+        private static readonly Entry[] Entries = CreateEntries();
+        private static long _enqueuePosition;
+        private static long _droppedCount;
+
+        // Only accessed by the writer thread
+        private static long _dequeuePosition;
+        private static long _reportedDroppedCount;
+
+        private static readonly object StartLock = new object();
+        private static readonly AutoResetEvent WriterWakeUp = new AutoResetEvent(false);
+        private static volatile Thread _writerThread;
+#if UNITY_EDITOR
+        // Editor scripts such as the build post processors log through MaxSdkLogger too. Nothing would flush the writer before a `-batchmode -quit`
+        // build exits, and the console entries would lose the caller's stack trace, so the editor writes on the calling thread.
+        private static volatile bool _isSynchronous = true;
+#else
+        private static volatile bool _isSynchronous;
+#endif
+        private static int _isWriterSleeping;
+
+        internal static void Enqueue(LogType type, string message)
+        {
+            Enqueue(type, message, null);
+        }
+
+        /// <summary>
+        /// Logs the exception with its stack trace on the writer thread, so it stays in order with the messages logged before it.
+        /// </summary>
+        internal static void EnqueueException(Exception exception)
+        {
+            Enqueue(LogType.Exception, null, exception);
+        }
+
+        private static void Enqueue(LogType type, string message, Exception exception)
+        {
+            if (!EnsureWriterStarted())
+            {
+                Write(type, message, exception);
+                return;
+            }
+
+            int index;
+            var position = Interlocked.Read(ref _enqueuePosition);
+            while (true)
+            {
+                index = (int) (position % Capacity);
+                var sequence = Volatile.Read(ref Entries[index].Sequence);
+                if (sequence == position)
+                {
+                    var claimedPosition = Interlocked.CompareExchange(ref _enqueuePosition, position + 1, position);
+                    if (claimedPosition == position) break;
+
+                    position = claimedPosition;
+                }
+                else if (sequence < position)
+                {
+                    // The writer has not freed this entry from the previous lap yet
+                    Interlocked.Increment(ref _droppedCount);
+                    return;
+                }
+                else
+                {
+                    position = Interlocked.Read(ref _enqueuePosition);
+                }
+            }
+
+            Entries[index].Type = type;
+            Entries[index].Message = message;
+            Entries[index].Exception = exception;
+
+            // A full fence, so the writer cannot miss this message while going to sleep
+            Interlocked.Exchange(ref Entries[index].Sequence, position + 1);
+            if (Volatile.Read(ref _isWriterSleeping) != 0)
+            {
+                WriterWakeUp.Set();
+            }
+        }
+
+        private static bool EnsureWriterStarted()
+        {
+            if (_writerThread != null) return true;
+            if (_isSynchronous) return false;
+
+            lock (StartLock)
+            {
+                if (_writerThread != null) return true;
+
+                try
+                {
+                    var writerThread = new Thread(RunWriter) {IsBackground = true, Name = "MaxLogWriter"};
+                    writerThread.Start();
+                    _writerThread = writerThread;
+                    return true;
+                }
+                catch (Exception)
+                {
+                    // e.g. WebGL, which does not support threads
+                    _isSynchronous = true;
+                    return false;
+                }
+            }
+        }
+
+        private static void RunWriter()
+        {
+            while (true)
+            {
+                Drain();
+
+                Interlocked.Exchange(ref _isWriterSleeping, 1);
+                if (!HasPendingEntry())
+                {
+                    WriterWakeUp.WaitOne();
+                }
+
+                Interlocked.Exchange(ref _isWriterSleeping, 0);
+            }
+        }
+
+        private static void Drain()
+        {
+            while (HasPendingEntry())
+            {
+                var index = (int) (_dequeuePosition % Capacity);
+                var type = Entries[index].Type;
+                var message = Entries[index].Message;
+                var exception = Entries[index].Exception;
+
+                // Free the entry before writing, since writing to the console is the slow part
+                Entries[index].Message = null;
+                Entries[index].Exception = null;
+                Volatile.Write(ref Entries[index].Sequence, _dequeuePosition + Capacity);
+                _dequeuePosition++;
+
+                Write(type, message, exception);
+            }
+
+            var droppedCount = Interlocked.Read(ref _droppedCount);
+            if (droppedCount == _reportedDroppedCount) return;
+
+            Write(LogType.Warning, "Dropped " + (droppedCount - _reportedDroppedCount) + " log messages since the log buffer was full", null);
+            _reportedDroppedCount = droppedCount;
+        }
+
+        private static bool HasPendingEntry()
+        {
+            return Interlocked.Read(ref Entries[(int) (_dequeuePosition % Capacity)].Sequence) == _dequeuePosition + 1;
+        }
+
+        private static void Write(LogType type, string message, Exception exception)
+        {
+            switch (type)
+            {
+                case LogType.Exception:
+                    Debug.LogException(exception);
+                    break;
+                case LogType.Warning:
+                    Debug.LogWarning("Warning [" + MaxSdkLogger.SdkTag + "] " + message);
+                    break;
+                case LogType.Error:
+                    Debug.LogError("Error [" + MaxSdkLogger.SdkTag + "] " + message);
+                    break;
+                default:
+                    Debug.Log("Debug [" + MaxSdkLogger.SdkTag + "] " + message);
+                    break;
+            }
+        }
+
+        private static Entry[] CreateEntries()
+        {
+            var entries = new Entry[Capacity];
+            for (var i = 0; i < Capacity; i++)
+            {
+                entries[i].Sequence = i;
+            }
+
+            return entries;
+        }
+    }
+}
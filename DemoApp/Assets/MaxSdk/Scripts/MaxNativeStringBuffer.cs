@@ -0,0 +1,100 @@
+//
+//  MaxNativeStringBuffer.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Text;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// A reusable buffer that native getters write UTF-8 strings into, instead of returning a heap allocated copy that has to be marshaled and freed.
+    ///
+    /// Native copy functions return the byte length of the whole string and only write it if it fits. Otherwise the buffer grows and the call is retried.
+    /// The string from the previous read is kept, so polling a value that has not changed returns the same instance without allocating.
+    /// </summary>
+    internal sealed class MaxNativeStringBuffer
+    {
+        /// <summary>
+        /// Copies a native string into <paramref name="buffer"/> if it fits, and returns its length in bytes. Getters that take fewer arguments ignore the extra ones.
+        /// </summary>
+        internal delegate int CopyFunction(string arg1, string arg2, byte[] buffer, int bufferSize);
+
+        // The string can change between the size query and the retry, e.g. if an ad loads in between
+        private const int MaxAttempts = 4;
+
+        private readonly object _lock = new object();
+        private byte[] _buffer;
+        private byte[] _lastBytes;
+        private int _lastLength;
+        private string _lastString = "";
+
+        internal MaxNativeStringBuffer(int initialCapacity)
+        {
+            _buffer = new byte[initialCapacity];
+            _lastBytes = new byte[initialCapacity];
+        }
+
+        /// <summary>
+        /// Returns the string written by <paramref name="copy"/>, or an empty string if there is none. Can be called from any thread.
+        /// </summary>
+        internal string Read(CopyFunction copy, string arg1 = null, string arg2 = null)
+        {
+            lock (_lock)
+            {
+                for (var attempt = 0; attempt < MaxAttempts; attempt++)
+                {
+                    var length = copy(arg1, arg2, _buffer, _buffer.Length);
+                    if (length <= 0) return "";
+
+                    if (length <= _buffer.Length) return Decode(length);
+
+                    _buffer = new byte[NextCapacity(length)];
+                }
+
+                MaxSdkLogger.E("Failed to read a string from the native plugin since it kept growing");
+                return "";
+            }
+        }
+
+        private string Decode(int length)
+        {
+            if (length == _lastLength && BytesEqual(_buffer, _lastBytes, length)) return _lastString;
+
+            if (_lastBytes.Length < length)
+            {
+                _lastBytes = new byte[_buffer.Length];
+            }
+
+            Buffer.BlockCopy(_buffer, 0, _lastBytes, 0, length);
+            _lastLength = length;
+            _lastString = Encoding.UTF8.GetString(_buffer, 0, length);
+
+            return _lastString;
+        }
+
+        private static bool BytesEqual(byte[] lhs, byte[] rhs, int length)
+        {
+            for (var i = 0; i < length; i++)
+            {
+                if (lhs[i] != rhs[i]) return false;
+            }
+
+            return true;
+        }
+
+        private static int NextCapacity(int length)
+        {
+            var capacity = 64;
+            while (capacity < length)
+            {
+                capacity *= 2;
+            }
+
+            return capacity;
+        }
+    }
+}
@@ -0,0 +1,293 @@
+//
+//  MaxPipelineStats.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Latency histograms for the managed half of the ad event pipeline, from the background callback receiving an event until its listener returns.
+    /// The native half is recorded by the native plugin with its own clock and merged in by <see cref="CreateStats"/>.
+    ///
+    /// Samples are added with <see cref="Interlocked"/> and never take a lock. While disabled, every hook returns after reading a single volatile field.
+    /// </summary>
+    internal static class MaxPipelineStats
+    {
+        // NOTE: Must be kept in sync with MAUnityPipelineStats.h
+        internal const int BucketCount = 20;
+        internal const int EventSlotCount = 64;
+        private const int NativeStageCount = 2;
+        private const int NativeValuesPerStage = BucketCount + 2; // Bucket counts, total microseconds, bytes
+        internal const int NativeValueCount = EventSlotCount * NativeStageCount * NativeValuesPerStage;
+
+        private const int StageCount = (int) MaxSdkBase.PipelineStage.Handler + 1;
+        private const int ValuesPerStage = BucketCount + 3; // Bucket counts, total microseconds, bytes, allocated bytes
+        private const int TotalMicrosecondsIndex = BucketCount;
+        private const int BytesIndex = BucketCount + 1;
+        private const int AllocatedBytesIndex = BucketCount + 2;
+
+        private static volatile bool _enabled;
+        private static volatile long[] _values = new long[0];
+
+        // When recording started and, once disabled, stopped. Only written by SetEnabled.
+        private static long _enabledTimestamp;
+        private static int _enabledCollectionCount;
+        private static long _disabledTimestamp;
+        private static int _disabledCollectionCount;
+#if UNITY_2021_2_OR_NEWER
+        private static volatile bool _allocationTrackingSupported = true;
+#endif
+
+        // The background callback the current thread is decoding an event for. Cleared once the event is queued or handed to a background listener.
+        [ThreadStatic] private static long _callbackTimestamp;
+        [ThreadStatic] private static long _callbackAllocatedBytes;
+        [ThreadStatic] private static int _callbackPayloadSize;
+
+        /// <summary>
+        /// A handler that is about to run. <see cref="Timestamp"/> is <c>0</c> if the handler is not being timed.
+        /// </summary>
+        internal struct HandlerSample
+        {
+            public long Timestamp;
+            public long AllocatedBytes;
+        }
+
+        internal static bool IsEnabled
+        {
+            get { return _enabled; }
+        }
+
+        /// <summary>
+        /// Enabling clears any previously recorded samples.
+        /// </summary>
+        internal static void SetEnabled(bool enabled)
+        {
+            if (enabled && !_enabled)
+            {
+                _values = new long[EventSlotCount * StageCount * ValuesPerStage];
+                _enabledTimestamp = Stopwatch.GetTimestamp();
+                _enabledCollectionCount = GC.CollectionCount(0);
+            }
+            else if (!enabled && _enabled)
+            {
+                _disabledTimestamp = Stopwatch.GetTimestamp();
+                _disabledCollectionCount = GC.CollectionCount(0);
+            }
+
+            _enabled = enabled;
+        }
+
+        /// <summary>
+        /// Returns the current timestamp, or <c>0</c> while disabled.
+        /// </summary>
+        internal static long GetTimestamp()
+        {
+            return _enabled ? Stopwatch.GetTimestamp() : 0;
+        }
+
+        /// <summary>
+        /// Called before an event received by the background callback at <paramref name="callbackTimestamp"/> is decoded.
+        /// </summary>
+        internal static void OnEventReceived(long callbackTimestamp, int payloadSize)
+        {
+            if (callbackTimestamp == 0) return;
+
+            _callbackTimestamp = callbackTimestamp;
+            _callbackPayloadSize = payloadSize;
+            _callbackAllocatedBytes = GetAllocatedBytes();
+        }
+
+        /// <summary>
+        /// Called once the background callback has finished with the event, whether or not it reached a listener.
+        /// </summary>
+        internal static void OnEventFinished(long callbackTimestamp)
+        {
+            if (callbackTimestamp == 0) return;
+
+            _callbackTimestamp = 0;
+        }
+
+        /// <summary>
+        /// Records the decode stage of the event the current thread is handling, if it came from the background callback.
+        /// Returns the start of the handler for events whose listeners are invoked right away on the background thread.
+        /// </summary>
+        internal static HandlerSample OnEventDecoded(string eventName)
+        {
+            if (!_enabled) return default(HandlerSample);
+
+            var timestamp = Stopwatch.GetTimestamp();
+            var allocatedBytes = GetAllocatedBytes();
+            if (_callbackTimestamp != 0)
+            {
+                Record(eventName, MaxSdkBase.PipelineStage.Decode, timestamp - _callbackTimestamp, _callbackPayloadSize, allocatedBytes - _callbackAllocatedBytes);
+                _callbackTimestamp = 0;
+            }
+
+            return new HandlerSample {Timestamp = timestamp, AllocatedBytes = allocatedBytes};
+        }
+
+        /// <summary>
+        /// Records how long an event waited for the main thread, and returns the start of its handler.
+        /// </summary>
+        internal static HandlerSample OnEventDequeued(string eventName, long enqueueTimestamp)
+        {
+            if (!_enabled) return default(HandlerSample);
+
+            var timestamp = Stopwatch.GetTimestamp();
+            Record(eventName, MaxSdkBase.PipelineStage.Queue, timestamp - enqueueTimestamp, 0, 0);
+
+            return new HandlerSample {Timestamp = timestamp, AllocatedBytes = GetAllocatedBytes()};
+        }
+
+        internal static void OnHandlerReturned(string eventName, HandlerSample handlerSample)
+        {
+            if (handlerSample.Timestamp == 0 || !_enabled) return;
+
+            Record(eventName, MaxSdkBase.PipelineStage.Handler, Stopwatch.GetTimestamp() - handlerSample.Timestamp, 0, GetAllocatedBytes() - handlerSample.AllocatedBytes);
+        }
+
+        /// <summary>
+        /// Creates a snapshot of the managed stats merged with the first <paramref name="nativeValueCount"/> values copied from the native plugin, if any.
+        /// </summary>
+        internal static MaxSdkBase.PipelineStats CreateStats(long[] nativeValues, int nativeValueCount)
+        {
+            var values = _values;
+            var eventStats = new Dictionary<string, MaxSdkBase.PipelineStageStats[]>();
+            var totalStats = CreateEmptyStageStats();
+
+            for (var eventId = 0; eventId < EventSlotCount; eventId++)
+            {
+                MaxSdkBase.PipelineStageStats[] stageStats = null;
+                for (var stage = 0; stage < StageCount; stage++)
+                {
+                    var sourceValues = values;
+                    var offset = (eventId * StageCount + stage) * ValuesPerStage;
+                    var hasAllocatedBytes = true;
+                    if (stage < NativeStageCount)
+                    {
+                        sourceValues = nativeValues;
+                        offset = (eventId * NativeStageCount + stage) * NativeValuesPerStage;
+                        hasAllocatedBytes = false;
+                        if (sourceValues == null || offset + NativeValuesPerStage > nativeValueCount) continue;
+                    }
+                    else if (offset + ValuesPerStage > sourceValues.Length)
+                    {
+                        continue;
+                    }
+
+                    if (!HasSamples(sourceValues, offset)) continue;
+
+                    if (stageStats == null)
+                    {
+                        stageStats = CreateEmptyStageStats();
+                        eventStats[GetEventName(eventId)] = stageStats;
+                    }
+
+                    stageStats[stage].Add(sourceValues, offset, hasAllocatedBytes);
+                    totalStats[stage].Add(sourceValues, offset, hasAllocatedBytes);
+                }
+            }
+
+            var isEnabled = _enabled;
+            var elapsedSeconds = 0.0;
+            var collectionCount = 0;
+            if (_enabledTimestamp != 0)
+            {
+                elapsedSeconds = ((isEnabled ? Stopwatch.GetTimestamp() : _disabledTimestamp) - _enabledTimestamp) / (double) Stopwatch.Frequency;
+                collectionCount = (isEnabled ? GC.CollectionCount(0) : _disabledCollectionCount) - _enabledCollectionCount;
+            }
+
+            return new MaxSdkBase.PipelineStats(isEnabled, elapsedSeconds, collectionCount, eventStats, totalStats);
+        }
+
+        /// <summary>
+        /// Returns the bucket a duration falls into. Bucket <c>n</c> counts durations shorter than 2^n microseconds that did not fit in bucket <c>n - 1</c>.
+        /// </summary>
+        internal static int GetBucket(long microseconds)
+        {
+            var bucket = 0;
+            while (microseconds > 0 && bucket < BucketCount - 1)
+            {
+                microseconds >>= 1;
+                bucket++;
+            }
+
+            return bucket;
+        }
+
+        private static void Record(string eventName, MaxSdkBase.PipelineStage stage, long elapsedTicks, long bytes, long allocatedBytes)
+        {
+            var values = _values;
+            var eventId = MaxEventCodec.EventIdForName(eventName);
+            var offset = (eventId * StageCount + (int) stage) * ValuesPerStage;
+            if (offset + ValuesPerStage > values.Length) return;
+
+            var microseconds = Math.Max(elapsedTicks, 0) * 1000000 / Stopwatch.Frequency;
+            Interlocked.Increment(ref values[offset + GetBucket(microseconds)]);
+            Interlocked.Add(ref values[offset + TotalMicrosecondsIndex], microseconds);
+
+            if (bytes > 0)
+            {
+                Interlocked.Add(ref values[offset + BytesIndex], bytes);
+            }
+
+            if (allocatedBytes > 0)
+            {
+                Interlocked.Add(ref values[offset + AllocatedBytesIndex], allocatedBytes);
+            }
+        }
+
+        private static bool HasSamples(long[] values, int offset)
+        {
+            for (var bucket = 0; bucket < BucketCount; bucket++)
+            {
+                if (values[offset + bucket] != 0) return true;
+            }
+
+            return false;
+        }
+
+        private static MaxSdkBase.PipelineStageStats[] CreateEmptyStageStats()
+        {
+            var stageStats = new MaxSdkBase.PipelineStageStats[StageCount];
+            for (var stage = 0; stage < StageCount; stage++)
+            {
+                stageStats[stage] = new MaxSdkBase.PipelineStageStats();
+            }
+
+            return stageStats;
+        }
+
+        private static string GetEventName(int eventId)
+        {
+            return eventId > 0 && eventId < MaxEventCodec.EventNames.Length ? MaxEventCodec.EventNames[eventId] : MaxSdkBase.PipelineStats.OtherEventsName;
+        }
+
+        private static long GetAllocatedBytes()
+        {
+#if UNITY_2021_2_OR_NEWER
+            if (!_allocationTrackingSupported) return 0;
+
+            try
+            {
+                return GC.GetAllocatedBytesForCurrentThread();
+            }
+            catch (Exception)
+            {
+                // Not every scripting backend implements per-thread allocation counters
+                _allocationTrackingSupported = false;
+                return 0;
+            }
+#else
+            return 0;
+#endif
+        }
+    }
+}
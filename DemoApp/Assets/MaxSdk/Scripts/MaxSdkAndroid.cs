@@ -2,6 +2,7 @@ using System;
 using System.Collections.Generic;
 using UnityEngine;
 using AppLovinMax.ThirdParty.MiniJson;
+using AppLovinMax.Internal;
 
 #if UNITY_ANDROID
 /// <summary>
@@ -35,6 +36,9 @@ public class MaxSdkAndroid : MaxSdkBase
     {
         var serializedAdUnitIds = (adUnitIds != null) ? string.Join(",", adUnitIds) : "";
         MaxUnityPluginClass.CallStatic("initializeSdk", serializedAdUnitIds, GenerateMetaData());
+
+        // Verbose logging may also have been enabled in AndroidManifest.xml
+        MaxSdkLogger.VerboseLoggingEnabled = IsVerboseLoggingEnabled();
     }
 
     /// <summary>
@@ -117,10 +121,15 @@ public class MaxSdkAndroid : MaxSdkBase
     /// <returns>Arbitrary ad value for a given key, or null if no ad is loaded.</returns>
     public static string GetAdValue(string adUnitIdentifier, string key)
     {
-        var value = MaxUnityPluginClass.CallStatic<string>("getAdValue", adUnitIdentifier, key);
+        string value;
+        if (MaxAdStateSnapshot.TryGetAdValue(adUnitIdentifier, key, out value)) return value;
+
+        value = MaxUnityPluginClass.CallStatic<string>("getAdValue", adUnitIdentifier, key);
 
+        // A miss is not cached, since the value may be set once the ad loads
         if (string.IsNullOrEmpty(value)) return null;
 
+        MaxAdStateSnapshot.SetAdValue(adUnitIdentifier, key, value);
         return value;
     }
 
@@ -196,6 +205,25 @@ public class MaxSdkAndroid : MaxSdkBase
 
     #endregion
 
+    #region Ad Unit Handles
+
+    /// <summary>
+    /// Registers an ad unit and returns a handle that can be passed to the handle overloads of the hot ad calls, such as <see cref="IsInterstitialReady(int)"/>,
+    /// instead of the ad unit identifier. This avoids marshaling the identifier on every call, e.g. when checking readiness every frame.
+    /// Registering the same ad unit identifier again returns the same handle. Handles stay valid for the lifetime of the app.
+    ///
+    /// NOTE: On Android, handles are resolved in managed code, so calls still pass the ad unit identifier to the native plugin.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier to register. Must not be null.</param>
+    /// <returns>A positive handle, or 0 if the ad unit identifier is null or empty.</returns>
+    public static int RegisterAdUnit(string adUnitIdentifier)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "register ad unit");
+        return RegisterAdUnitHandle(adUnitIdentifier);
+    }
+
+    #endregion
+
     #region Banners
 
     /// <summary>
@@ -369,6 +397,40 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetBannerExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner extra parameters");
+
+        if (extraParameters == null) return;
+
+        foreach (var parameter in extraParameters)
+        {
+            SetBannerExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetBannerLocalExtraParameter"/>.</param>
+    public static void SetBannerLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner local extra parameters");
+
+        if (localExtraParameters == null) return;
+
+        foreach (var parameter in localExtraParameters)
+        {
+            SetBannerLocalExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
     /// <summary>
     /// The custom data to tie the showing banner ad to, for ILRD and rewarded postbacks via the <c>{CUSTOM_DATA}</c> macro. Maximum size is 8KB.
     /// </summary>
@@ -546,6 +608,40 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetMRecExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC extra parameters");
+
+        if (extraParameters == null) return;
+
+        foreach (var parameter in extraParameters)
+        {
+            SetMRecExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetMRecLocalExtraParameter"/>.</param>
+    public static void SetMRecLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC local extra parameters");
+
+        if (localExtraParameters == null) return;
+
+        foreach (var parameter in localExtraParameters)
+        {
+            SetMRecLocalExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
     /// <summary>
     /// The custom data to tie the showing MREC ad to, for ILRD and rewarded postbacks via the <c>{CUSTOM_DATA}</c> macro. Maximum size is 8KB.
     /// </summary>
@@ -581,9 +677,22 @@ public class MaxSdkAndroid : MaxSdkBase
     public static void LoadInterstitial(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load interstitial");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         MaxUnityPluginClass.CallStatic("loadInterstitial", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Start loading an interstitial using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to load.</param>
+    public static void LoadInterstitial(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load interstitial");
+        if (adUnitIdentifier == null) return;
+
+        LoadInterstitial(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if interstitial ad is loaded and ready to be displayed.
     /// </summary>
@@ -592,9 +701,26 @@ public class MaxSdkAndroid : MaxSdkBase
     public static bool IsInterstitialReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check interstitial loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return MaxUnityPluginClass.CallStatic<bool>("isInterstitialReady", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if an interstitial is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsInterstitialReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check interstitial loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsInterstitialReady(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Present loaded interstitial for a given placement to tie ad events to. Note: if the interstitial is not ready to be displayed nothing will happen.
     /// </summary>
@@ -605,8 +731,10 @@ public class MaxSdkAndroid : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show interstitial");
 
-        if (IsInterstitialReady(adUnitIdentifier))
+        var isReady = MaxAdStateSnapshot.StrictReadinessCheck ? MaxUnityPluginClass.CallStatic<bool>("isInterstitialReady", adUnitIdentifier) : IsInterstitialReady(adUnitIdentifier);
+        if (isReady)
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             MaxUnityPluginClass.CallStatic("showInterstitial", adUnitIdentifier, placement, customData);
         }
         else
@@ -615,6 +743,20 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded interstitial for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the interstitial is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowInterstitial(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show interstitial");
+        if (adUnitIdentifier == null) return;
+
+        ShowInterstitial(adUnitIdentifier, placement, customData);
+    }
+
     /// <summary>
     /// Set an extra parameter for the ad.
     /// </summary>
@@ -647,6 +789,40 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetInterstitialExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial extra parameters");
+
+        if (extraParameters == null) return;
+
+        foreach (var parameter in extraParameters)
+        {
+            SetInterstitialExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetInterstitialLocalExtraParameter"/>.</param>
+    public static void SetInterstitialLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial local extra parameters");
+
+        if (localExtraParameters == null) return;
+
+        foreach (var parameter in localExtraParameters)
+        {
+            SetInterstitialLocalExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
     #endregion
 
     #region App Open
@@ -658,9 +834,22 @@ public class MaxSdkAndroid : MaxSdkBase
     public static void LoadAppOpenAd(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load app open ad");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         MaxUnityPluginClass.CallStatic("loadAppOpenAd", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Start loading an app open ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to load.</param>
+    public static void LoadAppOpenAd(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load app open ad");
+        if (adUnitIdentifier == null) return;
+
+        LoadAppOpenAd(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if app open ad ad is loaded and ready to be displayed.
     /// </summary>
@@ -669,9 +858,26 @@ public class MaxSdkAndroid : MaxSdkBase
     public static bool IsAppOpenAdReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check app open ad loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return MaxUnityPluginClass.CallStatic<bool>("isAppOpenAdReady", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if an app open ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsAppOpenAdReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check app open ad loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsAppOpenAdReady(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Present loaded app open ad for a given placement to tie ad events to. Note: if the app open ad is not ready to be displayed nothing will happen.
     /// </summary>
@@ -682,8 +888,10 @@ public class MaxSdkAndroid : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show app open ad");
 
-        if (IsAppOpenAdReady(adUnitIdentifier))
+        var isReady = MaxAdStateSnapshot.StrictReadinessCheck ? MaxUnityPluginClass.CallStatic<bool>("isAppOpenAdReady", adUnitIdentifier) : IsAppOpenAdReady(adUnitIdentifier);
+        if (isReady)
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             MaxUnityPluginClass.CallStatic("showAppOpenAd", adUnitIdentifier, placement, customData);
         }
         else
@@ -692,6 +900,20 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded app open ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the app open ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowAppOpenAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show app open ad");
+        if (adUnitIdentifier == null) return;
+
+        ShowAppOpenAd(adUnitIdentifier, placement, customData);
+    }
+
     /// <summary>
     /// Set an extra parameter for the ad.
     /// </summary>
@@ -724,6 +946,40 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetAppOpenAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad extra parameters");
+
+        if (extraParameters == null) return;
+
+        foreach (var parameter in extraParameters)
+        {
+            SetAppOpenAdExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetAppOpenAdLocalExtraParameter"/>.</param>
+    public static void SetAppOpenAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad local extra parameters");
+
+        if (localExtraParameters == null) return;
+
+        foreach (var parameter in localExtraParameters)
+        {
+            SetAppOpenAdLocalExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
     #endregion
 
     #region Rewarded
@@ -735,9 +991,22 @@ public class MaxSdkAndroid : MaxSdkBase
     public static void LoadRewardedAd(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load rewarded ad");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         MaxUnityPluginClass.CallStatic("loadRewardedAd", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Start loading a rewarded ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to load.</param>
+    public static void LoadRewardedAd(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load rewarded ad");
+        if (adUnitIdentifier == null) return;
+
+        LoadRewardedAd(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if rewarded ad ad is loaded and ready to be displayed.
     /// </summary>
@@ -746,9 +1015,26 @@ public class MaxSdkAndroid : MaxSdkBase
     public static bool IsRewardedAdReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check rewarded ad loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return MaxUnityPluginClass.CallStatic<bool>("isRewardedAdReady", adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if a rewarded ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsRewardedAdReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check rewarded ad loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsRewardedAdReady(adUnitIdentifier);
+    }
+
     /// <summary> ready to be
     /// Present loaded rewarded ad for a given placement to tie ad events to. Note: if the rewarded ad is not ready to be displayed nothing will happen.
     /// </summary>
@@ -759,8 +1045,10 @@ public class MaxSdkAndroid : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show rewarded ad");
 
-        if (IsRewardedAdReady(adUnitIdentifier))
+        var isReady = MaxAdStateSnapshot.StrictReadinessCheck ? MaxUnityPluginClass.CallStatic<bool>("isRewardedAdReady", adUnitIdentifier) : IsRewardedAdReady(adUnitIdentifier);
+        if (isReady)
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             MaxUnityPluginClass.CallStatic("showRewardedAd", adUnitIdentifier, placement, customData);
         }
         else
@@ -769,6 +1057,20 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded rewarded ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the rewarded ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowRewardedAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show rewarded ad");
+        if (adUnitIdentifier == null) return;
+
+        ShowRewardedAd(adUnitIdentifier, placement, customData);
+    }
+
     /// <summary>
     /// Set an extra parameter for the ad.
     /// </summary>
@@ -801,6 +1103,40 @@ public class MaxSdkAndroid : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetRewardedAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad extra parameters");
+
+        if (extraParameters == null) return;
+
+        foreach (var parameter in extraParameters)
+        {
+            SetRewardedAdExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetRewardedAdLocalExtraParameter"/>.</param>
+    public static void SetRewardedAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad local extra parameters");
+
+        if (localExtraParameters == null) return;
+
+        foreach (var parameter in localExtraParameters)
+        {
+            SetRewardedAdLocalExtraParameter(adUnitIdentifier, parameter.Key, parameter.Value);
+        }
+    }
+
     #endregion
 
     #region Event Tracking
@@ -848,6 +1184,7 @@ public class MaxSdkAndroid : MaxSdkBase
     public static void SetVerboseLogging(bool enabled)
     {
         MaxUnityPluginClass.CallStatic("setVerboseLogging", enabled);
+        MaxSdkLogger.VerboseLoggingEnabled = enabled;
     }
 
     /// <summary>
@@ -907,6 +1244,91 @@ public class MaxSdkAndroid : MaxSdkBase
         MaxUnityPluginClass.CallStatic("setExtraParameter", key, value);
     }
 
+    /// <summary>
+    /// Whether ad events should be sent from the native plugin using a compact binary encoding instead of JSON. Defaults to <c>false</c>.
+    ///
+    /// NOTE: The binary encoding is currently only supported on iOS. Ad events on Android are always sent as JSON.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> if ad events should use the binary encoding.</param>
+    public static void SetBinaryEventEncodingEnabled(bool enabled) { }
+
+    /// <summary>
+    /// How long, in milliseconds, the native plugin holds an ad event so that events received shortly after are sent to Unity together. Defaults to <c>0</c>.
+    ///
+    /// NOTE: Event batching is currently only supported on iOS.
+    /// </summary>
+    /// <param name="milliseconds">The batching window in milliseconds, or <c>0</c> to send events as soon as possible.</param>
+    public static void SetEventBatchingWindow(int milliseconds) { }
+
+    /// <summary>
+    /// Returns a JSON description of every ad unit the native plugin is tracking, along with the approximate memory held by each record.
+    ///
+    /// NOTE: This is currently only supported on iOS. Returns an empty string on Android.
+    /// </summary>
+    public static string GetAdUnitStateDump()
+    {
+        return "";
+    }
+
+    /// <summary>
+    /// Sets how much of an ad's waterfall is included in every ad event, and clears any level set for individual events. Defaults to <see cref="MaxSdkBase.CallbackPayloadLevel.FullWaterfall"/>.
+    ///
+    /// NOTE: This is currently only supported on iOS.
+    /// </summary>
+    /// <param name="level">How much of the waterfall to include.</param>
+    public static void SetCallbackPayloadLevel(CallbackPayloadLevel level) { }
+
+    /// <summary>
+    /// Sets how much of an ad's waterfall is included in one ad event.
+    ///
+    /// NOTE: This is currently only supported on iOS.
+    /// </summary>
+    /// <param name="eventName">The name of the event, as listed in <see cref="MaxSdkBase.PipelineStats.EventNames"/>.</param>
+    /// <param name="level">How much of the waterfall to include.</param>
+    public static void SetCallbackPayloadLevel(string eventName, CallbackPayloadLevel level) { }
+
+    /// <summary>
+    /// Whether to record how long each ad event spends in each stage of the pipeline, until the listener returns. Defaults to <c>false</c>.
+    /// Enabling clears any previously recorded stats.
+    ///
+    /// NOTE: The native stages are currently only recorded on iOS. On Android, only the stages after Unity receives the event are recorded.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> to record pipeline stats.</param>
+    public static void SetPipelineStatsEnabled(bool enabled)
+    {
+        MaxPipelineStats.SetEnabled(enabled);
+    }
+
+    /// <summary>
+    /// Returns latency histograms for each stage of the ad event pipeline, per event, recorded since pipeline stats were last enabled.
+    /// See <see cref="SetPipelineStatsEnabled"/>.
+    /// </summary>
+    public static PipelineStats GetPipelineStats()
+    {
+        return MaxPipelineStats.CreateStats(null, 0);
+    }
+
+    /// <summary>
+    /// Whether to record a timeline of calls from the native plugin into Unity and ad event listeners into a fixed size buffer that keeps the most recent spans. Defaults to <c>false</c>.
+    /// Enabling clears any previously recorded spans.
+    ///
+    /// NOTE: Native spans are currently only recorded on iOS.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> to record a timeline.</param>
+    public static void SetTimelineTracingEnabled(bool enabled)
+    {
+        MaxTimelineTracer.SetEnabled(enabled);
+    }
+
+    /// <summary>
+    /// Returns the recorded timeline as Chrome trace-event JSON, which can be saved to a file and opened in a trace viewer such as Perfetto or <c>chrome://tracing</c>.
+    /// See <see cref="SetTimelineTracingEnabled"/>.
+    /// </summary>
+    public static string GetTimelineTraceJson()
+    {
+        return MaxTimelineTracer.ToChromeTraceJson(null, 0, 0);
+    }
+
     /// <summary>
     /// Get the native insets in pixels for the safe area.
     /// These insets are used to position ads within the safe area of the screen.
@@ -928,6 +1350,15 @@ public class MaxSdkAndroid : MaxSdkBase
 
     #endregion
 
+    #region Internal
+
+    /// <summary>
+    /// The Android plugin forwards every ad event; <see cref="MaxSdkCallbacks"/> skips decoding the ones without listeners.
+    /// </summary>
+    internal static void SetEventSubscriptionMask(ulong mask) { }
+
+    #endregion
+
     #region Obsolete
 
     [Obsolete("This API has been deprecated and will be removed in a future release. Please use CreateBanner(string adUnitIdentifier, AdViewConfiguration configuration) instead.")]
@@ -4,6 +4,7 @@ using System.Collections.Generic;
 using System.Globalization;
 using System.Linq;
 using System.Text;
+using System.Threading;
 using AppLovinMax.ThirdParty.MiniJson;
 using AppLovinMax.Internal;
 using UnityEngine;
@@ -231,14 +232,63 @@ public abstract class MaxSdkBase
 #endif
 
         public static SdkConfiguration Create(IDictionary<string, object> eventProps)
+        {
+            return Create(MaxSdkUtils.GetBoolFromDictionary(eventProps, "isSuccessfullyInitialized"),
+                MaxSdkUtils.GetStringFromDictionary(eventProps, "countryCode", ""),
+                MaxSdkUtils.GetBoolFromDictionary(eventProps, "isTestModeEnabled"),
+                MaxSdkUtils.GetStringFromDictionary(eventProps, "consentFlowUserGeography", ""),
+                MaxSdkUtils.GetStringFromDictionary(eventProps, "consentDialogState", ""),
+                MaxSdkUtils.GetStringFromDictionary(eventProps, "appTrackingStatus", "-1"));
+        }
+
+        internal static SdkConfiguration Create(MaxJsonReader eventReader)
+        {
+            var isSuccessfullyInitialized = false;
+            var countryCode = "";
+            var isTestModeEnabled = false;
+            var consentFlowUserGeographyStr = "";
+            var consentDialogStateStr = "";
+            var appTrackingStatusStr = "-1";
+
+            while (eventReader.MoveNext())
+            {
+                if (eventReader.NameEquals("isSuccessfullyInitialized"))
+                {
+                    isSuccessfullyInitialized = eventReader.ReadBool();
+                }
+                else if (eventReader.NameEquals("countryCode"))
+                {
+                    countryCode = eventReader.ReadString();
+                }
+                else if (eventReader.NameEquals("isTestModeEnabled"))
+                {
+                    isTestModeEnabled = eventReader.ReadBool();
+                }
+                else if (eventReader.NameEquals("consentFlowUserGeography"))
+                {
+                    consentFlowUserGeographyStr = eventReader.ReadString();
+                }
+                else if (eventReader.NameEquals("consentDialogState"))
+                {
+                    consentDialogStateStr = eventReader.ReadString();
+                }
+                else if (eventReader.NameEquals("appTrackingStatus"))
+                {
+                    appTrackingStatusStr = eventReader.ReadString();
+                }
+            }
+
+            return Create(isSuccessfullyInitialized, countryCode, isTestModeEnabled, consentFlowUserGeographyStr, consentDialogStateStr, appTrackingStatusStr);
+        }
+
+        private static SdkConfiguration Create(bool isSuccessfullyInitialized, string countryCode, bool isTestModeEnabled, string consentFlowUserGeographyStr, string consentDialogStateStr, string appTrackingStatusStr)
         {
             var sdkConfiguration = new SdkConfiguration();
 
-            sdkConfiguration.IsSuccessfullyInitialized = MaxSdkUtils.GetBoolFromDictionary(eventProps, "isSuccessfullyInitialized");
-            sdkConfiguration.CountryCode = MaxSdkUtils.GetStringFromDictionary(eventProps, "countryCode", "");
-            sdkConfiguration.IsTestModeEnabled = MaxSdkUtils.GetBoolFromDictionary(eventProps, "isTestModeEnabled");
+            sdkConfiguration.IsSuccessfullyInitialized = isSuccessfullyInitialized;
+            sdkConfiguration.CountryCode = countryCode;
+            sdkConfiguration.IsTestModeEnabled = isTestModeEnabled;
 
-            var consentFlowUserGeographyStr = MaxSdkUtils.GetStringFromDictionary(eventProps, "consentFlowUserGeography", "");
             if ("1".Equals(consentFlowUserGeographyStr))
             {
                 sdkConfiguration.ConsentFlowUserGeography = ConsentFlowUserGeography.Gdpr;
@@ -253,7 +303,6 @@ public abstract class MaxSdkBase
             }
 
 #pragma warning disable 0618
-            var consentDialogStateStr = MaxSdkUtils.GetStringFromDictionary(eventProps, "consentDialogState", "");
             if ("1".Equals(consentDialogStateStr))
             {
                 sdkConfiguration.ConsentDialogState = ConsentDialogState.Applies;
@@ -269,7 +318,6 @@ public abstract class MaxSdkBase
 #pragma warning restore 0618
 
 #if UNITY_IPHONE || UNITY_IOS
-            var appTrackingStatusStr = MaxSdkUtils.GetStringFromDictionary(eventProps, "appTrackingStatus", "-1");
             if ("-1".Equals(appTrackingStatusStr))
             {
                 sdkConfiguration.AppTrackingStatus = AppTrackingStatus.Unavailable;
@@ -419,7 +467,7 @@ public abstract class MaxSdkBase
         FailedToLoad
     }
 
-    public class AdInfo
+    public class AdInfo : IMaxPooledPayload
     {
         public string AdUnitIdentifier { get; private set; }
         public string AdFormat { get; private set; }
@@ -429,10 +477,37 @@ public abstract class MaxSdkBase
         public string CreativeIdentifier { get; private set; }
         public double Revenue { get; private set; }
         public string RevenuePrecision { get; private set; }
-        public WaterfallInfo WaterfallInfo { get; private set; }
+        public WaterfallInfo WaterfallInfo
+        {
+            get
+            {
+                if (_waterfallInfo == null)
+                {
+                    // NOTE: Two threads may race to decode the waterfall, only the first result is published
+                    Interlocked.CompareExchange(ref _waterfallInfo, WaterfallInfo.Decode(_waterfallInfoDictionary, _waterfallInfoReader), null);
+                }
+
+                return _waterfallInfo;
+            }
+        }
+
         public long LatencyMillis { get; private set; }
         public string DspName { get; private set; }
 
+        // The waterfall is only decoded on first access to WaterfallInfo, since most ad event handlers never read it
+        private WaterfallInfo _waterfallInfo;
+        private IDictionary<string, object> _waterfallInfoDictionary;
+        private MaxEventReader _waterfallInfoReader;
+
+        // Pooling state, see PooledCallbackPayloadsEnabled. The waterfall buffer is reused each time the instance is recycled.
+        private byte[] _waterfallInfoBuffer;
+        private int _poolReferenceCount;
+        private volatile bool _isPooled;
+        private volatile bool _isRetained;
+        private volatile bool _isPoisoned;
+
+        internal AdInfo() { }
+
         public AdInfo(IDictionary<string, object> adInfoDictionary)
         {
             AdUnitIdentifier = MaxSdkUtils.GetStringFromDictionary(adInfoDictionary, "adUnitId");
@@ -443,11 +518,81 @@ public abstract class MaxSdkBase
             Placement = MaxSdkUtils.GetStringFromDictionary(adInfoDictionary, "placement");
             Revenue = MaxSdkUtils.GetDoubleFromDictionary(adInfoDictionary, "revenue", -1);
             RevenuePrecision = MaxSdkUtils.GetStringFromDictionary(adInfoDictionary, "revenuePrecision");
-            WaterfallInfo = new WaterfallInfo(MaxSdkUtils.GetDictionaryFromDictionary(adInfoDictionary, "waterfallInfo", new Dictionary<string, object>()));
+            _waterfallInfoDictionary = MaxSdkUtils.GetDictionaryFromDictionary(adInfoDictionary, "waterfallInfo", new Dictionary<string, object>());
             LatencyMillis = MaxSdkUtils.GetLongFromDictionary(adInfoDictionary, "latencyMillis");
             DspName = MaxSdkUtils.GetStringFromDictionary(adInfoDictionary, "dspName");
         }
 
+        internal AdInfo(MaxEventReader reader)
+        {
+            Initialize(reader, false);
+        }
+
+        /// <summary>
+        /// Decodes the ad info from <paramref name="reader"/>, replacing any values this instance held for a previous event.
+        /// </summary>
+        /// <param name="reader">The cursor over the ad info fields.</param>
+        /// <param name="isPooled">Whether the instance was rented from <see cref="MaxCallbackPayloadPool"/>, which then owns it until it is released.</param>
+        internal void Initialize(MaxEventReader reader, bool isPooled)
+        {
+            AdUnitIdentifier = "";
+            AdFormat = "";
+            NetworkName = "";
+            NetworkPlacement = "";
+            CreativeIdentifier = "";
+            Placement = "";
+            Revenue = -1;
+            RevenuePrecision = "";
+            LatencyMillis = 0;
+            DspName = "";
+            _waterfallInfo = null;
+            _waterfallInfoReader = default(MaxEventReader);
+            _isRetained = false;
+            _isPoisoned = false;
+            _poolReferenceCount = isPooled ? 1 : 0;
+            _isPooled = isPooled;
+
+            while (reader.MoveNext())
+            {
+                switch (reader.FieldId)
+                {
+                    case MaxEventCodec.FieldAdUnitId:
+                        AdUnitIdentifier = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldAdFormat:
+                        AdFormat = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldNetworkName:
+                        NetworkName = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldNetworkPlacement:
+                        NetworkPlacement = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldCreativeId:
+                        CreativeIdentifier = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldPlacement:
+                        Placement = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldRevenue:
+                        Revenue = reader.ReadDouble(-1);
+                        break;
+                    case MaxEventCodec.FieldRevenuePrecision:
+                        RevenuePrecision = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldWaterfallInfo:
+                        _waterfallInfoReader = isPooled ? reader.ReadRetainedContainer(ref _waterfallInfoBuffer) : reader.ReadRetainedContainer();
+                        break;
+                    case MaxEventCodec.FieldLatencyMillis:
+                        LatencyMillis = reader.ReadLong();
+                        break;
+                    case MaxEventCodec.FieldDspName:
+                        DspName = reader.ReadString();
+                        break;
+                }
+            }
+        }
+
         public override string ToString()
         {
             return "[AdInfo adUnitIdentifier: " + AdUnitIdentifier +
@@ -461,6 +606,65 @@ public abstract class MaxSdkBase
                    ", latency: " + LatencyMillis +
                    ", dspName: " + DspName + "]";
         }
+
+        /// <summary>
+        /// Keeps this instance valid after the callback it was passed to returns. Only needed while <see cref="PooledCallbackPayloadsEnabled"/> is set,
+        /// since pooled instances are reused for later events once their callback returns. Must be called from within the callback.
+        /// </summary>
+        /// <returns>This instance.</returns>
+        public AdInfo Retain()
+        {
+            if (_isPoisoned)
+            {
+                MaxSdkLogger.UserError("AdInfo.Retain() was called after its callback returned. Pooled callback payloads must be retained from within the callback.");
+            }
+
+            _isRetained = true;
+            return this;
+        }
+
+        bool IMaxPooledPayload.IsPooled
+        {
+            get { return _isPooled; }
+        }
+
+        bool IMaxPooledPayload.IsRetained
+        {
+            get { return _isRetained; }
+        }
+
+        void IMaxPooledPayload.AddReference()
+        {
+            Interlocked.Increment(ref _poolReferenceCount);
+        }
+
+        int IMaxPooledPayload.ReleaseReference()
+        {
+            return Interlocked.Decrement(ref _poolReferenceCount);
+        }
+
+        void IMaxPooledPayload.Detach()
+        {
+            _isPooled = false;
+        }
+
+        void IMaxPooledPayload.Poison()
+        {
+            _isPooled = false;
+            _isPoisoned = true;
+            AdUnitIdentifier = MaxCallbackPayloadPool.PoisonedString;
+            AdFormat = MaxCallbackPayloadPool.PoisonedString;
+            NetworkName = MaxCallbackPayloadPool.PoisonedString;
+            NetworkPlacement = MaxCallbackPayloadPool.PoisonedString;
+            CreativeIdentifier = MaxCallbackPayloadPool.PoisonedString;
+            Placement = MaxCallbackPayloadPool.PoisonedString;
+            Revenue = double.NaN;
+            RevenuePrecision = MaxCallbackPayloadPool.PoisonedString;
+            LatencyMillis = -1;
+            DspName = MaxCallbackPayloadPool.PoisonedString;
+            _waterfallInfo = null;
+            _waterfallInfoReader = default(MaxEventReader);
+        }
     }
 
     /// <summary>
@@ -492,6 +696,44 @@ public abstract class MaxSdkBase
             LatencyMillis = MaxSdkUtils.GetLongFromDictionary(waterfallInfoDict, "latencyMillis");
         }
 
+        internal static WaterfallInfo Decode(IDictionary<string, object> waterfallInfoDict, MaxEventReader reader)
+        {
+            return waterfallInfoDict != null ? new WaterfallInfo(waterfallInfoDict) : new WaterfallInfo(reader);
+        }
+
+        internal WaterfallInfo(MaxEventReader reader)
+        {
+            Name = "";
+            TestName = "";
+            NetworkResponses = new List<NetworkResponseInfo>();
+
+            while (reader.MoveNext())
+            {
+                switch (reader.FieldId)
+                {
+                    case MaxEventCodec.FieldName:
+                        Name = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldTestName:
+                        TestName = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldNetworkResponses:
+                        var networkResponses = reader.ReadContainer();
+                        while (networkResponses.MoveNext())
+                        {
+                            if (networkResponses.ValueType != MaxEventCodec.ValueTypeObject) continue;
+
+                            NetworkResponses.Add(new NetworkResponseInfo(networkResponses.ReadContainer()));
+                        }
+
+                        break;
+                    case MaxEventCodec.FieldLatencyMillis:
+                        LatencyMillis = reader.ReadLong();
+                        break;
+                }
+            }
+        }
+
         public override string ToString()
         {
             return "[MediatedNetworkInfo: name = " + Name +
@@ -524,6 +766,39 @@ public abstract class MaxSdkBase
             Error = errorInfoDict != null ? new ErrorInfo(errorInfoDict) : null;
         }
 
+        internal NetworkResponseInfo(MaxEventReader reader)
+        {
+            while (reader.MoveNext())
+            {
+                switch (reader.FieldId)
+                {
+                    case MaxEventCodec.FieldMediatedNetwork:
+                        MediatedNetwork = new MediatedNetworkInfo(reader.ReadContainer());
+                        break;
+                    case MaxEventCodec.FieldCredentials:
+                        Credentials = reader.ReadMap();
+                        break;
+                    case MaxEventCodec.FieldIsBidding:
+                        IsBidding = reader.ReadBool();
+                        break;
+                    case MaxEventCodec.FieldLatencyMillis:
+                        LatencyMillis = reader.ReadLong();
+                        break;
+                    case MaxEventCodec.FieldAdLoadState:
+                        AdLoadState = (MaxAdLoadState) reader.ReadInt();
+                        break;
+                    case MaxEventCodec.FieldError:
+                        Error = new ErrorInfo(reader.ReadContainer());
+                        break;
+                }
+            }
+
+            if (Credentials == null)
+            {
+                Credentials = new Dictionary<string, object>();
+            }
+        }
+
         public override string ToString()
         {
             var stringBuilder = new StringBuilder("[NetworkResponseInfo: adLoadState = ").Append(AdLoadState);
@@ -563,6 +838,37 @@ public abstract class MaxSdkBase
             InitializationStatus = InitializationStatusFromCode(initializationStatusInt);
         }
 
+        internal MediatedNetworkInfo(MaxEventReader reader)
+        {
+            Name = "";
+            AdapterClassName = "";
+            AdapterVersion = "";
+            SdkVersion = "";
+            InitializationStatus = InitializationStatus.NotInitialized;
+
+            while (reader.MoveNext())
+            {
+                switch (reader.FieldId)
+                {
+                    case MaxEventCodec.FieldName:
+                        Name = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldAdapterClassName:
+                        AdapterClassName = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldAdapterVersion:
+                        AdapterVersion = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldSdkVersion:
+                        SdkVersion = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldInitializationStatus:
+                        InitializationStatus = InitializationStatusFromCode(reader.ReadInt((int) InitializationStatus.NotInitialized));
+                        break;
+                }
+            }
+        }
+
         public override string ToString()
         {
             return "[MediatedNetworkInfo name: " + Name +
@@ -585,16 +891,42 @@ public abstract class MaxSdkBase
         }
     }
 
-    public class ErrorInfo
+    public class ErrorInfo : IMaxPooledPayload
     {
         public ErrorCode Code { get; private set; }
         public string Message { get; private set; }
         public int MediatedNetworkErrorCode { get; private set; }
         public string MediatedNetworkErrorMessage { get; private set; }
         public string AdLoadFailureInfo { get; private set; }
-        public WaterfallInfo WaterfallInfo { get; private set; }
+        public WaterfallInfo WaterfallInfo
+        {
+            get
+            {
+                if (_waterfallInfo == null)
+                {
+                    Interlocked.CompareExchange(ref _waterfallInfo, WaterfallInfo.Decode(_waterfallInfoDictionary, _waterfallInfoReader), null);
+                }
+
+                return _waterfallInfo;
+            }
+        }
+
         public long LatencyMillis { get; private set; }
 
+        // Decoded on first access, same as AdInfo.WaterfallInfo
+        private WaterfallInfo _waterfallInfo;
+        private IDictionary<string, object> _waterfallInfoDictionary;
+        private MaxEventReader _waterfallInfoReader;
+
+        // Pooling state, see PooledCallbackPayloadsEnabled. The waterfall buffer is reused each time the instance is recycled.
+        private byte[] _waterfallInfoBuffer;
+        private int _poolReferenceCount;
+        private volatile bool _isPooled;
+        private volatile bool _isRetained;
+        private volatile bool _isPoisoned;
+
+        internal ErrorInfo() { }
+
         public ErrorInfo(IDictionary<string, object> errorInfoDictionary)
         {
             Code = (ErrorCode) MaxSdkUtils.GetIntFromDictionary(errorInfoDictionary, "errorCode", -1);
@@ -602,10 +934,62 @@ public abstract class MaxSdkBase
             MediatedNetworkErrorCode = MaxSdkUtils.GetIntFromDictionary(errorInfoDictionary, "mediatedNetworkErrorCode", (int) ErrorCode.Unspecified);
             MediatedNetworkErrorMessage = MaxSdkUtils.GetStringFromDictionary(errorInfoDictionary, "mediatedNetworkErrorMessage", "");
             AdLoadFailureInfo = MaxSdkUtils.GetStringFromDictionary(errorInfoDictionary, "adLoadFailureInfo", "");
-            WaterfallInfo = new WaterfallInfo(MaxSdkUtils.GetDictionaryFromDictionary(errorInfoDictionary, "waterfallInfo", new Dictionary<string, object>()));
+            _waterfallInfoDictionary = MaxSdkUtils.GetDictionaryFromDictionary(errorInfoDictionary, "waterfallInfo", new Dictionary<string, object>());
             LatencyMillis = MaxSdkUtils.GetLongFromDictionary(errorInfoDictionary, "latencyMillis");
         }
 
+        internal ErrorInfo(MaxEventReader reader)
+        {
+            Initialize(reader, false);
+        }
+
+        /// <summary>
+        /// Same as <see cref="AdInfo.Initialize"/>.
+        /// </summary>
+        internal void Initialize(MaxEventReader reader, bool isPooled)
+        {
+            Code = ErrorCode.Unspecified;
+            Message = "";
+            MediatedNetworkErrorCode = (int) ErrorCode.Unspecified;
+            MediatedNetworkErrorMessage = "";
+            AdLoadFailureInfo = "";
+            LatencyMillis = 0;
+            _waterfallInfo = null;
+            _waterfallInfoReader = default(MaxEventReader);
+            _isRetained = false;
+            _isPoisoned = false;
+            _poolReferenceCount = isPooled ? 1 : 0;
+            _isPooled = isPooled;
+
+            while (reader.MoveNext())
+            {
+                switch (reader.FieldId)
+                {
+                    case MaxEventCodec.FieldErrorCode:
+                        Code = (ErrorCode) reader.ReadInt((int) ErrorCode.Unspecified);
+                        break;
+                    case MaxEventCodec.FieldErrorMessage:
+                        Message = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldMediatedNetworkErrorCode:
+                        MediatedNetworkErrorCode = reader.ReadInt((int) ErrorCode.Unspecified);
+                        break;
+                    case MaxEventCodec.FieldMediatedNetworkErrorMessage:
+                        MediatedNetworkErrorMessage = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldAdLoadFailureInfo:
+                        AdLoadFailureInfo = reader.ReadString();
+                        break;
+                    case MaxEventCodec.FieldWaterfallInfo:
+                        _waterfallInfoReader = isPooled ? reader.ReadRetainedContainer(ref _waterfallInfoBuffer) : reader.ReadRetainedContainer();
+                        break;
+                    case MaxEventCodec.FieldLatencyMillis:
+                        LatencyMillis = reader.ReadLong();
+                        break;
+                }
+            }
+        }
+
         public override string ToString()
         {
             var stringbuilder = new StringBuilder("[ErrorInfo code: ").Append(Code);
@@ -620,6 +1004,60 @@ public abstract class MaxSdkBase
             stringbuilder.Append(", latency: ").Append(LatencyMillis);
             return stringbuilder.Append(", adLoadFailureInfo: ").Append(AdLoadFailureInfo).Append("]").ToString();
         }
+
+        /// <summary>
+        /// Keeps this instance valid after the callback it was passed to returns. See <see cref="AdInfo.Retain"/>.
+        /// </summary>
+        /// <returns>This instance.</returns>
+        public ErrorInfo Retain()
+        {
+            if (_isPoisoned)
+            {
+                MaxSdkLogger.UserError("ErrorInfo.Retain() was called after its callback returned. Pooled callback payloads must be retained from within the callback.");
+            }
+
+            _isRetained = true;
+            return this;
+        }
+
+        bool IMaxPooledPayload.IsPooled
+        {
+            get { return _isPooled; }
+        }
+
+        bool IMaxPooledPayload.IsRetained
+        {
+            get { return _isRetained; }
+        }
+
+        void IMaxPooledPayload.AddReference()
+        {
+            Interlocked.Increment(ref _poolReferenceCount);
+        }
+
+        int IMaxPooledPayload.ReleaseReference()
+        {
+            return Interlocked.Decrement(ref _poolReferenceCount);
+        }
+
+        void IMaxPooledPayload.Detach()
+        {
+            _isPooled = false;
+        }
+
+        void IMaxPooledPayload.Poison()
+        {
+            _isPooled = false;
+            _isPoisoned = true;
+            Code = ErrorCode.Unspecified;
+            Message = MaxCallbackPayloadPool.PoisonedString;
+            MediatedNetworkErrorCode = (int) ErrorCode.Unspecified;
+            MediatedNetworkErrorMessage = MaxCallbackPayloadPool.PoisonedString;
+            AdLoadFailureInfo = MaxCallbackPayloadPool.PoisonedString;
+            LatencyMillis = -1;
+            _waterfallInfo = null;
+            _waterfallInfoReader = default(MaxEventReader);
+        }
     }
 
     /// <summary>
@@ -653,11 +1091,436 @@ public abstract class MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Stats about how ad events are dispatched on the Unity main thread. See <see cref="MaxSdkBase.GetEventDispatchStats"/>.
+    /// </summary>
+    public class EventDispatchStats
+    {
+        /// <summary>
+        /// The number of events dispatched on the main thread since the app started.
+        /// </summary>
+        public long DispatchedEventCount { get; private set; }
+
+        /// <summary>
+        /// The number of events that were pushed to a later frame because the frame budget ran out. Each event is counted once, however many frames it waits.
+        /// </summary>
+        public long DeferredEventCount { get; private set; }
+
+        /// <summary>
+        /// The number of events waiting to be dispatched.
+        /// </summary>
+        public int PendingEventCount { get; private set; }
+
+        /// <summary>
+        /// The longest time, in milliseconds, an event has waited between being received and being dispatched.
+        /// </summary>
+        public double MaxQueueAgeMilliseconds { get; private set; }
+
+        /// <summary>
+        /// How long, in milliseconds, the oldest pending event has been waiting. <c>0</c> if there are no pending events.
+        /// </summary>
+        public double OldestPendingEventAgeMilliseconds { get; private set; }
+
+        internal EventDispatchStats(long dispatchedEventCount, long deferredEventCount, int pendingEventCount, double maxQueueAgeMilliseconds, double oldestPendingEventAgeMilliseconds)
+        {
+            DispatchedEventCount = dispatchedEventCount;
+            DeferredEventCount = deferredEventCount;
+            PendingEventCount = pendingEventCount;
+            MaxQueueAgeMilliseconds = maxQueueAgeMilliseconds;
+            OldestPendingEventAgeMilliseconds = oldestPendingEventAgeMilliseconds;
+        }
+
+        public override string ToString()
+        {
+            return "[EventDispatchStats dispatchedEventCount: " + DispatchedEventCount +
+                   ", deferredEventCount: " + DeferredEventCount +
+                   ", pendingEventCount: " + PendingEventCount +
+                   ", maxQueueAgeMilliseconds: " + MaxQueueAgeMilliseconds +
+                   ", oldestPendingEventAgeMilliseconds: " + OldestPendingEventAgeMilliseconds + "]";
+        }
+    }
+
+    /// <summary>
+    /// How much of an ad's waterfall the native plugin includes in ad events. See <see cref="MaxSdk.SetCallbackPayloadLevel(CallbackPayloadLevel)"/>.
+    /// </summary>
+    public enum CallbackPayloadLevel
+    {
+        /// <summary>
+        /// No waterfall. <see cref="AdInfo.WaterfallInfo"/> and <see cref="ErrorInfo.WaterfallInfo"/> are empty.
+        /// </summary>
+        Minimal = 0,
+
+        /// <summary>
+        /// The waterfall and the name, state, latency and error of each network response, without network credentials, adapter details or ad load failure info.
+        /// </summary>
+        Standard = 1,
+
+        /// <summary>
+        /// The whole waterfall. This is the default.
+        /// </summary>
+        FullWaterfall = 2
+    }
+
+    /// <summary>
+    /// A stage of the ad event pipeline. See <see cref="PipelineStats"/>.
+    /// </summary>
+    public enum PipelineStage
+    {
+        /// <summary>
+        /// From the native SDK calling the plugin until the event is serialized, including any time spent in the event batching window. Only recorded on iOS.
+        /// </summary>
+        NativeBuild = 0,
+
+        /// <summary>
+        /// From the event being serialized until it is handed to Unity, e.g. while the rest of its batch is serialized. Only recorded on iOS.
+        /// </summary>
+        NativeHandoff = 1,
+
+        /// <summary>
+        /// From Unity receiving the event until it is decoded and queued for the main thread, or passed to a listener that runs in the background.
+        /// </summary>
+        Decode = 2,
+
+        /// <summary>
+        /// From the event being queued until it is dequeued on the main thread.
+        /// </summary>
+        Queue = 3,
+
+        /// <summary>
+        /// From the listener being called until it returns.
+        /// </summary>
+        Handler = 4
+    }
+
+    /// <summary>
+    /// A latency histogram for one stage of the ad event pipeline, along with the bytes and managed allocations attributed to that stage.
+    /// </summary>
+    public class PipelineStageStats
+    {
+        private readonly long[] _bucketCounts = new long[PipelineStats.BucketCount];
+
+        /// <summary>
+        /// The number of samples recorded.
+        /// </summary>
+        public long Count { get; private set; }
+
+        /// <summary>
+        /// The sum of every sample, in milliseconds.
+        /// </summary>
+        public double TotalMilliseconds { get; private set; }
+
+        public double AverageMilliseconds
+        {
+            get { return Count > 0 ? TotalMilliseconds / Count : 0; }
+        }
+
+        /// <summary>
+        /// The serialized event bytes for <see cref="PipelineStage.NativeBuild"/>, or the payload received by Unity for <see cref="PipelineStage.Decode"/>. JSON payloads received by Unity are counted in characters.
+        /// </summary>
+        public long Bytes { get; private set; }
+
+        /// <summary>
+        /// The managed bytes allocated by <see cref="PipelineStage.Decode"/> and <see cref="PipelineStage.Handler"/>. Only tracked on Unity 2021.2 or newer, and only on scripting backends that support it.
+        /// </summary>
+        public long AllocatedBytes { get; private set; }
+
+        public double AllocatedBytesPerSample
+        {
+            get { return Count > 0 ? (double) AllocatedBytes / Count : 0; }
+        }
+
+        /// <summary>
+        /// Returns the number of samples in a bucket. See <see cref="PipelineStats.GetBucketUpperBoundMilliseconds"/>.
+        /// </summary>
+        public long GetBucketCount(int bucket)
+        {
+            return bucket >= 0 && bucket < _bucketCounts.Length ? _bucketCounts[bucket] : 0;
+        }
+
+        /// <summary>
+        /// Returns the upper bound of the bucket holding the given percentile, e.g. <c>99</c> for p99, or <c>0</c> if there are no samples.
+        /// Samples in the last bucket have no upper bound and are reported as its lower bound.
+        /// </summary>
+        public double GetPercentileMilliseconds(double percentile)
+        {
+            if (Count == 0) return 0;
+
+            var rank = (long) Math.Ceiling(Count * Math.Min(Math.Max(percentile, 0), 100) / 100.0);
+            var cumulativeCount = 0L;
+            for (var bucket = 0; bucket < _bucketCounts.Length - 1; bucket++)
+            {
+                cumulativeCount += _bucketCounts[bucket];
+                if (cumulativeCount >= rank) return PipelineStats.GetBucketUpperBoundMilliseconds(bucket);
+            }
+
+            return PipelineStats.GetBucketUpperBoundMilliseconds(_bucketCounts.Length - 2);
+        }
+
+        internal void Add(long[] values, int offset, bool hasAllocatedBytes)
+        {
+            for (var bucket = 0; bucket < _bucketCounts.Length; bucket++)
+            {
+                _bucketCounts[bucket] += values[offset + bucket];
+                Count += values[offset + bucket];
+            }
+
+            TotalMilliseconds += values[offset + _bucketCounts.Length] / 1000.0;
+            Bytes += values[offset + _bucketCounts.Length + 1];
+            if (hasAllocatedBytes)
+            {
+                AllocatedBytes += values[offset + _bucketCounts.Length + 2];
+            }
+        }
+
+        public override string ToString()
+        {
+            return "[PipelineStageStats count: " + Count +
+                   ", averageMilliseconds: " + AverageMilliseconds +
+                   ", p50Milliseconds: " + GetPercentileMilliseconds(50) +
+                   ", p99Milliseconds: " + GetPercentileMilliseconds(99) +
+                   ", bytes: " + Bytes +
+                   ", allocatedBytes: " + AllocatedBytes + "]";
+        }
+
+        internal Dictionary<string, object> ToDictionary()
+        {
+            var bucketCounts = new List<object>(_bucketCounts.Length);
+            foreach (var bucketCount in _bucketCounts)
+            {
+                bucketCounts.Add(bucketCount);
+            }
+
+            // Durations are whole microseconds, so the output does not depend on the current culture's number format
+            return new Dictionary<string, object>
+            {
+                {"count", Count},
+                {"totalMicroseconds", (long) Math.Round(TotalMilliseconds * 1000)},
+                {"p50Microseconds", (long) Math.Round(GetPercentileMilliseconds(50) * 1000)},
+                {"p99Microseconds", (long) Math.Round(GetPercentileMilliseconds(99) * 1000)},
+                {"bytes", Bytes},
+                {"allocatedBytes", AllocatedBytes},
+                {"buckets", bucketCounts}
+            };
+        }
+    }
+
+    /// <summary>
+    /// Latency histograms for each stage of the ad event pipeline, per event. See <see cref="MaxSdk.GetPipelineStats"/>.
+    ///
+    /// Native and managed stages are timed with separate clocks, so the time between <see cref="PipelineStage.NativeHandoff"/> and <see cref="PipelineStage.Decode"/> is not included.
+    /// </summary>
+    public class PipelineStats
+    {
+        /// <summary>
+        /// The name that events without a dedicated entry, such as <c>OnSdkInitializedEvent</c>, are grouped under.
+        /// </summary>
+        public const string OtherEventsName = "Other";
+
+        public const int BucketCount = MaxPipelineStats.BucketCount;
+
+        private static readonly PipelineStageStats EmptyStageStats = new PipelineStageStats();
+
+        private readonly Dictionary<string, PipelineStageStats[]> _eventStats;
+        private readonly PipelineStageStats[] _totalStats;
+
+        /// <summary>
+        /// Whether stats were being recorded when this snapshot was taken.
+        /// </summary>
+        public bool IsEnabled { get; private set; }
+
+        /// <summary>
+        /// How long stats have been recorded for, in seconds, from when they were enabled until this snapshot was taken or they were disabled.
+        /// </summary>
+        public double ElapsedSeconds { get; private set; }
+
+        /// <summary>
+        /// The number of garbage collections over <see cref="ElapsedSeconds"/>. Includes collections caused by the rest of the app.
+        /// </summary>
+        public int GarbageCollectionCount { get; private set; }
+
+        /// <summary>
+        /// The number of events whose listeners returned per second over <see cref="ElapsedSeconds"/>.
+        /// </summary>
+        public double EventsPerSecond
+        {
+            get { return ElapsedSeconds > 0 ? GetStageStats(PipelineStage.Handler).Count / ElapsedSeconds : 0; }
+        }
+
+        /// <summary>
+        /// The names of the events with at least one sample.
+        /// </summary>
+        public ICollection<string> EventNames
+        {
+            get { return _eventStats.Keys; }
+        }
+
+        internal PipelineStats(bool isEnabled, double elapsedSeconds, int garbageCollectionCount, Dictionary<string, PipelineStageStats[]> eventStats, PipelineStageStats[] totalStats)
+        {
+            IsEnabled = isEnabled;
+            ElapsedSeconds = elapsedSeconds;
+            GarbageCollectionCount = garbageCollectionCount;
+            _eventStats = eventStats;
+            _totalStats = totalStats;
+        }
+
+        /// <summary>
+        /// Returns the upper bound, in milliseconds, of a histogram bucket. Bucket <c>n</c> counts samples shorter than 2^n microseconds that did not fit in bucket <c>n - 1</c>,
+        /// and the last bucket counts everything longer.
+        /// </summary>
+        public static double GetBucketUpperBoundMilliseconds(int bucket)
+        {
+            return (1L << Math.Min(Math.Max(bucket, 0), BucketCount - 1)) / 1000.0;
+        }
+
+        /// <summary>
+        /// Returns the stats of a stage across every event.
+        /// </summary>
+        public PipelineStageStats GetStageStats(PipelineStage stage)
+        {
+            return _totalStats[(int) stage];
+        }
+
+        /// <summary>
+        /// Returns the stats of a stage for one event, e.g. <c>OnInterstitialLoadedEvent</c>. Returns empty stats if the event has no samples.
+        /// </summary>
+        public PipelineStageStats GetStageStats(string eventName, PipelineStage stage)
+        {
+            PipelineStageStats[] stageStats;
+            return eventName != null && _eventStats.TryGetValue(eventName, out stageStats) ? stageStats[(int) stage] : EmptyStageStats;
+        }
+
+        /// <summary>
+        /// Returns the stats as JSON with a stable key order, so results from runs on the same device can be saved and diffed to catch regressions.
+        /// </summary>
+        public string ToJson()
+        {
+            var eventNames = new List<string>(_eventStats.Keys);
+            eventNames.Sort(StringComparer.Ordinal);
+
+            var events = new Dictionary<string, object>();
+            foreach (var eventName in eventNames)
+            {
+                events[eventName] = StageStatsToDictionary(_eventStats[eventName]);
+            }
+
+            return Json.Serialize(new Dictionary<string, object>
+            {
+                {"elapsedMilliseconds", (long) Math.Round(ElapsedSeconds * 1000)},
+                {"garbageCollectionCount", GarbageCollectionCount},
+                {"stages", StageStatsToDictionary(_totalStats)},
+                {"events", events}
+            });
+        }
+
+        private static Dictionary<string, object> StageStatsToDictionary(PipelineStageStats[] stageStats)
+        {
+            var stages = new Dictionary<string, object>();
+            foreach (PipelineStage stage in Enum.GetValues(typeof(PipelineStage)))
+            {
+                stages[stage.ToString()] = stageStats[(int) stage].ToDictionary();
+            }
+
+            return stages;
+        }
+
+        public override string ToString()
+        {
+            var stringBuilder = new StringBuilder("[PipelineStats isEnabled: ").Append(IsEnabled)
+                .Append(", elapsedSeconds: ").Append(ElapsedSeconds)
+                .Append(", garbageCollectionCount: ").Append(GarbageCollectionCount)
+                .Append(", eventsPerSecond: ").Append(EventsPerSecond);
+            foreach (PipelineStage stage in Enum.GetValues(typeof(PipelineStage)))
+            {
+                stringBuilder.Append(", ").Append(stage).Append(": ").Append(GetStageStats(stage));
+            }
+
+            return stringBuilder.Append("]").ToString();
+        }
+    }
+
     /// <summary>
     /// Determines whether ad events raised by the AppLovin's Unity plugin should be invoked on the Unity main thread.
     /// </summary>
     public static bool? InvokeEventsOnUnityMainThread { get; set; }
 
+    /// <summary>
+    /// The time, in milliseconds, that ad event callbacks may take on the Unity main thread each frame before the remaining events are deferred to the next frame.
+    /// Defaults to <c>0</c>, which dispatches every queued event in the frame it arrives.
+    ///
+    /// Reward and display failed events are never deferred, and revenue and review creative ID events are deferred first.
+    /// While a budget is set, events are dispatched by priority, so they may not arrive in the order they were received.
+    /// </summary>
+    public static double EventDispatchFrameBudgetMilliseconds
+    {
+        get { return MaxEventExecutor.FrameBudgetMilliseconds; }
+        set { MaxEventExecutor.FrameBudgetMilliseconds = value; }
+    }
+
+    /// <summary>
+    /// Returns stats about how ad events are dispatched on the Unity main thread, such as how many events were deferred and how long events waited.
+    /// Should be called from the Unity main thread.
+    /// </summary>
+    public static EventDispatchStats GetEventDispatchStats()
+    {
+        return MaxEventExecutor.GetDispatchStats();
+    }
+
+    /// <summary>
+    /// Starts recording every event the native plugin sends to Unity, exactly as received and with the time it arrived, to a trace file.
+    /// The trace can be replayed in the Unity Editor with <c>MaxSdk.ReplayEventTrace</c>, e.g. to reproduce a burst of callbacks without a device or network.
+    /// Any existing file at <paramref name="path"/> is replaced, and any recording in progress is stopped.
+    /// </summary>
+    /// <param name="path">The path of the trace file, e.g. under <see cref="Application.persistentDataPath"/>.</param>
+    /// <returns><c>true</c> if recording started.</returns>
+    public static bool StartEventTraceRecording(string path)
+    {
+        return MaxEventTrace.StartRecording(path);
+    }
+
+    /// <summary>
+    /// Stops recording events and closes the trace file started by <see cref="StartEventTraceRecording"/>.
+    /// </summary>
+    public static void StopEventTraceRecording()
+    {
+        MaxEventTrace.StopRecording();
+    }
+
+    /// <summary>
+    /// Fullscreen ad readiness and ad values are answered from a managed snapshot that is kept current from ad events, so checking them every frame does not call into native code.
+    /// The snapshot can briefly lag behind the native plugin, e.g. right after an ad expires. Set this to <c>true</c> to have the show methods ask the native plugin whether the ad
+    /// is ready before showing it. Defaults to <c>false</c>.
+    /// </summary>
+    public static bool StrictReadinessCheckEnabled
+    {
+        get { return MaxAdStateSnapshot.StrictReadinessCheck; }
+        set { MaxAdStateSnapshot.StrictReadinessCheck = value; }
+    }
+
+    /// <summary>
+    /// Set this to <c>true</c> to have ad event callbacks reuse their <see cref="AdInfo"/> and <see cref="ErrorInfo"/> objects instead of allocating new ones for every event.
+    /// Defaults to <c>false</c>.
+    ///
+    /// While enabled, the objects passed to a callback are only valid until the callback returns, after which they are reused for later events.
+    /// Call <see cref="AdInfo.Retain"/> or <see cref="ErrorInfo.Retain"/> from within the callback to keep an object, e.g. to read it in a coroutine.
+    /// <see cref="Reward"/> is a struct and is always safe to keep.
+    /// </summary>
+    public static bool PooledCallbackPayloadsEnabled
+    {
+        get { return MaxCallbackPayloadPool.IsEnabled; }
+        set { MaxCallbackPayloadPool.IsEnabled = value; }
+    }
+
+    /// <summary>
+    /// Debug option for <see cref="PooledCallbackPayloadsEnabled"/>. When <c>true</c>, callback objects are overwritten with placeholder values once their callback returns
+    /// and are never reused, so code that reads them later without retaining them sees <c>"&lt;recycled MAX callback payload&gt;"</c> and a NaN revenue instead of another event's values.
+    /// Defaults to <c>false</c>. Disables the allocation savings, so it should not be enabled in release builds.
+    /// </summary>
+    public static bool PoisonRecycledCallbackPayloads
+    {
+        get { return MaxCallbackPayloadPool.PoisonRecycled; }
+        set { MaxCallbackPayloadPool.PoisonRecycled = value; }
+    }
+
     /// <summary>
     /// The CMP service, which provides direct APIs for interfacing with the Google-certified CMP installed, if any.
     /// </summary>
@@ -671,6 +1534,66 @@ public abstract class MaxSdkBase
         get; private set;
     }
 
+    private static readonly object AdUnitHandlesLock = new object();
+    private static readonly Dictionary<string, int> AdUnitHandles = new Dictionary<string, int>();
+
+    // Handle `n` maps to index `n - 1`. Replaced rather than mutated, so hot calls can resolve a handle without taking the lock.
+    private static volatile string[] _adUnitIdentifiersByHandle = new string[0];
+
+    // Assigns handles in managed code, for platforms that do not keep a handle table natively. Handles are never reused.
+    protected static int RegisterAdUnitHandle(string adUnitIdentifier)
+    {
+        if (string.IsNullOrEmpty(adUnitIdentifier)) return 0;
+
+        lock (AdUnitHandlesLock)
+        {
+            int handle;
+            if (AdUnitHandles.TryGetValue(adUnitIdentifier, out handle)) return handle;
+
+            handle = _adUnitIdentifiersByHandle.Length + 1;
+            TrackAdUnitHandle(handle, adUnitIdentifier);
+
+            return handle;
+        }
+    }
+
+    // Records a handle assigned by the native plugin, so handle overloads can still find the ad unit identifier in managed code.
+    protected static void TrackAdUnitHandle(int adUnitHandle, string adUnitIdentifier)
+    {
+        if (adUnitHandle <= 0 || string.IsNullOrEmpty(adUnitIdentifier)) return;
+
+        lock (AdUnitHandlesLock)
+        {
+            var adUnitIdentifiersByHandle = _adUnitIdentifiersByHandle;
+            if (adUnitHandle <= adUnitIdentifiersByHandle.Length && adUnitIdentifiersByHandle[adUnitHandle - 1] == adUnitIdentifier) return;
+
+            var updatedAdUnitIdentifiersByHandle = new string[Math.Max(adUnitIdentifiersByHandle.Length, adUnitHandle)];
+            Array.Copy(adUnitIdentifiersByHandle, updatedAdUnitIdentifiersByHandle, adUnitIdentifiersByHandle.Length);
+            updatedAdUnitIdentifiersByHandle[adUnitHandle - 1] = adUnitIdentifier;
+
+            AdUnitHandles[adUnitIdentifier] = adUnitHandle;
+            _adUnitIdentifiersByHandle = updatedAdUnitIdentifiersByHandle;
+        }
+    }
+
+    // Returns null without logging if the handle is unknown
+    protected static string FindAdUnitIdentifierForHandle(int adUnitHandle)
+    {
+        var adUnitIdentifiersByHandle = _adUnitIdentifiersByHandle;
+        return adUnitHandle > 0 && adUnitHandle <= adUnitIdentifiersByHandle.Length ? adUnitIdentifiersByHandle[adUnitHandle - 1] : null;
+    }
+
+    protected static string GetAdUnitIdentifierForHandle(int adUnitHandle, string debugPurpose)
+    {
+        var adUnitIdentifier = FindAdUnitIdentifierForHandle(adUnitHandle);
+        if (adUnitIdentifier == null)
+        {
+            MaxSdkLogger.UserError("Invalid MAX Ads Ad Unit handle " + adUnitHandle + " specified for: " + debugPurpose + ". Handles must be returned by MaxSdk.RegisterAdUnit().");
+        }
+
+        return adUnitIdentifier;
+    }
+
     protected static void ValidateAdUnitIdentifier(string adUnitIdentifier, string debugPurpose)
     {
         if (string.IsNullOrEmpty(adUnitIdentifier))
@@ -704,11 +1627,34 @@ public abstract class MaxSdkBase
     /// <returns>A <see cref="Rect"/> the prop string represents.</returns>
     protected static Rect GetRectFromString(string rectPropString)
     {
-        var rectDict = Json.Deserialize(rectPropString) as Dictionary<string, object>;
-        var originX = MaxSdkUtils.GetFloatFromDictionary(rectDict, "origin_x", 0);
-        var originY = MaxSdkUtils.GetFloatFromDictionary(rectDict, "origin_y", 0);
-        var width = MaxSdkUtils.GetFloatFromDictionary(rectDict, "width", 0);
-        var height = MaxSdkUtils.GetFloatFromDictionary(rectDict, "height", 0);
+        var originX = 0f;
+        var originY = 0f;
+        var width = 0f;
+        var height = 0f;
+
+        MaxJsonReader rectReader;
+        if (MaxJsonReader.TryOpen(rectPropString, out rectReader))
+        {
+            while (rectReader.MoveNext())
+            {
+                if (rectReader.NameEquals("origin_x"))
+                {
+                    originX = (float) rectReader.ReadDouble();
+                }
+                else if (rectReader.NameEquals("origin_y"))
+                {
+                    originY = (float) rectReader.ReadDouble();
+                }
+                else if (rectReader.NameEquals("width"))
+                {
+                    width = (float) rectReader.ReadDouble();
+                }
+                else if (rectReader.NameEquals("height"))
+                {
+                    height = (float) rectReader.ReadDouble();
+                }
+            }
+        }
 
         return new Rect(originX, originY, width, height);
     }
@@ -728,19 +1674,106 @@ public abstract class MaxSdkBase
     /// <param name="propsStr">A prop string with the event data</param>
     protected static void HandleBackgroundCallback(string propsStr)
     {
+        var callbackTimestamp = MaxPipelineStats.GetTimestamp();
+        var traceTimestamp = MaxTimelineTracer.GetTimestamp();
+        MaxEventTrace.Record(propsStr);
+
+        // The native plugin may batch several events into one callback, one per line. Each event is read in place rather than copied out.
+        var propsLength = propsStr != null ? propsStr.Length : 0;
+        var eventStartIndex = 0;
+        var batchSeparatorIndex = propsStr != null ? propsStr.IndexOf('\n') : -1;
+        while (batchSeparatorIndex >= 0)
+        {
+            HandleBackgroundCallbackEvent(propsStr, eventStartIndex, batchSeparatorIndex - eventStartIndex, callbackTimestamp);
+            eventStartIndex = batchSeparatorIndex + 1;
+            batchSeparatorIndex = propsStr.IndexOf('\n', eventStartIndex);
+        }
+
+        HandleBackgroundCallbackEvent(propsStr, eventStartIndex, propsLength - eventStartIndex, callbackTimestamp);
+
+        MaxTimelineTracer.Record(MaxTimelineTracer.SpanKind.BackgroundCallback, "BackgroundCallback", propsLength, traceTimestamp);
+    }
+
+    private static void HandleBackgroundCallbackEvent(string propsStr, int start, int length, long callbackTimestamp)
+    {
+        MaxPipelineStats.OnEventReceived(callbackTimestamp, length);
+
         try
         {
-            MaxSdkCallbacks.ForwardEvent(propsStr);
+            MaxSdkCallbacks.ForwardEvent(propsStr, start, length);
         }
         catch (Exception exception)
         {
-            var eventProps = Json.Deserialize(propsStr) as Dictionary<string, object>;
-            if (eventProps == null) return;
+            MaxJsonReader eventReader;
+            if (!MaxJsonReader.TryOpen(propsStr, start, length, out eventReader)) return;
+
+            var eventName = "";
+            while (eventReader.MoveNext())
+            {
+                if (!eventReader.NameEquals("name")) continue;
+
+                eventName = eventReader.ReadString();
+                break;
+            }
 
-            var eventName = MaxSdkUtils.GetStringFromDictionary(eventProps, "name", "");
             MaxSdkLogger.UserError("Unable to notify ad delegate due to an error in the publisher callback '" + eventName + "' due to exception: " + exception.Message);
             MaxSdkLogger.LogException(exception);
         }
+        finally
+        {
+            MaxPipelineStats.OnEventFinished(callbackTimestamp);
+        }
+    }
+
+    /// <summary>
+    /// Handles one or more binary encoded ad events sent back to back by the native plugin. See <see cref="MaxEventCodec"/>.
+    /// </summary>
+    /// <param name="eventBytes">Buffer containing the encoded events.</param>
+    /// <param name="length">Number of valid bytes in <paramref name="eventBytes"/>.</param>
+    protected static void HandleBinaryBackgroundCallback(byte[] eventBytes, int length)
+    {
+        var callbackTimestamp = MaxPipelineStats.GetTimestamp();
+        var traceTimestamp = MaxTimelineTracer.GetTimestamp();
+        MaxEventTrace.Record(eventBytes, length);
+        var offset = 0;
+        while (offset < length)
+        {
+            var frameLength = MaxEventCodec.GetFrameLength(eventBytes, offset, length - offset);
+            if (frameLength == 0)
+            {
+                MaxSdkLogger.E("Failed to forward event due to invalid event data");
+                break;
+            }
+
+            HandleBinaryBackgroundCallbackEvent(eventBytes, offset, frameLength, callbackTimestamp);
+            offset += frameLength;
+        }
+
+        MaxTimelineTracer.Record(MaxTimelineTracer.SpanKind.BackgroundCallback, "BinaryBackgroundCallback", length, traceTimestamp);
+    }
+
+    private static void HandleBinaryBackgroundCallbackEvent(byte[] eventBytes, int offset, int length, long callbackTimestamp)
+    {
+        MaxPipelineStats.OnEventReceived(callbackTimestamp, length);
+
+        try
+        {
+            MaxSdkCallbacks.ForwardEvent(eventBytes, offset, length);
+        }
+        catch (Exception exception)
+        {
+            string eventName;
+            bool keepInBackground;
+            MaxEventReader eventReader;
+            if (!MaxEventCodec.TryOpen(eventBytes, offset, length, out eventName, out keepInBackground, out eventReader)) return;
+
+            MaxSdkLogger.UserError("Unable to notify ad delegate due to an error in the publisher callback '" + eventName + "' due to exception: " + exception.Message);
+            MaxSdkLogger.LogException(exception);
+        }
+        finally
+        {
+            MaxPipelineStats.OnEventFinished(callbackTimestamp);
+        }
     }
 
     protected static string SerializeLocalExtraParameterValue(object value)
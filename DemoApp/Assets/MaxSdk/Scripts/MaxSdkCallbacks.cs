@@ -3,6 +3,7 @@
 using System;
 using System.Collections.Generic;
 using System.Text.RegularExpressions;
+using System.Threading;
 using UnityEngine;
 using AppLovinMax.ThirdParty.MiniJson;
 using AppLovinMax.Internal;
@@ -12,6 +13,19 @@ using AppLovinMax.Internal;
 /// </summary>
 public static class MaxSdkCallbacks
 {
+    // Only taken when a listener is added or removed. Dispatch reads the published mask without locking.
+    private static readonly object EventSubscriptionLock = new object();
+    private static ulong _eventSubscriptionMask;
+
+    /// <summary>
+    /// Bitmask of the ad events the native plugin should send, where bit <c>n</c> is set for the event with id <c>n</c> in <see cref="MaxEventCodec.EventNames"/>.
+    /// Includes the events that have at least one listener and the events that keep <see cref="MaxAdStateSnapshot"/> current.
+    /// </summary>
+    internal static ulong EventSubscriptionMask
+    {
+        get { return Volatile.Read(ref _eventSubscriptionMask) | MaxAdStateSnapshot.EventMask; }
+    }
+
     /// <summary>
     /// Fired when the SDK has finished initializing
     /// </summary>
@@ -20,13 +34,11 @@ public static class MaxSdkCallbacks
     {
         add
         {
-            LogSubscribedToEvent("OnSdkInitializedEvent");
-            onSdkInitializedEvent += value;
+            AddListener(ref onSdkInitializedEvent, value, "OnSdkInitializedEvent", "OnSdkInitializedEvent");
         }
         remove
         {
-            LogUnsubscribedToEvent("OnSdkInitializedEvent");
-            onSdkInitializedEvent -= value;
+            RemoveListener(ref onSdkInitializedEvent, value, "OnSdkInitializedEvent", "OnSdkInitializedEvent");
         }
     }
 
@@ -38,13 +50,11 @@ public static class MaxSdkCallbacks
     {
         add
         {
-            LogSubscribedToEvent("OnApplicationStateChangedEvent");
-            onApplicationStateChangedEvent += value;
+            AddListener(ref onApplicationStateChangedEvent, value, "OnApplicationStateChangedEvent", "OnApplicationStateChangedEvent");
         }
         remove
         {
-            LogUnsubscribedToEvent("OnApplicationStateChangedEvent");
-            onApplicationStateChangedEvent -= value;
+            RemoveListener(ref onApplicationStateChangedEvent, value, "OnApplicationStateChangedEvent", "OnApplicationStateChangedEvent");
         }
     }
 
@@ -55,13 +65,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdLoadedEvent");
-                onAdLoadedEvent += value;
+                AddListener(ref onAdLoadedEvent, value, "OnInterstitialAdLoadedEvent", "OnInterstitialLoadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdLoadedEvent");
-                onAdLoadedEvent -= value;
+                RemoveListener(ref onAdLoadedEvent, value, "OnInterstitialAdLoadedEvent", "OnInterstitialLoadedEvent");
             }
         }
 
@@ -70,13 +78,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdLoadFailedEvent");
-                onAdLoadFailedEvent += value;
+                AddListener(ref onAdLoadFailedEvent, value, "OnInterstitialAdLoadFailedEvent", "OnInterstitialLoadFailedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdLoadFailedEvent");
-                onAdLoadFailedEvent -= value;
+                RemoveListener(ref onAdLoadFailedEvent, value, "OnInterstitialAdLoadFailedEvent", "OnInterstitialLoadFailedEvent");
             }
         }
 
@@ -88,13 +94,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdDisplayedEvent");
-                onAdDisplayedEvent += value;
+                AddListener(ref onAdDisplayedEvent, value, "OnInterstitialAdDisplayedEvent", "OnInterstitialDisplayedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdDisplayedEvent");
-                onAdDisplayedEvent -= value;
+                RemoveListener(ref onAdDisplayedEvent, value, "OnInterstitialAdDisplayedEvent", "OnInterstitialDisplayedEvent");
             }
         }
 
@@ -103,13 +107,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdDisplayFailedEvent");
-                onAdDisplayFailedEvent += value;
+                AddListener(ref onAdDisplayFailedEvent, value, "OnInterstitialAdDisplayFailedEvent", "OnInterstitialAdFailedToDisplayEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdDisplayFailedEvent");
-                onAdDisplayFailedEvent -= value;
+                RemoveListener(ref onAdDisplayFailedEvent, value, "OnInterstitialAdDisplayFailedEvent", "OnInterstitialAdFailedToDisplayEvent");
             }
         }
 
@@ -118,13 +120,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdClickedEvent");
-                onAdClickedEvent += value;
+                AddListener(ref onAdClickedEvent, value, "OnInterstitialAdClickedEvent", "OnInterstitialClickedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdClickedEvent");
-                onAdClickedEvent -= value;
+                RemoveListener(ref onAdClickedEvent, value, "OnInterstitialAdClickedEvent", "OnInterstitialClickedEvent");
             }
         }
 
@@ -137,13 +137,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdRevenuePaidEvent");
-                onAdRevenuePaidEvent += value;
+                AddListener(ref onAdRevenuePaidEvent, value, "OnInterstitialAdRevenuePaidEvent", "OnInterstitialAdRevenuePaidEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdRevenuePaidEvent");
-                onAdRevenuePaidEvent -= value;
+                RemoveListener(ref onAdRevenuePaidEvent, value, "OnInterstitialAdRevenuePaidEvent", "OnInterstitialAdRevenuePaidEvent");
             }
         }
 
@@ -155,13 +153,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnExpiredInterstitialAdReloadedEvent");
-                onExpiredAdReloadedEvent += value;
+                AddListener(ref onExpiredAdReloadedEvent, value, "OnExpiredInterstitialAdReloadedEvent", "OnExpiredInterstitialAdReloadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnExpiredInterstitialAdReloadedEvent");
-                onExpiredAdReloadedEvent -= value;
+                RemoveListener(ref onExpiredAdReloadedEvent, value, "OnExpiredInterstitialAdReloadedEvent", "OnExpiredInterstitialAdReloadedEvent");
             }
         }
 
@@ -175,13 +171,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent += value;
+                AddListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnInterstitialAdReviewCreativeIdGeneratedEvent", "OnInterstitialAdReviewCreativeIdGeneratedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent -= value;
+                RemoveListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnInterstitialAdReviewCreativeIdGeneratedEvent", "OnInterstitialAdReviewCreativeIdGeneratedEvent");
             }
         }
 
@@ -190,13 +184,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnInterstitialAdHiddenEvent");
-                onAdHiddenEvent += value;
+                AddListener(ref onAdHiddenEvent, value, "OnInterstitialAdHiddenEvent", "OnInterstitialHiddenEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnInterstitialAdHiddenEvent");
-                onAdHiddenEvent -= value;
+                RemoveListener(ref onAdHiddenEvent, value, "OnInterstitialAdHiddenEvent", "OnInterstitialHiddenEvent");
             }
         }
     }
@@ -208,13 +200,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdLoadedEvent");
-                onAdLoadedEvent += value;
+                AddListener(ref onAdLoadedEvent, value, "OnAppOpenAdLoadedEvent", "OnAppOpenAdLoadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdLoadedEvent");
-                onAdLoadedEvent -= value;
+                RemoveListener(ref onAdLoadedEvent, value, "OnAppOpenAdLoadedEvent", "OnAppOpenAdLoadedEvent");
             }
         }
 
@@ -223,13 +213,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdLoadFailedEvent");
-                onAdLoadFailedEvent += value;
+                AddListener(ref onAdLoadFailedEvent, value, "OnAppOpenAdLoadFailedEvent", "OnAppOpenAdLoadFailedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdLoadFailedEvent");
-                onAdLoadFailedEvent -= value;
+                RemoveListener(ref onAdLoadFailedEvent, value, "OnAppOpenAdLoadFailedEvent", "OnAppOpenAdLoadFailedEvent");
             }
         }
 
@@ -241,13 +229,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdDisplayedEvent");
-                onAdDisplayedEvent += value;
+                AddListener(ref onAdDisplayedEvent, value, "OnAppOpenAdDisplayedEvent", "OnAppOpenAdDisplayedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdDisplayedEvent");
-                onAdDisplayedEvent -= value;
+                RemoveListener(ref onAdDisplayedEvent, value, "OnAppOpenAdDisplayedEvent", "OnAppOpenAdDisplayedEvent");
             }
         }
 
@@ -256,13 +242,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdDisplayFailedEvent");
-                onAdDisplayFailedEvent += value;
+                AddListener(ref onAdDisplayFailedEvent, value, "OnAppOpenAdDisplayFailedEvent", "OnAppOpenAdFailedToDisplayEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdDisplayFailedEvent");
-                onAdDisplayFailedEvent -= value;
+                RemoveListener(ref onAdDisplayFailedEvent, value, "OnAppOpenAdDisplayFailedEvent", "OnAppOpenAdFailedToDisplayEvent");
             }
         }
 
@@ -271,13 +255,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdClickedEvent");
-                onAdClickedEvent += value;
+                AddListener(ref onAdClickedEvent, value, "OnAppOpenAdClickedEvent", "OnAppOpenAdClickedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdClickedEvent");
-                onAdClickedEvent -= value;
+                RemoveListener(ref onAdClickedEvent, value, "OnAppOpenAdClickedEvent", "OnAppOpenAdClickedEvent");
             }
         }
 
@@ -290,13 +272,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdRevenuePaidEvent");
-                onAdRevenuePaidEvent += value;
+                AddListener(ref onAdRevenuePaidEvent, value, "OnAppOpenAdRevenuePaidEvent", "OnAppOpenAdRevenuePaidEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdRevenuePaidEvent");
-                onAdRevenuePaidEvent -= value;
+                RemoveListener(ref onAdRevenuePaidEvent, value, "OnAppOpenAdRevenuePaidEvent", "OnAppOpenAdRevenuePaidEvent");
             }
         }
 
@@ -308,13 +288,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnExpiredAppOpenAdReloadedEvent");
-                onExpiredAdReloadedEvent += value;
+                AddListener(ref onExpiredAdReloadedEvent, value, "OnExpiredAppOpenAdReloadedEvent", "OnExpiredAppOpenAdReloadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnExpiredAppOpenAdReloadedEvent");
-                onExpiredAdReloadedEvent -= value;
+                RemoveListener(ref onExpiredAdReloadedEvent, value, "OnExpiredAppOpenAdReloadedEvent", "OnExpiredAppOpenAdReloadedEvent");
             }
         }
 
@@ -323,13 +301,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnAppOpenAdHiddenEvent");
-                onAdHiddenEvent += value;
+                AddListener(ref onAdHiddenEvent, value, "OnAppOpenAdHiddenEvent", "OnAppOpenAdHiddenEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnAppOpenAdHiddenEvent");
-                onAdHiddenEvent -= value;
+                RemoveListener(ref onAdHiddenEvent, value, "OnAppOpenAdHiddenEvent", "OnAppOpenAdHiddenEvent");
             }
         }
     }
@@ -340,13 +316,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdLoadedEvent");
-                onAdLoadedEvent += value;
+                AddListener(ref onAdLoadedEvent, value, "OnRewardedAdLoadedEvent", "OnRewardedAdLoadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdLoadedEvent");
-                onAdLoadedEvent -= value;
+                RemoveListener(ref onAdLoadedEvent, value, "OnRewardedAdLoadedEvent", "OnRewardedAdLoadedEvent");
             }
         }
 
@@ -355,13 +329,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdLoadFailedEvent");
-                onAdLoadFailedEvent += value;
+                AddListener(ref onAdLoadFailedEvent, value, "OnRewardedAdLoadFailedEvent", "OnRewardedAdLoadFailedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdLoadFailedEvent");
-                onAdLoadFailedEvent -= value;
+                RemoveListener(ref onAdLoadFailedEvent, value, "OnRewardedAdLoadFailedEvent", "OnRewardedAdLoadFailedEvent");
             }
         }
 
@@ -373,13 +345,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdDisplayedEvent");
-                onAdDisplayedEvent += value;
+                AddListener(ref onAdDisplayedEvent, value, "OnRewardedAdDisplayedEvent", "OnRewardedAdDisplayedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdDisplayedEvent");
-                onAdDisplayedEvent -= value;
+                RemoveListener(ref onAdDisplayedEvent, value, "OnRewardedAdDisplayedEvent", "OnRewardedAdDisplayedEvent");
             }
         }
 
@@ -388,13 +358,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdDisplayFailedEvent");
-                onAdDisplayFailedEvent += value;
+                AddListener(ref onAdDisplayFailedEvent, value, "OnRewardedAdDisplayFailedEvent", "OnRewardedAdFailedToDisplayEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdDisplayFailedEvent");
-                onAdDisplayFailedEvent -= value;
+                RemoveListener(ref onAdDisplayFailedEvent, value, "OnRewardedAdDisplayFailedEvent", "OnRewardedAdFailedToDisplayEvent");
             }
         }
 
@@ -403,13 +371,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdClickedEvent");
-                onAdClickedEvent += value;
+                AddListener(ref onAdClickedEvent, value, "OnRewardedAdClickedEvent", "OnRewardedAdClickedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdClickedEvent");
-                onAdClickedEvent -= value;
+                RemoveListener(ref onAdClickedEvent, value, "OnRewardedAdClickedEvent", "OnRewardedAdClickedEvent");
             }
         }
 
@@ -422,13 +388,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdRevenuePaidEvent");
-                onAdRevenuePaidEvent += value;
+                AddListener(ref onAdRevenuePaidEvent, value, "OnRewardedAdRevenuePaidEvent", "OnRewardedAdRevenuePaidEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdRevenuePaidEvent");
-                onAdRevenuePaidEvent -= value;
+                RemoveListener(ref onAdRevenuePaidEvent, value, "OnRewardedAdRevenuePaidEvent", "OnRewardedAdRevenuePaidEvent");
             }
         }
 
@@ -440,13 +404,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnExpiredRewardedAdReloadedEvent");
-                onExpiredAdReloadedEvent += value;
+                AddListener(ref onExpiredAdReloadedEvent, value, "OnExpiredRewardedAdReloadedEvent", "OnExpiredRewardedAdReloadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnExpiredRewardedAdReloadedEvent");
-                onExpiredAdReloadedEvent -= value;
+                RemoveListener(ref onExpiredAdReloadedEvent, value, "OnExpiredRewardedAdReloadedEvent", "OnExpiredRewardedAdReloadedEvent");
             }
         }
 
@@ -458,13 +420,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent += value;
+                AddListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnRewardedAdReviewCreativeIdGeneratedEvent", "OnRewardedAdReviewCreativeIdGeneratedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent -= value;
+                RemoveListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnRewardedAdReviewCreativeIdGeneratedEvent", "OnRewardedAdReviewCreativeIdGeneratedEvent");
             }
         }
 
@@ -473,13 +433,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdReceivedRewardEvent");
-                onAdReceivedRewardEvent += value;
+                AddListener(ref onAdReceivedRewardEvent, value, "OnRewardedAdReceivedRewardEvent", "OnRewardedAdReceivedRewardEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdReceivedRewardEvent");
-                onAdReceivedRewardEvent -= value;
+                RemoveListener(ref onAdReceivedRewardEvent, value, "OnRewardedAdReceivedRewardEvent", "OnRewardedAdReceivedRewardEvent");
             }
         }
 
@@ -488,13 +446,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnRewardedAdHiddenEvent");
-                onAdHiddenEvent += value;
+                AddListener(ref onAdHiddenEvent, value, "OnRewardedAdHiddenEvent", "OnRewardedAdHiddenEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnRewardedAdHiddenEvent");
-                onAdHiddenEvent -= value;
+                RemoveListener(ref onAdHiddenEvent, value, "OnRewardedAdHiddenEvent", "OnRewardedAdHiddenEvent");
             }
         }
     }
@@ -505,13 +461,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdLoadedEvent");
-                onAdLoadedEvent += value;
+                AddListener(ref onAdLoadedEvent, value, "OnBannerAdLoadedEvent", "OnBannerAdLoadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdLoadedEvent");
-                onAdLoadedEvent -= value;
+                RemoveListener(ref onAdLoadedEvent, value, "OnBannerAdLoadedEvent", "OnBannerAdLoadedEvent");
             }
         }
 
@@ -520,13 +474,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdLoadFailedEvent");
-                onAdLoadFailedEvent += value;
+                AddListener(ref onAdLoadFailedEvent, value, "OnBannerAdLoadFailedEvent", "OnBannerAdLoadFailedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdLoadFailedEvent");
-                onAdLoadFailedEvent -= value;
+                RemoveListener(ref onAdLoadFailedEvent, value, "OnBannerAdLoadFailedEvent", "OnBannerAdLoadFailedEvent");
             }
         }
 
@@ -535,13 +487,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdClickedEvent");
-                onAdClickedEvent += value;
+                AddListener(ref onAdClickedEvent, value, "OnBannerAdClickedEvent", "OnBannerAdClickedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdClickedEvent");
-                onAdClickedEvent -= value;
+                RemoveListener(ref onAdClickedEvent, value, "OnBannerAdClickedEvent", "OnBannerAdClickedEvent");
             }
         }
 
@@ -550,13 +500,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdRevenuePaidEvent");
-                onAdRevenuePaidEvent += value;
+                AddListener(ref onAdRevenuePaidEvent, value, "OnBannerAdRevenuePaidEvent", "OnBannerAdRevenuePaidEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdRevenuePaidEvent");
-                onAdRevenuePaidEvent -= value;
+                RemoveListener(ref onAdRevenuePaidEvent, value, "OnBannerAdRevenuePaidEvent", "OnBannerAdRevenuePaidEvent");
             }
         }
 
@@ -565,13 +513,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent += value;
+                AddListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnBannerAdReviewCreativeIdGeneratedEvent", "OnBannerAdReviewCreativeIdGeneratedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent -= value;
+                RemoveListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnBannerAdReviewCreativeIdGeneratedEvent", "OnBannerAdReviewCreativeIdGeneratedEvent");
             }
         }
 
@@ -580,13 +526,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdExpandedEvent");
-                onAdExpandedEvent += value;
+                AddListener(ref onAdExpandedEvent, value, "OnBannerAdExpandedEvent", "OnBannerAdExpandedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdExpandedEvent");
-                onAdExpandedEvent -= value;
+                RemoveListener(ref onAdExpandedEvent, value, "OnBannerAdExpandedEvent", "OnBannerAdExpandedEvent");
             }
         }
 
@@ -595,13 +539,30 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnBannerAdCollapsedEvent");
-                onAdCollapsedEvent += value;
+                AddListener(ref onAdCollapsedEvent, value, "OnBannerAdCollapsedEvent", "OnBannerAdCollapsedEvent");
+            }
+            remove
+            {
+                RemoveListener(ref onAdCollapsedEvent, value, "OnBannerAdCollapsedEvent", "OnBannerAdCollapsedEvent");
+            }
+        }
+
+        /// <summary>
+        /// Fired when the banner's position or size on screen changes, e.g. after it is positioned, resized, or the screen rotates or its safe area changes.
+        /// Passes the same rect as <see cref="MaxSdk.GetBannerLayout"/>. Also fired once when the banner is first laid out.
+        ///
+        /// NOTE: This is currently only fired on iOS.
+        /// </summary>
+        internal static Action<string, Rect> onAdLayoutChangedEvent;
+        public static event Action<string, Rect> OnAdLayoutChangedEvent
+        {
+            add
+            {
+                AddListener(ref onAdLayoutChangedEvent, value, "OnBannerAdLayoutChangedEvent", "OnBannerAdLayoutChangedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnBannerAdCollapsedEvent");
-                onAdCollapsedEvent -= value;
+                RemoveListener(ref onAdLayoutChangedEvent, value, "OnBannerAdLayoutChangedEvent", "OnBannerAdLayoutChangedEvent");
             }
         }
     }
@@ -613,13 +574,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdLoadedEvent");
-                onAdLoadedEvent += value;
+                AddListener(ref onAdLoadedEvent, value, "OnMRecAdLoadedEvent", "OnMRecAdLoadedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdLoadedEvent");
-                onAdLoadedEvent -= value;
+                RemoveListener(ref onAdLoadedEvent, value, "OnMRecAdLoadedEvent", "OnMRecAdLoadedEvent");
             }
         }
 
@@ -628,13 +587,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdLoadFailedEvent");
-                onAdLoadFailedEvent += value;
+                AddListener(ref onAdLoadFailedEvent, value, "OnMRecAdLoadFailedEvent", "OnMRecAdLoadFailedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdLoadFailedEvent");
-                onAdLoadFailedEvent -= value;
+                RemoveListener(ref onAdLoadFailedEvent, value, "OnMRecAdLoadFailedEvent", "OnMRecAdLoadFailedEvent");
             }
         }
 
@@ -643,13 +600,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdClickedEvent");
-                onAdClickedEvent += value;
+                AddListener(ref onAdClickedEvent, value, "OnMRecAdClickedEvent", "OnMRecAdClickedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdClickedEvent");
-                onAdClickedEvent -= value;
+                RemoveListener(ref onAdClickedEvent, value, "OnMRecAdClickedEvent", "OnMRecAdClickedEvent");
             }
         }
 
@@ -658,13 +613,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdRevenuePaidEvent");
-                onAdRevenuePaidEvent += value;
+                AddListener(ref onAdRevenuePaidEvent, value, "OnMRecAdRevenuePaidEvent", "OnMRecAdRevenuePaidEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdRevenuePaidEvent");
-                onAdRevenuePaidEvent -= value;
+                RemoveListener(ref onAdRevenuePaidEvent, value, "OnMRecAdRevenuePaidEvent", "OnMRecAdRevenuePaidEvent");
             }
         }
 
@@ -676,13 +629,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent += value;
+                AddListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnMRecAdReviewCreativeIdGeneratedEvent", "OnMRecAdReviewCreativeIdGeneratedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdReviewCreativeIdGeneratedEvent");
-                onAdReviewCreativeIdGeneratedEvent -= value;
+                RemoveListener(ref onAdReviewCreativeIdGeneratedEvent, value, "OnMRecAdReviewCreativeIdGeneratedEvent", "OnMRecAdReviewCreativeIdGeneratedEvent");
             }
         }
 
@@ -691,13 +642,11 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdExpandedEvent");
-                onAdExpandedEvent += value;
+                AddListener(ref onAdExpandedEvent, value, "OnMRecAdExpandedEvent", "OnMRecAdExpandedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdExpandedEvent");
-                onAdExpandedEvent -= value;
+                RemoveListener(ref onAdExpandedEvent, value, "OnMRecAdExpandedEvent", "OnMRecAdExpandedEvent");
             }
         }
 
@@ -706,20 +655,111 @@ public static class MaxSdkCallbacks
         {
             add
             {
-                LogSubscribedToEvent("OnMRecAdCollapsedEvent");
-                onAdCollapsedEvent += value;
+                AddListener(ref onAdCollapsedEvent, value, "OnMRecAdCollapsedEvent", "OnMRecAdCollapsedEvent");
             }
             remove
             {
-                LogUnsubscribedToEvent("OnMRecAdCollapsedEvent");
-                onAdCollapsedEvent -= value;
+                RemoveListener(ref onAdCollapsedEvent, value, "OnMRecAdCollapsedEvent", "OnMRecAdCollapsedEvent");
+            }
+        }
+
+        /// <summary>
+        /// Fired when the MREC's position or size on screen changes, e.g. after it is positioned, resized, or the screen rotates or its safe area changes.
+        /// Passes the same rect as <see cref="MaxSdk.GetMRecLayout"/>. Also fired once when the MREC is first laid out.
+        ///
+        /// NOTE: This is currently only fired on iOS.
+        /// </summary>
+        internal static Action<string, Rect> onAdLayoutChangedEvent;
+        public static event Action<string, Rect> OnAdLayoutChangedEvent
+        {
+            add
+            {
+                AddListener(ref onAdLayoutChangedEvent, value, "OnMRecAdLayoutChangedEvent", "OnMRecAdLayoutChangedEvent");
+            }
+            remove
+            {
+                RemoveListener(ref onAdLayoutChangedEvent, value, "OnMRecAdLayoutChangedEvent", "OnMRecAdLayoutChangedEvent");
             }
         }
     }
 
     public static void ForwardEvent(string eventPropsStr)
     {
-        var eventProps = Json.Deserialize(eventPropsStr) as Dictionary<string, object>;
+        ForwardEvent(eventPropsStr, 0, eventPropsStr != null ? eventPropsStr.Length : 0);
+    }
+
+    /// <summary>
+    /// Forwards the event in the given range of <paramref name="eventPropsStr"/>, so events batched into one string aren't copied out first.
+    /// </summary>
+    internal static void ForwardEvent(string eventPropsStr, int start, int length)
+    {
+        MaxJsonReader eventJsonReader;
+        if (!MaxJsonReader.TryOpen(eventPropsStr, start, length, out eventJsonReader))
+        {
+            // Fall back to MiniJSON, which is more lenient about malformed input
+            ForwardEvent(Json.Deserialize(GetEventPropsSubstring(eventPropsStr, start, length)) as Dictionary<string, object>);
+            return;
+        }
+
+        var eventName = "";
+        var keepInBackground = false;
+        var isPaused = false;
+
+        var propertyReader = eventJsonReader;
+        while (propertyReader.MoveNext())
+        {
+            if (propertyReader.NameEquals("name"))
+            {
+                eventName = propertyReader.ReadString();
+            }
+            else if (propertyReader.NameEquals("keepInBackground"))
+            {
+                keepInBackground = propertyReader.ReadBool();
+            }
+            else if (propertyReader.NameEquals("isPaused"))
+            {
+                isPaused = propertyReader.ReadBool();
+            }
+        }
+
+        if (eventName == "OnInitialCallbackEvent")
+        {
+            MaxSdkLogger.D("Initial background callback.");
+        }
+        else if (eventName == "OnSdkInitializedEvent")
+        {
+            var sdkConfiguration = MaxSdkBase.SdkConfiguration.Create(eventJsonReader);
+            InvokeEvent(onSdkInitializedEvent, sdkConfiguration, eventName, keepInBackground);
+        }
+        else if (eventName == "OnCmpCompletedEvent")
+        {
+            // NOTE: MaxCmpService consumes the error as a dictionary, and this event only fires once per CMP flow
+            ForwardEvent(Json.Deserialize(GetEventPropsSubstring(eventPropsStr, start, length)) as Dictionary<string, object>);
+        }
+        else if (eventName == "OnApplicationStateChanged")
+        {
+            InvokeEvent(onApplicationStateChangedEvent, isPaused, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdLayoutChangedEvent" || eventName == "OnMRecAdLayoutChangedEvent")
+        {
+            ForwardAdLayoutChangedEvent(eventName, new MaxEventReader(eventJsonReader), keepInBackground);
+        }
+        // Ad Events
+        else
+        {
+            ForwardAdEvent(eventName, new MaxEventReader(eventJsonReader), keepInBackground);
+        }
+    }
+
+    private static string GetEventPropsSubstring(string eventPropsStr, int start, int length)
+    {
+        if (eventPropsStr == null || (start == 0 && length == eventPropsStr.Length)) return eventPropsStr;
+
+        return eventPropsStr.Substring(start, length);
+    }
+
+    private static void ForwardEvent(Dictionary<string, object> eventProps)
+    {
         if (eventProps == null)
         {
             MaxSdkLogger.E("Failed to forward event due to invalid event data");
@@ -747,6 +787,16 @@ public static class MaxSdkCallbacks
             var isPaused = MaxSdkUtils.GetBoolFromDictionary(eventProps, "isPaused");
             InvokeEvent(onApplicationStateChangedEvent, isPaused, eventName, keepInBackground);
         }
+        else if (eventName == "OnBannerAdLayoutChangedEvent" || eventName == "OnMRecAdLayoutChangedEvent")
+        {
+            var adUnitIdentifier = MaxSdkUtils.GetStringFromDictionary(eventProps, "adUnitId", "");
+            var layout = new Rect((float) MaxSdkUtils.GetDoubleFromDictionary(eventProps, "origin_x"),
+                (float) MaxSdkUtils.GetDoubleFromDictionary(eventProps, "origin_y"),
+                (float) MaxSdkUtils.GetDoubleFromDictionary(eventProps, "width"),
+                (float) MaxSdkUtils.GetDoubleFromDictionary(eventProps, "height"));
+            var evt = eventName == "OnBannerAdLayoutChangedEvent" ? Banner.onAdLayoutChangedEvent : MRec.onAdLayoutChangedEvent;
+            InvokeEvent(evt, adUnitIdentifier, layout, eventName, keepInBackground);
+        }
         // Ad Events
         else
         {
@@ -756,201 +806,313 @@ public static class MaxSdkCallbacks
             var adUnitIdentifier = MaxSdkUtils.GetStringFromDictionary(adInfoEventProps, "adUnitId", "");
 
             // Expired ad reloaded callbacks pass down multiple adInfo objects
-            if (isExpiredAdReloadedEvent)
-            {
-                var expiredAdInfo = new MaxSdkBase.AdInfo(MaxSdkUtils.GetDictionaryFromDictionary(eventProps, "expiredAdInfo"));
-                if (eventName == "OnExpiredInterstitialAdReloadedEvent")
-                {
-                    InvokeEvent(Interstitial.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
-                }
-                else if (eventName == "OnExpiredAppOpenAdReloadedEvent")
-                {
-                    InvokeEvent(AppOpen.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
-                }
-                else if (eventName == "OnExpiredRewardedAdReloadedEvent")
-                {
-                    InvokeEvent(Rewarded.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
-                }
-                else
-                {
-                    MaxSdkLogger.UserWarning("Unknown MAX Ads event fired: " + eventName);
-                }
-            }
-            else if (eventName == "OnBannerAdLoadedEvent")
-            {
-                InvokeEvent(Banner.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdLoadFailedEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(Banner.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdClickedEvent")
-            {
-                InvokeEvent(Banner.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdRevenuePaidEvent")
+            var expiredAdInfo = isExpiredAdReloadedEvent ? new MaxSdkBase.AdInfo(MaxSdkUtils.GetDictionaryFromDictionary(eventProps, "expiredAdInfo")) : null;
+            var errorInfo = IsAdErrorEvent(eventName) ? new MaxSdkBase.ErrorInfo(eventProps) : null;
+            var reward = new MaxSdkBase.Reward
             {
-                InvokeEvent(Banner.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdReviewCreativeIdGeneratedEvent")
-            {
-                var adReviewCreativeId = MaxSdkUtils.GetStringFromDictionary(eventProps, "adReviewCreativeId", "");
-                InvokeEvent(Banner.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdExpandedEvent")
-            {
-                InvokeEvent(Banner.onAdExpandedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnBannerAdCollapsedEvent")
-            {
-                InvokeEvent(Banner.onAdCollapsedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdLoadedEvent")
-            {
-                InvokeEvent(MRec.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdLoadFailedEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(MRec.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdClickedEvent")
-            {
-                InvokeEvent(MRec.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdRevenuePaidEvent")
-            {
-                InvokeEvent(MRec.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdReviewCreativeIdGeneratedEvent")
-            {
-                var adReviewCreativeId = MaxSdkUtils.GetStringFromDictionary(eventProps, "adReviewCreativeId", "");
-                InvokeEvent(MRec.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdExpandedEvent")
-            {
-                InvokeEvent(MRec.onAdExpandedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnMRecAdCollapsedEvent")
-            {
-                InvokeEvent(MRec.onAdCollapsedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialLoadedEvent")
-            {
-                InvokeEvent(Interstitial.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialLoadFailedEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(Interstitial.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialHiddenEvent")
-            {
-                InvokeEvent(Interstitial.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialDisplayedEvent")
-            {
-                InvokeEvent(Interstitial.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialAdFailedToDisplayEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(Interstitial.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialClickedEvent")
-            {
-                InvokeEvent(Interstitial.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialAdRevenuePaidEvent")
-            {
-                InvokeEvent(Interstitial.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnInterstitialAdReviewCreativeIdGeneratedEvent")
-            {
-                var adReviewCreativeId = MaxSdkUtils.GetStringFromDictionary(eventProps, "adReviewCreativeId", "");
-                InvokeEvent(Interstitial.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdLoadedEvent")
-            {
-                InvokeEvent(AppOpen.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdLoadFailedEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(AppOpen.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdHiddenEvent")
-            {
-                InvokeEvent(AppOpen.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdDisplayedEvent")
-            {
-                InvokeEvent(AppOpen.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdFailedToDisplayEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(AppOpen.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdClickedEvent")
-            {
-                InvokeEvent(AppOpen.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnAppOpenAdRevenuePaidEvent")
-            {
-                InvokeEvent(AppOpen.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdLoadedEvent")
-            {
-                InvokeEvent(Rewarded.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdLoadFailedEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(Rewarded.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdDisplayedEvent")
-            {
-                InvokeEvent(Rewarded.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdHiddenEvent")
-            {
-                InvokeEvent(Rewarded.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdClickedEvent")
-            {
-                InvokeEvent(Rewarded.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdRevenuePaidEvent")
-            {
-                InvokeEvent(Rewarded.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdReviewCreativeIdGeneratedEvent")
-            {
-                var adReviewCreativeId = MaxSdkUtils.GetStringFromDictionary(eventProps, "adReviewCreativeId", "");
-                InvokeEvent(Rewarded.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdFailedToDisplayEvent")
-            {
-                var errorInfo = new MaxSdkBase.ErrorInfo(eventProps);
-                InvokeEvent(Rewarded.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
-            }
-            else if (eventName == "OnRewardedAdReceivedRewardEvent")
-            {
-                var reward = new MaxSdkBase.Reward
-                {
-                    Label = MaxSdkUtils.GetStringFromDictionary(eventProps, "rewardLabel", ""),
-                    Amount = MaxSdkUtils.GetIntFromDictionary(eventProps, "rewardAmount", 0)
-                };
+                Label = MaxSdkUtils.GetStringFromDictionary(eventProps, "rewardLabel", ""),
+                Amount = MaxSdkUtils.GetIntFromDictionary(eventProps, "rewardAmount", 0)
+            };
+            var adReviewCreativeId = MaxSdkUtils.GetStringFromDictionary(eventProps, "adReviewCreativeId", "");
 
-                InvokeEvent(Rewarded.onAdReceivedRewardEvent, adUnitIdentifier, reward, adInfo, eventName, keepInBackground);
+            MaxAdStateSnapshot.OnAdEvent(eventName, adUnitIdentifier);
+            ForwardAdEvent(eventName, adUnitIdentifier, adInfo, expiredAdInfo, errorInfo, reward, adReviewCreativeId, keepInBackground);
+        }
+    }
+
+    private static void ForwardAdLayoutChangedEvent(string eventName, MaxEventReader eventReader, bool keepInBackground)
+    {
+        var evt = eventName == "OnBannerAdLayoutChangedEvent" ? Banner.onAdLayoutChangedEvent : MRec.onAdLayoutChangedEvent;
+        if (evt == null) return;
+
+        var adUnitIdentifier = "";
+        var originX = 0f;
+        var originY = 0f;
+        var width = 0f;
+        var height = 0f;
+
+        var fieldReader = eventReader;
+        while (fieldReader.MoveNext())
+        {
+            switch (fieldReader.FieldId)
+            {
+                case MaxEventCodec.FieldAdUnitId:
+                    adUnitIdentifier = fieldReader.ReadString();
+                    break;
+                case MaxEventCodec.FieldOriginX:
+                    originX = (float) fieldReader.ReadDouble();
+                    break;
+                case MaxEventCodec.FieldOriginY:
+                    originY = (float) fieldReader.ReadDouble();
+                    break;
+                case MaxEventCodec.FieldWidth:
+                    width = (float) fieldReader.ReadDouble();
+                    break;
+                case MaxEventCodec.FieldHeight:
+                    height = (float) fieldReader.ReadDouble();
+                    break;
             }
-            else
-            {
-                MaxSdkLogger.UserWarning("Unknown MAX Ads event fired: " + eventName);
+        }
+
+        InvokeEvent(evt, adUnitIdentifier, new Rect(originX, originY, width, height), eventName, keepInBackground);
+    }
+
+    /// <summary>
+    /// Forwards an ad or ad view layout event sent by the native plugin using the binary encoding in <see cref="MaxEventCodec"/>.
+    /// The payload is decoded directly into the callback objects without building an intermediate dictionary.
+    /// </summary>
+    internal static void ForwardEvent(byte[] eventBytes, int offset, int length)
+    {
+        string eventName;
+        bool keepInBackground;
+        MaxEventReader eventReader;
+        if (!MaxEventCodec.TryOpen(eventBytes, offset, length, out eventName, out keepInBackground, out eventReader))
+        {
+            MaxSdkLogger.E("Failed to forward event due to invalid event data");
+            return;
+        }
+
+        if (eventName == "OnBannerAdLayoutChangedEvent" || eventName == "OnMRecAdLayoutChangedEvent")
+        {
+            ForwardAdLayoutChangedEvent(eventName, eventReader, keepInBackground);
+            return;
+        }
+
+        ForwardAdEvent(eventName, eventReader, keepInBackground);
+    }
+
+    /// <summary>
+    /// Decodes the payload of an ad event straight from the cursor and invokes the matching callback.
+    /// </summary>
+    private static void ForwardAdEvent(string eventName, MaxEventReader eventReader, bool keepInBackground)
+    {
+        if (MaxAdStateSnapshot.TracksEvent(eventName))
+        {
+            MaxAdStateSnapshot.OnAdEvent(eventName, ReadAdUnitIdentifier(eventReader));
+        }
+
+        // Skip decoding the payload if the native plugin sent the event before it saw the listener being removed
+        if (!HasListenerForEvent(eventName)) return;
+
+        MaxSdkBase.AdInfo adInfo = null;
+        MaxSdkBase.AdInfo expiredAdInfo = null;
+        var reward = new MaxSdkBase.Reward {Label = "", Amount = 0};
+        var adReviewCreativeId = "";
+
+        var fieldReader = eventReader;
+        while (fieldReader.MoveNext())
+        {
+            switch (fieldReader.FieldId)
+            {
+                case MaxEventCodec.FieldNewAdInfo:
+                    adInfo = MaxCallbackPayloadPool.RentAdInfo(fieldReader.ReadContainer());
+                    break;
+                case MaxEventCodec.FieldExpiredAdInfo:
+                    expiredAdInfo = MaxCallbackPayloadPool.RentAdInfo(fieldReader.ReadContainer());
+                    break;
+                case MaxEventCodec.FieldRewardLabel:
+                    reward.Label = fieldReader.ReadString();
+                    break;
+                case MaxEventCodec.FieldRewardAmount:
+                    reward.Amount = fieldReader.ReadInt();
+                    break;
+                case MaxEventCodec.FieldAdReviewCreativeId:
+                    adReviewCreativeId = fieldReader.ReadString();
+                    break;
             }
         }
+
+        // Ad info fields are at the top level of the event, except for expired ad reloaded events
+        if (adInfo == null)
+        {
+            adInfo = MaxCallbackPayloadPool.RentAdInfo(eventReader);
+        }
+
+        var errorInfo = IsAdErrorEvent(eventName) ? MaxCallbackPayloadPool.RentErrorInfo(eventReader) : null;
+
+        ForwardAdEvent(eventName, adInfo.AdUnitIdentifier, adInfo, expiredAdInfo, errorInfo, reward, adReviewCreativeId, keepInBackground);
+    }
+
+    private static void ForwardAdEvent(string eventName, string adUnitIdentifier, MaxSdkBase.AdInfo adInfo, MaxSdkBase.AdInfo expiredAdInfo, MaxSdkBase.ErrorInfo errorInfo, MaxSdkBase.Reward reward, string adReviewCreativeId, bool keepInBackground)
+    {
+        if (eventName == "OnBannerAdLoadedEvent")
+        {
+            InvokeEvent(Banner.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdLoadFailedEvent")
+        {
+            InvokeEvent(Banner.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdClickedEvent")
+        {
+            InvokeEvent(Banner.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdRevenuePaidEvent")
+        {
+            InvokeEvent(Banner.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdReviewCreativeIdGeneratedEvent")
+        {
+            InvokeEvent(Banner.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdExpandedEvent")
+        {
+            InvokeEvent(Banner.onAdExpandedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnBannerAdCollapsedEvent")
+        {
+            InvokeEvent(Banner.onAdCollapsedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdLoadedEvent")
+        {
+            InvokeEvent(MRec.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdLoadFailedEvent")
+        {
+            InvokeEvent(MRec.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdClickedEvent")
+        {
+            InvokeEvent(MRec.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdRevenuePaidEvent")
+        {
+            InvokeEvent(MRec.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdReviewCreativeIdGeneratedEvent")
+        {
+            InvokeEvent(MRec.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdExpandedEvent")
+        {
+            InvokeEvent(MRec.onAdExpandedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnMRecAdCollapsedEvent")
+        {
+            InvokeEvent(MRec.onAdCollapsedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialLoadedEvent")
+        {
+            InvokeEvent(Interstitial.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialLoadFailedEvent")
+        {
+            InvokeEvent(Interstitial.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialHiddenEvent")
+        {
+            InvokeEvent(Interstitial.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialDisplayedEvent")
+        {
+            InvokeEvent(Interstitial.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialAdFailedToDisplayEvent")
+        {
+            InvokeEvent(Interstitial.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialClickedEvent")
+        {
+            InvokeEvent(Interstitial.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialAdRevenuePaidEvent")
+        {
+            InvokeEvent(Interstitial.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnInterstitialAdReviewCreativeIdGeneratedEvent")
+        {
+            InvokeEvent(Interstitial.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdLoadedEvent")
+        {
+            InvokeEvent(AppOpen.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdLoadFailedEvent")
+        {
+            InvokeEvent(AppOpen.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdHiddenEvent")
+        {
+            InvokeEvent(AppOpen.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdDisplayedEvent")
+        {
+            InvokeEvent(AppOpen.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdFailedToDisplayEvent")
+        {
+            InvokeEvent(AppOpen.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdClickedEvent")
+        {
+            InvokeEvent(AppOpen.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnAppOpenAdRevenuePaidEvent")
+        {
+            InvokeEvent(AppOpen.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdLoadedEvent")
+        {
+            InvokeEvent(Rewarded.onAdLoadedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdLoadFailedEvent")
+        {
+            InvokeEvent(Rewarded.onAdLoadFailedEvent, adUnitIdentifier, errorInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdDisplayedEvent")
+        {
+            InvokeEvent(Rewarded.onAdDisplayedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdHiddenEvent")
+        {
+            InvokeEvent(Rewarded.onAdHiddenEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdClickedEvent")
+        {
+            InvokeEvent(Rewarded.onAdClickedEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdRevenuePaidEvent")
+        {
+            InvokeEvent(Rewarded.onAdRevenuePaidEvent, adUnitIdentifier, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdReviewCreativeIdGeneratedEvent")
+        {
+            InvokeEvent(Rewarded.onAdReviewCreativeIdGeneratedEvent, adUnitIdentifier, adReviewCreativeId, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdFailedToDisplayEvent")
+        {
+            InvokeEvent(Rewarded.onAdDisplayFailedEvent, adUnitIdentifier, errorInfo, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnRewardedAdReceivedRewardEvent")
+        {
+            InvokeEvent(Rewarded.onAdReceivedRewardEvent, adUnitIdentifier, reward, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnExpiredInterstitialAdReloadedEvent")
+        {
+            InvokeEvent(Interstitial.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnExpiredAppOpenAdReloadedEvent")
+        {
+            InvokeEvent(AppOpen.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
+        }
+        else if (eventName == "OnExpiredRewardedAdReloadedEvent")
+        {
+            InvokeEvent(Rewarded.onExpiredAdReloadedEvent, adUnitIdentifier, expiredAdInfo, adInfo, eventName, keepInBackground);
+        }
+        else
+        {
+            MaxSdkLogger.UserWarning("Unknown MAX Ads event fired: " + eventName);
+        }
+
+        // Pooled payloads are recycled once their listeners have returned, or once MaxEventExecutor has dispatched them if they were queued for the main thread
+        MaxCallbackPayloadPool.Release(adInfo);
+        MaxCallbackPayloadPool.Release(expiredAdInfo);
+        MaxCallbackPayloadPool.Release(errorInfo);
+    }
+
+    private static bool IsAdErrorEvent(string eventName)
+    {
+        return eventName.EndsWith("LoadFailedEvent", StringComparison.Ordinal) || eventName.EndsWith("FailedToDisplayEvent", StringComparison.Ordinal);
     }
 
 #if UNITY_EDITOR
@@ -966,7 +1128,12 @@ public static class MaxSdkCallbacks
     {
         if (!CanInvokeEvent(evt)) return;
 
-        MaxSdkLogger.UserDebug("Invoking event: " + eventName);
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("Invoking event: " + eventName);
+        }
+
+        var handlerSample = MaxPipelineStats.OnEventDecoded(eventName);
         if (ShouldInvokeInBackground(keepInBackground))
         {
             try
@@ -978,6 +1145,8 @@ public static class MaxSdkCallbacks
                 MaxSdkLogger.UserError("Caught exception in publisher event: " + eventName + ", exception: " + exception);
                 MaxSdkLogger.LogException(exception);
             }
+
+            MaxPipelineStats.OnHandlerReturned(eventName, handlerSample);
         }
         else
         {
@@ -989,7 +1158,12 @@ public static class MaxSdkCallbacks
     {
         if (!CanInvokeEvent(evt)) return;
 
-        MaxSdkLogger.UserDebug("Invoking event: " + eventName + ". Param: " + param);
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("Invoking event: " + eventName + ". Param: " + param);
+        }
+
+        var handlerSample = MaxPipelineStats.OnEventDecoded(eventName);
         if (ShouldInvokeInBackground(keepInBackground))
         {
             try
@@ -1001,10 +1175,12 @@ public static class MaxSdkCallbacks
                 MaxSdkLogger.UserError("Caught exception in publisher event: " + eventName + ", exception: " + exception);
                 MaxSdkLogger.LogException(exception);
             }
+
+            MaxPipelineStats.OnHandlerReturned(eventName, handlerSample);
         }
         else
         {
-            MaxEventExecutor.ExecuteOnMainThread(() => evt(param), eventName);
+            MaxEventExecutor.ExecuteOnMainThread(evt, param, eventName);
         }
     }
 
@@ -1012,7 +1188,12 @@ public static class MaxSdkCallbacks
     {
         if (!CanInvokeEvent(evt)) return;
 
-        MaxSdkLogger.UserDebug("Invoking event: " + eventName + ". Params: " + param1 + ", " + param2);
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("Invoking event: " + eventName + ". Params: " + param1 + ", " + param2);
+        }
+
+        var handlerSample = MaxPipelineStats.OnEventDecoded(eventName);
         if (ShouldInvokeInBackground(keepInBackground))
         {
             try
@@ -1024,10 +1205,12 @@ public static class MaxSdkCallbacks
                 MaxSdkLogger.UserError("Caught exception in publisher event: " + eventName + ", exception: " + exception);
                 MaxSdkLogger.LogException(exception);
             }
+
+            MaxPipelineStats.OnHandlerReturned(eventName, handlerSample);
         }
         else
         {
-            MaxEventExecutor.ExecuteOnMainThread(() => evt(param1, param2), eventName);
+            MaxEventExecutor.ExecuteOnMainThread(evt, param1, param2, eventName);
         }
     }
 
@@ -1035,7 +1218,12 @@ public static class MaxSdkCallbacks
     {
         if (!CanInvokeEvent(evt)) return;
 
-        MaxSdkLogger.UserDebug("Invoking event: " + eventName + ". Params: " + param1 + ", " + param2 + ", " + param3);
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("Invoking event: " + eventName + ". Params: " + param1 + ", " + param2 + ", " + param3);
+        }
+
+        var handlerSample = MaxPipelineStats.OnEventDecoded(eventName);
         if (ShouldInvokeInBackground(keepInBackground))
         {
             try
@@ -1047,24 +1235,104 @@ public static class MaxSdkCallbacks
                 MaxSdkLogger.UserError("Caught exception in publisher event: " + eventName + ", exception: " + exception);
                 MaxSdkLogger.LogException(exception);
             }
+
+            MaxPipelineStats.OnHandlerReturned(eventName, handlerSample);
         }
         else
         {
-            MaxEventExecutor.ExecuteOnMainThread(() => evt(param1, param2, param3), eventName);
+            MaxEventExecutor.ExecuteOnMainThread(evt, param1, param2, param3, eventName);
         }
     }
 
     private static bool CanInvokeEvent(Delegate evt)
     {
-        if (evt == null) return false;
+        return evt != null;
+    }
 
+    /// <summary>
+    /// Adds <paramref name="listener"/> to the backing delegate of a public event and updates the native subscription mask.
+    /// </summary>
+    /// <param name="evt">The backing delegate of the event.</param>
+    /// <param name="listener">The listener to add.</param>
+    /// <param name="eventName">The name of the event used in log messages.</param>
+    /// <param name="nativeEventName">The name of the event as sent by the native plugin.</param>
+    private static void AddListener<T>(ref T evt, T listener, string eventName, string nativeEventName) where T : class
+    {
+        LogSubscribedToEvent(eventName);
+        evt = Delegate.Combine(evt as Delegate, listener as Delegate) as T;
+        UpdateEventSubscription(nativeEventName, evt as Delegate);
+    }
+
+    /// <summary>
+    /// Removes <paramref name="listener"/> from the backing delegate of a public event and updates the native subscription mask.
+    /// </summary>
+    private static void RemoveListener<T>(ref T evt, T listener, string eventName, string nativeEventName) where T : class
+    {
+        LogUnsubscribedToEvent(eventName);
+        evt = Delegate.Remove(evt as Delegate, listener as Delegate) as T;
+        UpdateEventSubscription(nativeEventName, evt as Delegate);
+    }
+
+    /// <summary>
+    /// Called after a listener is added to or removed from <paramref name="evt"/>. Warns about over-subscription and keeps the native subscription mask in sync,
+    /// so the native plugin can skip building events that nobody is listening to.
+    /// </summary>
+    /// <param name="nativeEventName">The name of the event as sent by the native plugin.</param>
+    /// <param name="evt">The backing delegate after the listener was added or removed.</param>
+    private static void UpdateEventSubscription(string nativeEventName, Delegate evt)
+    {
         // Check that publisher is not over-subscribing
-        if (evt.GetInvocationList().Length > 5)
+        if (evt != null && evt.GetInvocationList().Length > 5)
+        {
+            MaxSdkLogger.UserWarning("Ads Event (" + nativeEventName + ") has over 5 subscribers. Please make sure you are properly un-subscribing to actions!!!");
+        }
+
+        var eventId = MaxEventCodec.EventIdForName(nativeEventName);
+        if (eventId <= 0) return;
+
+        ulong eventSubscriptionMask;
+        lock (EventSubscriptionLock)
         {
-            MaxSdkLogger.UserWarning("Ads Event (" + evt + ") has over 5 subscribers. Please make sure you are properly un-subscribing to actions!!!");
+            var eventBit = 1UL << eventId;
+            var updatedMask = evt != null ? _eventSubscriptionMask | eventBit : _eventSubscriptionMask & ~eventBit;
+            if (updatedMask == _eventSubscriptionMask) return;
+
+            Volatile.Write(ref _eventSubscriptionMask, updatedMask);
+            eventSubscriptionMask = updatedMask;
         }
 
-        return true;
+        MaxSdk.SetEventSubscriptionMask(eventSubscriptionMask | MaxAdStateSnapshot.EventMask);
+    }
+
+    private static bool HasListenerForEvent(string eventName)
+    {
+        var eventId = MaxEventCodec.EventIdForName(eventName);
+
+        // Events without an id are always forwarded
+        if (eventId <= 0) return true;
+
+        return (Volatile.Read(ref _eventSubscriptionMask) & (1UL << eventId)) != 0;
+    }
+
+    /// <summary>
+    /// Reads the ad unit identifier of an ad event without decoding the rest of the payload.
+    /// </summary>
+    private static string ReadAdUnitIdentifier(MaxEventReader eventReader)
+    {
+        var fieldReader = eventReader;
+        while (fieldReader.MoveNext())
+        {
+            switch (fieldReader.FieldId)
+            {
+                case MaxEventCodec.FieldAdUnitId:
+                    return fieldReader.ReadString();
+                case MaxEventCodec.FieldNewAdInfo:
+                    // Expired ad reloaded events nest the ad unit identifier in the new ad info
+                    return ReadAdUnitIdentifier(fieldReader.ReadContainer());
+            }
+        }
+
+        return null;
     }
 
     private static bool ShouldInvokeInBackground(bool keepInBackground)
@@ -1074,11 +1342,15 @@ public static class MaxSdkCallbacks
 
     private static void LogSubscribedToEvent(string eventName)
     {
+        if (!MaxSdkLogger.IsDebugEnabled) return;
+
         MaxSdkLogger.D("Listener has been added to callback: " + eventName);
     }
 
     private static void LogUnsubscribedToEvent(string eventName)
     {
+        if (!MaxSdkLogger.IsDebugEnabled) return;
+
         MaxSdkLogger.D("Listener has been removed from callback: " + eventName);
     }
 
@@ -1125,6 +1397,7 @@ public static class MaxSdkCallbacks
         Banner.onAdReviewCreativeIdGeneratedEvent = null;
         Banner.onAdExpandedEvent = null;
         Banner.onAdCollapsedEvent = null;
+        Banner.onAdLayoutChangedEvent = null;
 
         MRec.onAdLoadedEvent = null;
         MRec.onAdLoadFailedEvent = null;
@@ -1133,7 +1406,15 @@ public static class MaxSdkCallbacks
         MRec.onAdReviewCreativeIdGeneratedEvent = null;
         MRec.onAdExpandedEvent = null;
         MRec.onAdCollapsedEvent = null;
+        MRec.onAdLayoutChangedEvent = null;
+
+        lock (EventSubscriptionLock)
+        {
+            Volatile.Write(ref _eventSubscriptionMask, 0UL);
+        }
 
+        MaxSdk.SetEventSubscriptionMask(MaxAdStateSnapshot.EventMask);
+        MaxAdStateSnapshot.Reset();
     }
 #endif
 }
@@ -1,19 +1,93 @@
 using System;
+using System.Threading;
+using AppLovinMax.Internal;
 using UnityEngine;
 
+/// <summary>
+/// Messages and exceptions are written to the Unity console in order from a background thread, or on the calling thread in the Unity Editor, see <see cref="MaxLogWriter"/>.
+///
+/// Debug messages can be compiled out by defining <c>MAX_SDK_STRIP_DEBUG_LOGS</c>. Callers building an expensive message should check
+/// <see cref="IsDebugEnabled"/> or <see cref="IsUserDebugEnabled"/> first, so nothing is formatted while the level is disabled.
+/// </summary>
 public class MaxSdkLogger
 {
-    private const string SdkTag = "AppLovin MAX";
+    internal const string SdkTag = "AppLovin MAX";
     public const string KeyVerboseLoggingEnabled = "com.applovin.verbose_logging_enabled";
 
+#if MAX_SDK_STRIP_DEBUG_LOGS
+    private const bool DebugLogsCompiledIn = false;
+#else
+    private const bool DebugLogsCompiledIn = true;
+#endif
+
+    private const int VerboseLoggingUnknown = 0;
+    private const int VerboseLoggingOff = 1;
+    private const int VerboseLoggingOn = 2;
+
+    // Cached so checking the level does not call into native code. Seeded from the platform setting on first read and updated when
+    // verbose logging is set and when the SDK is initialized.
+    private static int _verboseLoggingState = VerboseLoggingUnknown;
+
+    internal static bool VerboseLoggingEnabled
+    {
+        get
+        {
+            var state = Volatile.Read(ref _verboseLoggingState);
+            if (state == VerboseLoggingUnknown)
+            {
+                state = SeedVerboseLoggingState();
+            }
+
+            return state == VerboseLoggingOn;
+        }
+        set { Volatile.Write(ref _verboseLoggingState, value ? VerboseLoggingOn : VerboseLoggingOff); }
+    }
+
+    /// <summary>
+    /// Reads the persisted setting (EditorPrefs, Info.plist or AndroidManifest.xml) so messages logged before the SDK is initialized use it.
+    /// </summary>
+    private static int SeedVerboseLoggingState()
+    {
+        int state;
+        try
+        {
+            state = MaxSdk.IsVerboseLoggingEnabled() ? VerboseLoggingOn : VerboseLoggingOff;
+        }
+        catch (Exception)
+        {
+            // The platform setting can't be read from every thread (e.g. EditorPrefs), try again on the next read.
+            return VerboseLoggingOff;
+        }
+
+        // Don't overwrite a value set explicitly while the setting was being read.
+        var current = Interlocked.CompareExchange(ref _verboseLoggingState, state, VerboseLoggingUnknown);
+        return current == VerboseLoggingUnknown ? state : current;
+    }
+
+    /// <summary>
+    /// Whether <see cref="D"/> messages are logged.
+    /// </summary>
+    internal static bool IsDebugEnabled
+    {
+        get { return DebugLogsCompiledIn && VerboseLoggingEnabled; }
+    }
+
+    /// <summary>
+    /// Whether <see cref="UserDebug"/> messages are logged.
+    /// </summary>
+    internal static bool IsUserDebugEnabled
+    {
+        get { return DebugLogsCompiledIn && !MaxSdk.DisableAllLogs; }
+    }
+
     /// <summary>
     /// Log debug messages.
     /// </summary>
     public static void UserDebug(string message)
     {
-        if (MaxSdk.DisableAllLogs) return;
+        if (!IsUserDebugEnabled) return;
 
-        Debug.Log("Debug [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Log, message);
     }
 
     /// <summary>
@@ -23,9 +97,9 @@ public class MaxSdkLogger
     /// </summary>
     public static void D(string message)
     {
-        if (MaxSdk.DisableAllLogs && !MaxSdk.IsVerboseLoggingEnabled()) return;
+        if (!IsDebugEnabled) return;
 
-        Debug.Log("Debug [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Log, message);
     }
 
     /// <summary>
@@ -35,7 +109,7 @@ public class MaxSdkLogger
     {
         if (MaxSdk.DisableAllLogs) return;
 
-        Debug.LogWarning("Warning [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Warning, message);
     }
 
     /// <summary>
@@ -45,9 +119,9 @@ public class MaxSdkLogger
     /// </summary>
     public static void W(string message)
     {
-        if (MaxSdk.DisableAllLogs && !MaxSdk.IsVerboseLoggingEnabled()) return;
+        if (MaxSdk.DisableAllLogs && !VerboseLoggingEnabled) return;
 
-        Debug.LogWarning("Warning [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Warning, message);
     }
 
     /// <summary>
@@ -57,7 +131,7 @@ public class MaxSdkLogger
     {
         if (MaxSdk.DisableAllLogs) return;
 
-        Debug.LogError("Error [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Error, message);
     }
 
     /// <summary>
@@ -67,9 +141,9 @@ public class MaxSdkLogger
     /// </summary>
     public static void E(string message)
     {
-        if (MaxSdk.DisableAllLogs && !MaxSdk.IsVerboseLoggingEnabled()) return;
+        if (MaxSdk.DisableAllLogs && !VerboseLoggingEnabled) return;
 
-        Debug.LogError("Error [" + SdkTag + "] " + message);
+        MaxLogWriter.Enqueue(LogType.Error, message);
     }
 
     /// <summary>
@@ -78,7 +152,7 @@ public class MaxSdkLogger
     public static void LogException(Exception exception)
     {
         if (MaxSdk.DisableAllLogs) return;
-        
-        Debug.LogException(exception);
+
+        MaxLogWriter.EnqueueException(exception);
     }
 }
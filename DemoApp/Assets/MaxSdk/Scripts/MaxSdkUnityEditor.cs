@@ -35,11 +35,15 @@ public class MaxSdkUnityEditor : MaxSdkBase
     private static readonly Dictionary<string, object> BannerPlacements = new Dictionary<string, object>();
     private static readonly Dictionary<string, object> MRecPlacements = new Dictionary<string, object>();
 
+    // Incremented to stop the event trace replay in progress, if any
+    private static int _eventTraceReplayGeneration;
+
     [RuntimeInitializeOnLoadMethod]
     public static void InitializeMaxSdkUnityEditorOnLoad()
     {
         // Unity destroys the stub banners each time the editor exits play mode, but the StubBanners stays in memory if Enter Play Mode settings is enabled.
         StubBanners.Clear();
+        StopEventTraceReplay();
     }
 
     #region Initialization
@@ -56,6 +60,7 @@ public class MaxSdkUnityEditor : MaxSdkBase
     public static void InitializeSdk(string[] adUnitIds = null)
     {
         _isInitialized = true;
+        MaxSdkLogger.VerboseLoggingEnabled = IsVerboseLoggingEnabled();
 
         // Slight delay to emulate the SDK initializing
         ExecuteWithDelay(0.1f, () =>
@@ -245,6 +250,23 @@ public class MaxSdkUnityEditor : MaxSdkBase
 
     #endregion
 
+    #region Ad Unit Handles
+
+    /// <summary>
+    /// Registers an ad unit and returns a handle that can be passed to the handle overloads of the hot ad calls, such as <see cref="IsInterstitialReady(int)"/>,
+    /// instead of the ad unit identifier. This avoids marshaling the identifier on every call, e.g. when checking readiness every frame.
+    /// Registering the same ad unit identifier again returns the same handle. Handles stay valid for the lifetime of the app.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier to register. Must not be null.</param>
+    /// <returns>A positive handle, or 0 if the ad unit identifier is null or empty.</returns>
+    public static int RegisterAdUnit(string adUnitIdentifier)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "register ad unit");
+        return RegisterAdUnitHandle(adUnitIdentifier);
+    }
+
+    #endregion
+
     #region Banners
 
     /// <summary>
@@ -344,7 +366,10 @@ public class MaxSdkUnityEditor : MaxSdkBase
     /// <param name="bannerPosition">A new position for the banner. Must not be null.</param>
     public static void UpdateBannerPosition(string adUnitIdentifier, AdViewPosition bannerPosition)
     {
-        MaxSdkLogger.D("[AppLovin MAX] Updating banner position to '" + bannerPosition + "' for ad unit id '" + adUnitIdentifier + "'");
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("[AppLovin MAX] Updating banner position to '" + bannerPosition + "' for ad unit id '" + adUnitIdentifier + "'");
+        }
     }
 
     /// <summary>
@@ -369,7 +394,10 @@ public class MaxSdkUnityEditor : MaxSdkBase
     public static void SetBannerWidth(string adUnitIdentifier, float width)
     {
         // NOTE: Will implement in a future release
-        MaxSdkLogger.D("[AppLovin MAX] Set banner width to '" + width + "' for ad unit id '" + adUnitIdentifier + "'");
+        if (MaxSdkLogger.IsDebugEnabled)
+        {
+            MaxSdkLogger.D("[AppLovin MAX] Set banner width to '" + width + "' for ad unit id '" + adUnitIdentifier + "'");
+        }
     }
 
     /// <summary>
@@ -463,6 +491,26 @@ public class MaxSdkUnityEditor : MaxSdkBase
         ValidateAdUnitIdentifier(adUnitIdentifier, "set banner local extra parameter");
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetBannerExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner extra parameters");
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set.</param>
+    public static void SetBannerLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner local extra parameters");
+    }
+
     /// <summary>
     /// The custom data to tie the showing banner ad to, for ILRD and rewarded postbacks via the <c>{CUSTOM_DATA}</c> macro. Maximum size is 8KB.
     /// </summary>
@@ -634,6 +682,26 @@ public class MaxSdkUnityEditor : MaxSdkBase
         ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC local extra parameter");
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetMRecExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC extra parameters");
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set.</param>
+    public static void SetMRecLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC local extra parameters");
+    }
+
     /// <summary>
     /// The custom data to tie the showing MREC ad to, for ILRD and rewarded postbacks via the <c>{CUSTOM_DATA}</c> macro. Maximum size is 8KB.
     /// </summary>
@@ -678,6 +746,18 @@ public class MaxSdkUnityEditor : MaxSdkBase
         });
     }
 
+    /// <summary>
+    /// Start loading an interstitial using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to load.</param>
+    public static void LoadInterstitial(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load interstitial");
+        if (adUnitIdentifier == null) return;
+
+        LoadInterstitial(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if interstitial ad is loaded and ready to be displayed.
     /// </summary>
@@ -697,6 +777,19 @@ public class MaxSdkUnityEditor : MaxSdkBase
         return IsAdUnitReady(adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if an interstitial is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsInterstitialReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check interstitial loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsInterstitialReady(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Present loaded interstitial for a given placement to tie ad events to. Note: if the interstitial is not ready to be displayed nothing will happen.
     /// </summary>
@@ -728,6 +821,20 @@ public class MaxSdkUnityEditor : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded interstitial for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the interstitial is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowInterstitial(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show interstitial");
+        if (adUnitIdentifier == null) return;
+
+        ShowInterstitial(adUnitIdentifier, placement, customData);
+    }
+
     private static void ShowStubInterstitial(string adUnitIdentifier, string placement)
     {
 #if UNITY_EDITOR
@@ -773,6 +880,26 @@ public class MaxSdkUnityEditor : MaxSdkBase
         ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial local extra parameter");
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetInterstitialExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial extra parameters");
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set.</param>
+    public static void SetInterstitialLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial local extra parameters");
+    }
+
     #endregion
 
     #region App Open Ads
@@ -795,6 +922,18 @@ public class MaxSdkUnityEditor : MaxSdkBase
         });
     }
 
+    /// <summary>
+    /// Start loading an app open ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to load.</param>
+    public static void LoadAppOpenAd(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load app open ad");
+        if (adUnitIdentifier == null) return;
+
+        LoadAppOpenAd(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if app open ad ad is loaded and ready to be displayed.
     /// </summary>
@@ -814,6 +953,19 @@ public class MaxSdkUnityEditor : MaxSdkBase
         return IsAdUnitReady(adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if an app open ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsAppOpenAdReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check app open ad loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsAppOpenAdReady(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Present loaded app open ad for a given placement to tie ad events to. Note: if the app open ad is not ready to be displayed nothing will happen.
     /// </summary>
@@ -845,6 +997,20 @@ public class MaxSdkUnityEditor : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded app open ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the app open ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowAppOpenAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show app open ad");
+        if (adUnitIdentifier == null) return;
+
+        ShowAppOpenAd(adUnitIdentifier, placement, customData);
+    }
+
     private static void ShowStubAppOpenAd(string adUnitIdentifier, string placement)
     {
 #if UNITY_EDITOR
@@ -890,6 +1056,26 @@ public class MaxSdkUnityEditor : MaxSdkBase
         ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad local extra parameter");
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetAppOpenAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad extra parameters");
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set.</param>
+    public static void SetAppOpenAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad local extra parameters");
+    }
+
     #endregion
 
     #region Rewarded
@@ -911,6 +1097,18 @@ public class MaxSdkUnityEditor : MaxSdkBase
         });
     }
 
+    /// <summary>
+    /// Start loading a rewarded ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to load.</param>
+    public static void LoadRewardedAd(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "load rewarded ad");
+        if (adUnitIdentifier == null) return;
+
+        LoadRewardedAd(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Check if rewarded ad ad is loaded and ready to be displayed.
     /// </summary>
@@ -930,6 +1128,19 @@ public class MaxSdkUnityEditor : MaxSdkBase
         return IsAdUnitReady(adUnitIdentifier);
     }
 
+    /// <summary>
+    /// Check if a rewarded ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsRewardedAdReady(int adUnitHandle)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "check rewarded ad loaded");
+        if (adUnitIdentifier == null) return false;
+
+        return IsRewardedAdReady(adUnitIdentifier);
+    }
+
     /// <summary>
     /// Present loaded rewarded ad for a given placement to tie ad events to. Note: if the rewarded ad is not ready to be displayed nothing will happen.
     /// </summary>
@@ -961,6 +1172,20 @@ public class MaxSdkUnityEditor : MaxSdkBase
         }
     }
 
+    /// <summary>
+    /// Present loaded rewarded ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the rewarded ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowRewardedAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        var adUnitIdentifier = GetAdUnitIdentifierForHandle(adUnitHandle, "show rewarded ad");
+        if (adUnitIdentifier == null) return;
+
+        ShowRewardedAd(adUnitIdentifier, placement, customData);
+    }
+
     private static void ShowStubRewardedAd(string adUnitIdentifier, string placement)
     {
 #if UNITY_EDITOR
@@ -981,7 +1206,7 @@ public class MaxSdkUnityEditor : MaxSdkBase
             {
                 var rewardEventPropsDict = CreateBaseEventPropsDictionary("OnRewardedAdReceivedRewardEvent", adUnitIdentifier, placement);
                 rewardEventPropsDict["rewardLabel"] = "coins";
-                rewardEventPropsDict["rewardAmount"] = "5";
+                rewardEventPropsDict["rewardAmount"] = 5;
                 var rewardEventProps = Json.Serialize(rewardEventPropsDict);
                 MaxSdkCallbacks.ForwardEvent(rewardEventProps);
             }
@@ -1023,6 +1248,26 @@ public class MaxSdkUnityEditor : MaxSdkBase
         ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded local extra parameter");
     }
 
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetRewardedAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad extra parameters");
+    }
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set.</param>
+    public static void SetRewardedAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad local extra parameters");
+    }
+
     #endregion
 
     #region Event Tracking
@@ -1071,6 +1316,7 @@ public class MaxSdkUnityEditor : MaxSdkBase
 #if UNITY_EDITOR
         EditorPrefs.SetBool(MaxSdkLogger.KeyVerboseLoggingEnabled, enabled);
 #endif
+        MaxSdkLogger.VerboseLoggingEnabled = enabled;
     }
 
     /// <summary>
@@ -1111,6 +1357,39 @@ public class MaxSdkUnityEditor : MaxSdkBase
     /// <param name="enabled"><c>true</c> if the native AppLovin SDKs should not listen to exceptions.</param>
     public static void SetExceptionHandlerEnabled(bool enabled) { }
 
+    public static void SetBinaryEventEncodingEnabled(bool enabled) { }
+
+    public static void SetEventBatchingWindow(int milliseconds) { }
+
+    public static string GetAdUnitStateDump()
+    {
+        return "";
+    }
+
+    public static void SetCallbackPayloadLevel(CallbackPayloadLevel level) { }
+
+    public static void SetCallbackPayloadLevel(string eventName, CallbackPayloadLevel level) { }
+
+    public static void SetPipelineStatsEnabled(bool enabled)
+    {
+        MaxPipelineStats.SetEnabled(enabled);
+    }
+
+    public static PipelineStats GetPipelineStats()
+    {
+        return MaxPipelineStats.CreateStats(null, 0);
+    }
+
+    public static void SetTimelineTracingEnabled(bool enabled)
+    {
+        MaxTimelineTracer.SetEnabled(enabled);
+    }
+
+    public static string GetTimelineTraceJson()
+    {
+        return MaxTimelineTracer.ToChromeTraceJson(null, 0, 0);
+    }
+
     /// <summary>
     /// Set an extra parameter to pass to the AppLovin server.
     /// </summary>
@@ -1132,6 +1411,77 @@ public class MaxSdkUnityEditor : MaxSdkBase
 
     #endregion
 
+    #region Event Traces
+
+    /// <summary>
+    /// Replays a trace recorded with <see cref="MaxSdkBase.StartEventTraceRecording"/> on a device, feeding each recorded callback through the same path as the native plugin,
+    /// from a background thread, with the original spacing between callbacks. Any replay already in progress is stopped.
+    ///
+    /// Ad events replayed in the Unity Editor do not change the state of the stub ads, e.g. a replayed loaded event does not make the stub ad ready.
+    ///
+    /// NOTE: This is only available in the Unity Editor.
+    /// </summary>
+    /// <param name="path">The path of the trace file.</param>
+    /// <param name="speed">How much faster than recorded to replay the callbacks, e.g. <c>2</c> for twice as fast, or <c>0</c> to replay them back to back.</param>
+    /// <returns><c>true</c> if the trace was read and the replay started.</returns>
+    public static bool ReplayEventTrace(string path, float speed = 1f)
+    {
+        StopEventTraceReplay();
+
+        var tracedCallbacks = MaxEventTrace.Read(path);
+        if (tracedCallbacks == null) return false;
+
+        var generation = _eventTraceReplayGeneration;
+        var replayThread = new System.Threading.Thread(() => ReplayEventTrace(tracedCallbacks, speed, generation))
+        {
+            IsBackground = true,
+            Name = "MaxEventTraceReplay"
+        };
+        replayThread.Start();
+
+        MaxSdkLogger.UserDebug("Replaying " + tracedCallbacks.Count + " callbacks from event trace " + path);
+        return true;
+    }
+
+    /// <summary>
+    /// Stops the replay started by <see cref="ReplayEventTrace"/>, if any. Callbacks already replayed are still dispatched.
+    /// </summary>
+    public static void StopEventTraceReplay()
+    {
+        System.Threading.Interlocked.Increment(ref _eventTraceReplayGeneration);
+    }
+
+    private static void ReplayEventTrace(List<MaxEventTrace.TracedCallback> tracedCallbacks, float speed, int generation)
+    {
+        var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+        foreach (var tracedCallback in tracedCallbacks)
+        {
+            if (speed > 0)
+            {
+                var delayMilliseconds = tracedCallback.TimestampMicroseconds / 1000.0 / speed - stopwatch.Elapsed.TotalMilliseconds;
+                if (delayMilliseconds >= 1)
+                {
+                    System.Threading.Thread.Sleep((int) delayMilliseconds);
+                }
+            }
+
+            if (System.Threading.Volatile.Read(ref _eventTraceReplayGeneration) != generation) return;
+
+            if (tracedCallback.Kind == MaxEventTrace.KindBinary)
+            {
+                HandleBinaryBackgroundCallback(tracedCallback.Bytes, tracedCallback.Bytes.Length);
+            }
+            else
+            {
+                HandleBackgroundCallback(tracedCallback.Json);
+            }
+        }
+
+        MaxSdkLogger.UserDebug("Finished replaying event trace");
+    }
+
+    #endregion
+
     #region Internal
 
     private static void RequestAdUnit(string adUnitId)
@@ -1180,6 +1530,8 @@ public class MaxSdkUnityEditor : MaxSdkBase
         };
     }
 
+    internal static void SetEventSubscriptionMask(ulong mask) { }
+
     private static void ExecuteWithDelay(float seconds, Action action)
     {
         MaxEventExecutor.Instance.StartCoroutine(ExecuteAction(seconds, action));
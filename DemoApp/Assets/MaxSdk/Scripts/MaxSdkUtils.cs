@@ -132,8 +132,12 @@ public class MaxSdkUtils
         if (dictionary == null) return defaultValue;
 
         object obj;
+        if (!dictionary.TryGetValue(key, out obj) || obj == null) return defaultValue;
+
+        if (obj is bool) return (bool) obj;
+
         bool value;
-        if (dictionary.TryGetValue(key, out obj) && obj != null && bool.TryParse(obj.ToString(), out value))
+        if (bool.TryParse(obj.ToString(), out value))
         {
             return value;
         }
@@ -153,10 +157,26 @@ public class MaxSdkUtils
         if (dictionary == null) return defaultValue;
 
         object obj;
+        if (!dictionary.TryGetValue(key, out obj) || obj == null) return defaultValue;
+
+        // Payloads decoded by MiniJSON or the native plugins box numbers as long or double, so only stringified values need parsing.
+        // Like parsing, NaN, fractions and values out of range return the default value instead of being truncated.
+        if (obj is long)
+        {
+            var longValue = (long) obj;
+            return longValue >= int.MinValue && longValue <= int.MaxValue ? (int) longValue : defaultValue;
+        }
+
+        if (obj is double)
+        {
+            var doubleValue = (double) obj;
+            return doubleValue >= int.MinValue && doubleValue <= int.MaxValue && doubleValue == Math.Floor(doubleValue) ? (int) doubleValue : defaultValue;
+        }
+
+        if (obj is int) return (int) obj;
+
         int value;
-        if (dictionary.TryGetValue(key, out obj) &&
-            obj != null &&
-            int.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
+        if (int.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
         {
             return value;
         }
@@ -176,10 +196,22 @@ public class MaxSdkUtils
         if (dictionary == null) return defaultValue;
 
         object obj;
+        if (!dictionary.TryGetValue(key, out obj) || obj == null) return defaultValue;
+
+        // Payloads decoded by MiniJSON or the native plugins box numbers as long or double, so only stringified values need parsing.
+        // Like parsing, NaN, fractions and values out of range return the default value instead of being truncated.
+        if (obj is long) return (long) obj;
+        if (obj is double)
+        {
+            // 2^63 is exactly representable, while long.MaxValue rounds up to it
+            var doubleValue = (double) obj;
+            return doubleValue >= long.MinValue && doubleValue < 9223372036854775808.0 && doubleValue == Math.Floor(doubleValue) ? (long) doubleValue : defaultValue;
+        }
+
+        if (obj is int) return (int) obj;
+
         long value;
-        if (dictionary.TryGetValue(key, out obj) &&
-            obj != null &&
-            long.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
+        if (long.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
         {
             return value;
         }
@@ -199,10 +231,15 @@ public class MaxSdkUtils
         if (dictionary == null) return defaultValue;
 
         object obj;
+        if (!dictionary.TryGetValue(key, out obj) || obj == null) return defaultValue;
+
+        // Payloads decoded by MiniJSON or the native plugins box numbers as long or double, so only stringified values need parsing
+        if (obj is long) return (float) (long) obj;
+        if (obj is double) return (float) (double) obj;
+        if (obj is int) return (float) (int) obj;
+
         float value;
-        if (dictionary.TryGetValue(key, out obj) &&
-            obj != null &&
-            float.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
+        if (float.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
         {
             return value;
         }
@@ -222,10 +259,15 @@ public class MaxSdkUtils
         if (dictionary == null) return defaultValue;
 
         object obj;
+        if (!dictionary.TryGetValue(key, out obj) || obj == null) return defaultValue;
+
+        // Payloads decoded by MiniJSON or the native plugins box numbers as long or double, so only stringified values need parsing
+        if (obj is long) return (long) obj;
+        if (obj is double) return (double) obj;
+        if (obj is int) return (int) obj;
+
         double value;
-        if (dictionary.TryGetValue(key, out obj) &&
-            obj != null &&
-            double.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
+        if (double.TryParse(InvariantCultureToString(obj), NumberStyles.Any, CultureInfo.InvariantCulture, out value))
         {
             return value;
         }
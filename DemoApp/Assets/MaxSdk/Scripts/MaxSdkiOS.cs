@@ -5,6 +5,7 @@ using System.Runtime.InteropServices;
 using AOT;
 using UnityEngine;
 using AppLovinMax.ThirdParty.MiniJson;
+using AppLovinMax.Internal;
 
 /// <summary>
 /// iOS AppLovin MAX Unity Plugin implementation
@@ -12,6 +13,7 @@ using AppLovinMax.ThirdParty.MiniJson;
 public class MaxSdkiOS : MaxSdkBase
 {
     private delegate void ALUnityBackgroundCallback(string args);
+    private delegate void ALUnityBinaryBackgroundCallback(IntPtr bytes, int length);
 
     static MaxSdkiOS()
     {
@@ -19,6 +21,9 @@ public class MaxSdkiOS : MaxSdkBase
 
 #if UNITY_IOS
         _MaxSetBackgroundCallback(BackgroundCallback);
+        _MaxSetBinaryBackgroundCallback(BinaryBackgroundCallback);
+        _MaxSetEventSubscriptionMask(MaxSdkCallbacks.EventSubscriptionMask);
+        _MaxSetEventPayloadVersion(MaxEventCodec.PayloadVersion);
 #endif
     }
 
@@ -29,6 +34,12 @@ public class MaxSdkiOS : MaxSdkBase
     [DllImport("__Internal")]
     private static extern void _MaxSetBackgroundCallback(ALUnityBackgroundCallback backgroundCallback);
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetBinaryBackgroundCallback(ALUnityBinaryBackgroundCallback binaryBackgroundCallback);
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetEventPayloadVersion(int version);
+
     [DllImport("__Internal")]
     private static extern void _MaxInitializeSdk(string serializedAdUnitIds, string serializedMetaData);
 
@@ -44,6 +55,9 @@ public class MaxSdkiOS : MaxSdkBase
     {
         var serializedAdUnitIds = (adUnitIds != null) ? string.Join(",", adUnitIds) : "";
         _MaxInitializeSdk(serializedAdUnitIds, GenerateMetaData());
+
+        // Verbose logging may also have been enabled in Info.plist
+        MaxSdkLogger.VerboseLoggingEnabled = IsVerboseLoggingEnabled();
     }
 
     [DllImport("__Internal")]
@@ -95,7 +109,10 @@ public class MaxSdkiOS : MaxSdkBase
     #region MAX
 
     [DllImport("__Internal")]
-    private static extern string _MaxGetAvailableMediatedNetworks();
+    private static extern int _MaxCopyAvailableMediatedNetworks([Out] byte[] buffer, int bufferSize);
+
+    private static readonly MaxNativeStringBuffer AvailableMediatedNetworksBuffer = new MaxNativeStringBuffer(1024);
+    private static readonly MaxNativeStringBuffer.CopyFunction CopyAvailableMediatedNetworks = (arg1, arg2, buffer, bufferSize) => _MaxCopyAvailableMediatedNetworks(buffer, bufferSize);
 
     /// <summary>
     /// Returns the list of available mediation networks.
@@ -104,7 +121,7 @@ public class MaxSdkiOS : MaxSdkBase
     /// </summary>
     public static List<MaxSdkBase.MediatedNetworkInfo> GetAvailableMediatedNetworks()
     {
-        var serializedNetworks = _MaxGetAvailableMediatedNetworks();
+        var serializedNetworks = AvailableMediatedNetworksBuffer.Read(CopyAvailableMediatedNetworks);
         return MaxSdkUtils.PropsStringsToList<MaxSdkBase.MediatedNetworkInfo>(serializedNetworks);
     }
 
@@ -137,7 +154,10 @@ public class MaxSdkiOS : MaxSdkBase
     }
 
     [DllImport("__Internal")]
-    private static extern string _MaxGetAdValue(string adUnitIdentifier, string key);
+    private static extern int _MaxCopyAdValue(string adUnitIdentifier, string key, [Out] byte[] buffer, int bufferSize);
+
+    private static readonly MaxNativeStringBuffer AdValueBuffer = new MaxNativeStringBuffer(256);
+    private static readonly MaxNativeStringBuffer.CopyFunction CopyAdValue = (adUnitIdentifier, key, buffer, bufferSize) => _MaxCopyAdValue(adUnitIdentifier, key, buffer, bufferSize);
 
     /// <summary>
     /// Returns the arbitrary ad value for a given ad unit identifier with key. Returns null if no ad is loaded.
@@ -147,10 +167,15 @@ public class MaxSdkiOS : MaxSdkBase
     /// <returns>Arbitrary ad value for a given key, or null if no ad is loaded.</returns>
     public static string GetAdValue(string adUnitIdentifier, string key)
     {
-        var value = _MaxGetAdValue(adUnitIdentifier, key);
+        string value;
+        if (MaxAdStateSnapshot.TryGetAdValue(adUnitIdentifier, key, out value)) return value;
+
+        value = AdValueBuffer.Read(CopyAdValue, adUnitIdentifier, key);
 
+        // A miss is not cached, since the value may be set once the ad loads
         if (string.IsNullOrEmpty(value)) return null;
 
+        MaxAdStateSnapshot.SetAdValue(adUnitIdentifier, key, value);
         return value;
     }
 
@@ -164,11 +189,14 @@ public class MaxSdkiOS : MaxSdkBase
     /// Note: This method should be called only after SDK has been initialized.
     /// </summary>
     [DllImport("__Internal")]
-    private static extern string _MaxGetSdkConfiguration();
+    private static extern int _MaxCopySdkConfiguration([Out] byte[] buffer, int bufferSize);
+
+    private static readonly MaxNativeStringBuffer SdkConfigurationBuffer = new MaxNativeStringBuffer(256);
+    private static readonly MaxNativeStringBuffer.CopyFunction CopySdkConfiguration = (arg1, arg2, buffer, bufferSize) => _MaxCopySdkConfiguration(buffer, bufferSize);
 
     public static SdkConfiguration GetSdkConfiguration()
     {
-        var sdkConfigurationStr = _MaxGetSdkConfiguration();
+        var sdkConfigurationStr = SdkConfigurationBuffer.Read(CopySdkConfiguration);
         var sdkConfigurationDict = Json.Deserialize(sdkConfigurationStr) as Dictionary<string, object>;
         return SdkConfiguration.Create(sdkConfigurationDict);
     }
@@ -247,6 +275,29 @@ public class MaxSdkiOS : MaxSdkBase
 
     #endregion
 
+    #region Ad Unit Handles
+
+    [DllImport("__Internal")]
+    private static extern int _MaxRegisterAdUnit(string adUnitIdentifier);
+
+    /// <summary>
+    /// Registers an ad unit and returns a handle that can be passed to the handle overloads of the hot ad calls, such as <see cref="IsInterstitialReady(int)"/>,
+    /// instead of the ad unit identifier. This avoids marshaling the identifier on every call, e.g. when checking readiness every frame.
+    /// Registering the same ad unit identifier again returns the same handle. Handles stay valid for the lifetime of the app.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier to register. Must not be null.</param>
+    /// <returns>A positive handle, or 0 if the ad unit identifier is null or empty.</returns>
+    public static int RegisterAdUnit(string adUnitIdentifier)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "register ad unit");
+        var adUnitHandle = _MaxRegisterAdUnit(adUnitIdentifier);
+        TrackAdUnitHandle(adUnitHandle, adUnitIdentifier);
+
+        return adUnitHandle;
+    }
+
+    #endregion
+
     #region Banners
 
     [DllImport("__Internal")]
@@ -469,6 +520,37 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetBannerExtraParameters(string adUnitIdentifier, string serializedExtraParameters);
+
+    /// <summary>
+    /// Set multiple extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetBannerExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner extra parameters");
+
+        if (extraParameters == null || extraParameters.Count == 0) return;
+
+        _MaxSetBannerExtraParameters(adUnitIdentifier, Json.Serialize(extraParameters));
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetBannerLocalExtraParametersJSON(string adUnitIdentifier, string json);
+
+    /// <summary>
+    /// Set multiple local extra parameters for the banner ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the banner to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetBannerLocalExtraParameter"/>. <see cref="IntPtr"/> values are still passed one at a time.</param>
+    public static void SetBannerLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set banner local extra parameters");
+        SetLocalExtraParameters(adUnitIdentifier, localExtraParameters, _MaxSetBannerLocalExtraParameter, _MaxSetBannerLocalExtraParametersJSON);
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxSetBannerCustomData(string adUnitIdentifier, string customData);
 
@@ -484,19 +566,22 @@ public class MaxSdkiOS : MaxSdkBase
     }
 
     [DllImport("__Internal")]
-    private static extern string _MaxGetBannerLayout(string adUnitIdentifier);
+    private static extern void _MaxGetBannerFrame(string adUnitIdentifier, out NativeRect frame);
 
     /// <summary>
     /// The banner position on the screen. When setting the banner position via <see cref="CreateBanner(string, float, float)"/> or <see cref="UpdateBannerPosition(string, float, float)"/>,
     /// the banner is placed within the safe area of the screen. This returns the absolute position of the banner on screen.
+    /// To follow changes, e.g. to anchor UI to the banner, subscribe to <see cref="MaxSdkCallbacks.Banner.OnAdLayoutChangedEvent"/> instead of polling this every frame.
     /// </summary>
     /// <param name="adUnitIdentifier">Ad unit identifier of the banner for which to get the position on screen. Must not be null.</param>
     /// <returns>A <see cref="Rect"/> representing the banner position on screen.</returns>
     public static Rect GetBannerLayout(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "get banner layout");
-        var positionRect = _MaxGetBannerLayout(adUnitIdentifier);
-        return GetRectFromString(positionRect);
+
+        NativeRect frame;
+        _MaxGetBannerFrame(adUnitIdentifier, out frame);
+        return new Rect(frame.X, frame.Y, frame.Width, frame.Height);
     }
 
     #endregion
@@ -695,6 +780,37 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetMRecExtraParameters(string adUnitIdentifier, string serializedExtraParameters);
+
+    /// <summary>
+    /// Set multiple extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetMRecExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC extra parameters");
+
+        if (extraParameters == null || extraParameters.Count == 0) return;
+
+        _MaxSetMRecExtraParameters(adUnitIdentifier, Json.Serialize(extraParameters));
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetMRecLocalExtraParametersJSON(string adUnitIdentifier, string json);
+
+    /// <summary>
+    /// Set multiple local extra parameters for the MREC ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the MREC to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetMRecLocalExtraParameter"/>. <see cref="IntPtr"/> values are still passed one at a time.</param>
+    public static void SetMRecLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set MREC local extra parameters");
+        SetLocalExtraParameters(adUnitIdentifier, localExtraParameters, _MaxSetMRecLocalExtraParameter, _MaxSetMRecLocalExtraParametersJSON);
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxSetMRecCustomData(string adUnitIdentifier, string value);
 
@@ -710,19 +826,22 @@ public class MaxSdkiOS : MaxSdkBase
     }
 
     [DllImport("__Internal")]
-    private static extern string _MaxGetMRecLayout(string adUnitIdentifier);
+    private static extern void _MaxGetMRecFrame(string adUnitIdentifier, out NativeRect frame);
 
     /// <summary>
     /// The MREC position on the screen. When setting the banner position via <see cref="CreateMRec(string, float, float)"/> or <see cref="UpdateMRecPosition(string, float, float)"/>,
     /// the banner is placed within the safe area of the screen. This returns the absolute position of the MREC on screen.
+    /// To follow changes, e.g. to anchor UI to the MREC, subscribe to <see cref="MaxSdkCallbacks.MRec.OnAdLayoutChangedEvent"/> instead of polling this every frame.
     /// </summary>
     /// <param name="adUnitIdentifier">Ad unit identifier of the MREC for which to get the position on screen. Must not be null.</param>
     /// <returns>A <see cref="Rect"/> representing the banner position on screen.</returns>
     public static Rect GetMRecLayout(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "get MREC layout");
-        var positionRect = _MaxGetMRecLayout(adUnitIdentifier);
-        return GetRectFromString(positionRect);
+
+        NativeRect frame;
+        _MaxGetMRecFrame(adUnitIdentifier, out frame);
+        return new Rect(frame.X, frame.Y, frame.Width, frame.Height);
     }
 
     #endregion
@@ -739,9 +858,23 @@ public class MaxSdkiOS : MaxSdkBase
     public static void LoadInterstitial(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load interstitial");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         _MaxLoadInterstitial(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxLoadInterstitialWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Start loading an interstitial using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to load.</param>
+    public static void LoadInterstitial(int adUnitHandle)
+    {
+        MaxAdStateSnapshot.OnLoad(FindAdUnitIdentifierForHandle(adUnitHandle));
+        _MaxLoadInterstitialWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern bool _MaxIsInterstitialReady(string adUnitIdentifier);
 
@@ -753,9 +886,29 @@ public class MaxSdkiOS : MaxSdkBase
     public static bool IsInterstitialReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check interstitial loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return _MaxIsInterstitialReady(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern bool _MaxIsInterstitialReadyWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Check if an interstitial is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsInterstitialReady(int adUnitHandle)
+    {
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(FindAdUnitIdentifierForHandle(adUnitHandle), out isReady)) return isReady;
+
+        return _MaxIsInterstitialReadyWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxShowInterstitial(string adUnitIdentifier, string placement, string customData);
 
@@ -769,8 +922,9 @@ public class MaxSdkiOS : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show interstitial");
 
-        if (IsInterstitialReady(adUnitIdentifier))
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsInterstitialReady(adUnitIdentifier) : IsInterstitialReady(adUnitIdentifier))
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             _MaxShowInterstitial(adUnitIdentifier, placement, customData);
         }
         else
@@ -779,6 +933,28 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxShowInterstitialWithHandle(int adUnitHandle, string placement, string customData);
+
+    /// <summary>
+    /// Present loaded interstitial for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the interstitial is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the interstitial to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowInterstitial(int adUnitHandle, string placement = null, string customData = null)
+    {
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsInterstitialReadyWithHandle(adUnitHandle) : IsInterstitialReady(adUnitHandle))
+        {
+            MaxAdStateSnapshot.OnShow(FindAdUnitIdentifierForHandle(adUnitHandle));
+            _MaxShowInterstitialWithHandle(adUnitHandle, placement, customData);
+        }
+        else
+        {
+            MaxSdkLogger.UserWarning("Not showing MAX Ads interstitial: ad not ready");
+        }
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxSetInterstitialExtraParameter(string adUnitIdentifier, string key, string value);
 
@@ -821,6 +997,37 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetInterstitialExtraParameters(string adUnitIdentifier, string serializedExtraParameters);
+
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetInterstitialExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial extra parameters");
+
+        if (extraParameters == null || extraParameters.Count == 0) return;
+
+        _MaxSetInterstitialExtraParameters(adUnitIdentifier, Json.Serialize(extraParameters));
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetInterstitialLocalExtraParametersJSON(string adUnitIdentifier, string json);
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the interstitial to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetInterstitialLocalExtraParameter"/>. <see cref="IntPtr"/> values are still passed one at a time.</param>
+    public static void SetInterstitialLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set interstitial local extra parameters");
+        SetLocalExtraParameters(adUnitIdentifier, localExtraParameters, _MaxSetInterstitialLocalExtraParameter, _MaxSetInterstitialLocalExtraParametersJSON);
+    }
+
     #endregion
 
     #region App Open Ads
@@ -835,9 +1042,23 @@ public class MaxSdkiOS : MaxSdkBase
     public static void LoadAppOpenAd(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load app open ad");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         _MaxLoadAppOpenAd(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxLoadAppOpenAdWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Start loading an app open ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to load.</param>
+    public static void LoadAppOpenAd(int adUnitHandle)
+    {
+        MaxAdStateSnapshot.OnLoad(FindAdUnitIdentifierForHandle(adUnitHandle));
+        _MaxLoadAppOpenAdWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern bool _MaxIsAppOpenAdReady(string adUnitIdentifier);
 
@@ -849,9 +1070,29 @@ public class MaxSdkiOS : MaxSdkBase
     public static bool IsAppOpenAdReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check app open ad loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return _MaxIsAppOpenAdReady(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern bool _MaxIsAppOpenAdReadyWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Check if an app open ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsAppOpenAdReady(int adUnitHandle)
+    {
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(FindAdUnitIdentifierForHandle(adUnitHandle), out isReady)) return isReady;
+
+        return _MaxIsAppOpenAdReadyWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxShowAppOpenAd(string adUnitIdentifier, string placement, string customData);
 
@@ -865,8 +1106,9 @@ public class MaxSdkiOS : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show app open ad");
 
-        if (IsAppOpenAdReady(adUnitIdentifier))
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsAppOpenAdReady(adUnitIdentifier) : IsAppOpenAdReady(adUnitIdentifier))
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             _MaxShowAppOpenAd(adUnitIdentifier, placement, customData);
         }
         else
@@ -875,6 +1117,28 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxShowAppOpenAdWithHandle(int adUnitHandle, string placement, string customData);
+
+    /// <summary>
+    /// Present loaded app open ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the app open ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the app open ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowAppOpenAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsAppOpenAdReadyWithHandle(adUnitHandle) : IsAppOpenAdReady(adUnitHandle))
+        {
+            MaxAdStateSnapshot.OnShow(FindAdUnitIdentifierForHandle(adUnitHandle));
+            _MaxShowAppOpenAdWithHandle(adUnitHandle, placement, customData);
+        }
+        else
+        {
+            MaxSdkLogger.UserWarning("Not showing MAX Ads app open ad: ad not ready");
+        }
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxSetAppOpenAdExtraParameter(string adUnitIdentifier, string key, string value);
 
@@ -917,6 +1181,37 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetAppOpenAdExtraParameters(string adUnitIdentifier, string serializedExtraParameters);
+
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetAppOpenAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad extra parameters");
+
+        if (extraParameters == null || extraParameters.Count == 0) return;
+
+        _MaxSetAppOpenAdExtraParameters(adUnitIdentifier, Json.Serialize(extraParameters));
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetAppOpenAdLocalExtraParametersJSON(string adUnitIdentifier, string json);
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the app open ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetAppOpenAdLocalExtraParameter"/>. <see cref="IntPtr"/> values are still passed one at a time.</param>
+    public static void SetAppOpenAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set app open ad local extra parameters");
+        SetLocalExtraParameters(adUnitIdentifier, localExtraParameters, _MaxSetAppOpenAdLocalExtraParameter, _MaxSetAppOpenAdLocalExtraParametersJSON);
+    }
+
     #endregion
 
     #region Rewarded
@@ -931,9 +1226,23 @@ public class MaxSdkiOS : MaxSdkBase
     public static void LoadRewardedAd(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "load rewarded ad");
+        MaxAdStateSnapshot.OnLoad(adUnitIdentifier);
         _MaxLoadRewardedAd(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxLoadRewardedAdWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Start loading a rewarded ad using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to load.</param>
+    public static void LoadRewardedAd(int adUnitHandle)
+    {
+        MaxAdStateSnapshot.OnLoad(FindAdUnitIdentifierForHandle(adUnitHandle));
+        _MaxLoadRewardedAdWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern bool _MaxIsRewardedAdReady(string adUnitIdentifier);
 
@@ -945,9 +1254,29 @@ public class MaxSdkiOS : MaxSdkBase
     public static bool IsRewardedAdReady(string adUnitIdentifier)
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "check rewarded ad loaded");
+
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(adUnitIdentifier, out isReady)) return isReady;
+
         return _MaxIsRewardedAdReady(adUnitIdentifier);
     }
 
+    [DllImport("__Internal")]
+    private static extern bool _MaxIsRewardedAdReadyWithHandle(int adUnitHandle);
+
+    /// <summary>
+    /// Check if a rewarded ad is loaded and ready to be displayed using a handle returned by <see cref="RegisterAdUnit"/>.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to check.</param>
+    /// <returns>True if the ad is ready to be displayed</returns>
+    public static bool IsRewardedAdReady(int adUnitHandle)
+    {
+        bool isReady;
+        if (MaxAdStateSnapshot.TryGetReady(FindAdUnitIdentifierForHandle(adUnitHandle), out isReady)) return isReady;
+
+        return _MaxIsRewardedAdReadyWithHandle(adUnitHandle);
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxShowRewardedAd(string adUnitIdentifier, string placement, string customData);
 
@@ -961,8 +1290,9 @@ public class MaxSdkiOS : MaxSdkBase
     {
         ValidateAdUnitIdentifier(adUnitIdentifier, "show rewarded ad");
 
-        if (IsRewardedAdReady(adUnitIdentifier))
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsRewardedAdReady(adUnitIdentifier) : IsRewardedAdReady(adUnitIdentifier))
         {
+            MaxAdStateSnapshot.OnShow(adUnitIdentifier);
             _MaxShowRewardedAd(adUnitIdentifier, placement, customData);
         }
         else
@@ -971,6 +1301,28 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxShowRewardedAdWithHandle(int adUnitHandle, string placement, string customData);
+
+    /// <summary>
+    /// Present loaded rewarded ad for a given placement using a handle returned by <see cref="RegisterAdUnit"/>. Note: if the rewarded ad is not ready to be displayed nothing will happen.
+    /// </summary>
+    /// <param name="adUnitHandle">Handle of the rewarded ad to show.</param>
+    /// <param name="placement">The placement to tie the showing ad's events to</param>
+    /// <param name="customData">The custom data to tie the showing ad's events to. Maximum size is 8KB.</param>
+    public static void ShowRewardedAd(int adUnitHandle, string placement = null, string customData = null)
+    {
+        if (MaxAdStateSnapshot.StrictReadinessCheck ? _MaxIsRewardedAdReadyWithHandle(adUnitHandle) : IsRewardedAdReady(adUnitHandle))
+        {
+            MaxAdStateSnapshot.OnShow(FindAdUnitIdentifierForHandle(adUnitHandle));
+            _MaxShowRewardedAdWithHandle(adUnitHandle, placement, customData);
+        }
+        else
+        {
+            MaxSdkLogger.UserWarning("Not showing MAX Ads rewarded ad: ad not ready");
+        }
+    }
+
     [DllImport("__Internal")]
     private static extern void _MaxSetRewardedAdExtraParameter(string adUnitIdentifier, string key, string value);
 
@@ -1013,6 +1365,37 @@ public class MaxSdkiOS : MaxSdkBase
         }
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetRewardedAdExtraParameters(string adUnitIdentifier, string serializedExtraParameters);
+
+    /// <summary>
+    /// Set multiple extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the extra parameters for. Must not be null.</param>
+    /// <param name="extraParameters">The extra parameters to set. A <c>null</c> value clears the parameter for that key.</param>
+    public static void SetRewardedAdExtraParameters(string adUnitIdentifier, IDictionary<string, string> extraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad extra parameters");
+
+        if (extraParameters == null || extraParameters.Count == 0) return;
+
+        _MaxSetRewardedAdExtraParameters(adUnitIdentifier, Json.Serialize(extraParameters));
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetRewardedAdLocalExtraParametersJSON(string adUnitIdentifier, string json);
+
+    /// <summary>
+    /// Set multiple local extra parameters for the ad at once.
+    /// </summary>
+    /// <param name="adUnitIdentifier">Ad unit identifier of the rewarded ad to set the local extra parameters for. Must not be null.</param>
+    /// <param name="localExtraParameters">The local extra parameters to set. Values accept the same types as <see cref="SetRewardedAdLocalExtraParameter"/>. <see cref="IntPtr"/> values are still passed one at a time.</param>
+    public static void SetRewardedAdLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters)
+    {
+        ValidateAdUnitIdentifier(adUnitIdentifier, "set rewarded ad local extra parameters");
+        SetLocalExtraParameters(adUnitIdentifier, localExtraParameters, _MaxSetRewardedAdLocalExtraParameter, _MaxSetRewardedAdLocalExtraParametersJSON);
+    }
+
     #endregion
 
     #region Event Tracking
@@ -1072,6 +1455,7 @@ public class MaxSdkiOS : MaxSdkBase
     public static void SetVerboseLogging(bool enabled)
     {
         _MaxSetVerboseLogging(enabled);
+        MaxSdkLogger.VerboseLoggingEnabled = enabled;
     }
 
     [DllImport("__Internal")]
@@ -1144,6 +1528,143 @@ public class MaxSdkiOS : MaxSdkBase
         _MaxSetExtraParameter(key, value);
     }
 
+    [DllImport("__Internal")]
+    private static extern void _MaxSetBinaryEventEncodingEnabled(bool enabled);
+
+    /// <summary>
+    /// Whether ad events should be sent from the native plugin using a compact binary encoding instead of JSON. Defaults to <c>false</c>.
+    ///
+    /// The binary encoding is decoded directly into the callback objects, which reduces the garbage generated for every ad event.
+    /// Callbacks are fired with the same values in either mode.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> if ad events should use the binary encoding.</param>
+    public static void SetBinaryEventEncodingEnabled(bool enabled)
+    {
+        _MaxSetBinaryEventEncodingEnabled(enabled);
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetEventBatchingWindowMillis(int millis);
+
+    /// <summary>
+    /// How long, in milliseconds, the native plugin holds an ad event so that events received shortly after are sent to Unity together. Defaults to <c>0</c>.
+    ///
+    /// Events are always batched while the app is in the background, and callbacks are fired in the order the events were received.
+    /// A small window, such as 16 ms, reduces the number of native to managed transitions during bursts of events at the cost of that much delay.
+    /// </summary>
+    /// <param name="milliseconds">The batching window in milliseconds, or <c>0</c> to send events as soon as possible.</param>
+    public static void SetEventBatchingWindow(int milliseconds)
+    {
+        _MaxSetEventBatchingWindowMillis(milliseconds);
+    }
+
+    [DllImport("__Internal")]
+    private static extern int _MaxCopyAdUnitStateDump([Out] byte[] buffer, int bufferSize);
+
+    private static readonly MaxNativeStringBuffer AdUnitStateDumpBuffer = new MaxNativeStringBuffer(1024);
+    private static readonly MaxNativeStringBuffer.CopyFunction CopyAdUnitStateDump = (arg1, arg2, buffer, bufferSize) => _MaxCopyAdUnitStateDump(buffer, bufferSize);
+
+    /// <summary>
+    /// Returns a JSON description of every ad unit the native plugin is tracking, such as its ad view format, position and any settings waiting for the ad view to be created,
+    /// along with the approximate memory held by each record. Intended for debugging leaks, e.g. ad units that were never destroyed.
+    /// </summary>
+    /// <returns>A JSON string with an <c>adUnits</c> array and a <c>totalAllocatedBytes</c> count.</returns>
+    public static string GetAdUnitStateDump()
+    {
+        return AdUnitStateDumpBuffer.Read(CopyAdUnitStateDump);
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetCallbackPayloadLevel(int eventId, int level);
+
+    /// <summary>
+    /// Sets how much of an ad's waterfall is included in every ad event, and clears any level set for individual events. Defaults to <see cref="MaxSdkBase.CallbackPayloadLevel.FullWaterfall"/>.
+    ///
+    /// Large waterfalls, and network credentials in particular, can make up most of each event's payload. Use <see cref="GetPipelineStats"/> to see the bytes sent per event.
+    /// </summary>
+    /// <param name="level">How much of the waterfall to include.</param>
+    public static void SetCallbackPayloadLevel(CallbackPayloadLevel level)
+    {
+        _MaxSetCallbackPayloadLevel(0, (int) level);
+    }
+
+    /// <summary>
+    /// Sets how much of an ad's waterfall is included in one ad event, e.g. to keep the full waterfall only for <c>OnInterstitialLoadFailedEvent</c>.
+    /// </summary>
+    /// <param name="eventName">The name of the event, as listed in <see cref="MaxSdkBase.PipelineStats.EventNames"/>.</param>
+    /// <param name="level">How much of the waterfall to include.</param>
+    public static void SetCallbackPayloadLevel(string eventName, CallbackPayloadLevel level)
+    {
+        var eventId = MaxEventCodec.EventIdForName(eventName);
+        if (eventId == 0)
+        {
+            MaxSdkLogger.UserError("Unable to set the callback payload level for unknown event: " + eventName);
+            return;
+        }
+
+        _MaxSetCallbackPayloadLevel(eventId, (int) level);
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetPipelineStatsEnabled(bool enabled);
+
+    /// <summary>
+    /// Whether to record how long each ad event spends in each stage of the pipeline, from the native SDK calling the plugin until the listener returns. Defaults to <c>false</c>.
+    /// Enabling clears any previously recorded stats. While disabled, recording costs a single flag check per stage.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> to record pipeline stats.</param>
+    public static void SetPipelineStatsEnabled(bool enabled)
+    {
+        MaxPipelineStats.SetEnabled(enabled);
+        _MaxSetPipelineStatsEnabled(enabled);
+    }
+
+    [DllImport("__Internal")]
+    private static extern int _MaxCopyPipelineStats(long[] values, int count);
+
+    /// <summary>
+    /// Returns latency histograms for each stage of the ad event pipeline, per event, recorded since pipeline stats were last enabled.
+    /// See <see cref="SetPipelineStatsEnabled"/>.
+    /// </summary>
+    public static PipelineStats GetPipelineStats()
+    {
+        var nativeValues = new long[MaxPipelineStats.NativeValueCount];
+        var nativeValueCount = _MaxCopyPipelineStats(nativeValues, nativeValues.Length);
+        return MaxPipelineStats.CreateStats(nativeValues, nativeValueCount);
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetTimelineTracingEnabled(bool enabled);
+
+    /// <summary>
+    /// Whether to record a timeline of what the plugin is doing, such as native delegate callbacks, ad view layout passes, blocks run on the main thread,
+    /// calls from the native plugin into Unity and ad event listeners, into a fixed size buffer that keeps the most recent spans. Defaults to <c>false</c>.
+    /// Enabling clears any previously recorded spans. While disabled, recording costs a single flag check per span.
+    /// </summary>
+    /// <param name="enabled"><c>true</c> to record a timeline.</param>
+    public static void SetTimelineTracingEnabled(bool enabled)
+    {
+        MaxTimelineTracer.SetEnabled(enabled);
+        _MaxSetTimelineTracingEnabled(enabled);
+    }
+
+    [DllImport("__Internal")]
+    private static extern long _MaxGetTimelineClock();
+
+    [DllImport("__Internal")]
+    private static extern int _MaxCopyTimelineSpans(long[] values, int count);
+
+    /// <summary>
+    /// Returns the recorded timeline as Chrome trace-event JSON, which can be saved to a file and opened in a trace viewer such as Perfetto or <c>chrome://tracing</c>.
+    /// Native and Unity spans are shown as separate processes on a shared clock, with an instant event at the start of every frame. See <see cref="SetTimelineTracingEnabled"/>.
+    /// </summary>
+    public static string GetTimelineTraceJson()
+    {
+        var nativeValues = new long[MaxTimelineTracer.NativeValueCount];
+        var nativeValueCount = _MaxCopyTimelineSpans(nativeValues, nativeValues.Length);
+        return MaxTimelineTracer.ToChromeTraceJson(nativeValues, nativeValueCount, _MaxGetTimelineClock());
+    }
+
     [DllImport("__Internal")]
     private static extern IntPtr _MaxGetSafeAreaInsets();
 
@@ -1172,12 +1693,82 @@ public class MaxSdkiOS : MaxSdkBase
 
     #region Private
 
+    // NOTE: Must be kept in sync with `max_unity_rect` in MAUnityPlugin.mm
+    [StructLayout(LayoutKind.Sequential)]
+    private struct NativeRect
+    {
+        public float X;
+        public float Y;
+        public float Width;
+        public float Height;
+    }
+
     [MonoPInvokeCallback(typeof(ALUnityBackgroundCallback))]
     internal static void BackgroundCallback(string propsStr)
     {
         HandleBackgroundCallback(propsStr);
     }
 
+    // Each event is fully decoded before the callback returns, so a thread can reuse its buffer. The buffer is per thread since native may call back from several threads at once.
+    [ThreadStatic] private static byte[] _binaryEventBuffer;
+
+    [MonoPInvokeCallback(typeof(ALUnityBinaryBackgroundCallback))]
+    internal static void BinaryBackgroundCallback(IntPtr bytes, int length)
+    {
+        if (bytes == IntPtr.Zero || length <= 0) return;
+
+        var binaryEventBuffer = _binaryEventBuffer;
+        if (binaryEventBuffer == null || binaryEventBuffer.Length < length)
+        {
+            binaryEventBuffer = new byte[Math.Max(length, 4096)];
+            _binaryEventBuffer = binaryEventBuffer;
+        }
+
+        Marshal.Copy(bytes, binaryEventBuffer, 0, length);
+        HandleBinaryBackgroundCallback(binaryEventBuffer, length);
+    }
+
+    [DllImport("__Internal")]
+    private static extern void _MaxSetEventSubscriptionMask(ulong mask);
+
+    /// <summary>
+    /// Tells the native plugin which ad events have listeners, so it can skip building the ones that do not.
+    /// </summary>
+    internal static void SetEventSubscriptionMask(ulong mask)
+    {
+        _MaxSetEventSubscriptionMask(mask);
+    }
+
+    /// <summary>
+    /// Sends every JSON-serializable local extra parameter in a single call. Native object references can't be serialized, so those are set one at a time.
+    /// </summary>
+    private static void SetLocalExtraParameters(string adUnitIdentifier, IDictionary<string, object> localExtraParameters, Action<string, string, IntPtr> setNativeObjectParameter, Action<string, string> setSerializedParameters)
+    {
+        if (localExtraParameters == null || localExtraParameters.Count == 0) return;
+
+        var serializableParameters = new Dictionary<string, object>(localExtraParameters.Count);
+        foreach (var parameter in localExtraParameters)
+        {
+            var value = parameter.Value;
+            if (value is IntPtr)
+            {
+                setNativeObjectParameter(adUnitIdentifier, parameter.Key, (IntPtr) value);
+            }
+            else if (value == null || value.GetType().IsPrimitive || value is string || value is IList || value is IDictionary)
+            {
+                serializableParameters[parameter.Key] = value;
+            }
+            else
+            {
+                MaxSdkLogger.UserError("Local extra parameters must be an IList, IDictionary, string, or a primitive type. Skipping \"" + parameter.Key + "\"");
+            }
+        }
+
+        if (serializableParameters.Count == 0) return;
+
+        setSerializedParameters(adUnitIdentifier, Json.Serialize(serializableParameters));
+    }
+
     #endregion
 
     #region Obsolete
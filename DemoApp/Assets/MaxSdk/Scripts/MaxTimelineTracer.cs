@@ -0,0 +1,285 @@
+//
+//  MaxTimelineTracer.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using AppLovinMax.ThirdParty.MiniJson;
+
+namespace AppLovinMax.Internal
+{
+    /// <summary>
+    /// Timeline spans for the managed half of the plugin, from the background callback receiving events until their listeners return, kept in a preallocated ring buffer.
+    /// The native plugin keeps its own spans with its own clock, which <see cref="ToChromeTraceJson"/> lines up with Unity's and merges in.
+    ///
+    /// Spans are written without taking a lock. Once the buffer is full, the oldest spans are overwritten. While disabled, every hook returns after reading a single volatile field.
+    /// </summary>
+    internal static class MaxTimelineTracer
+    {
+        // NOTE: Must be kept in sync with MAUnityTimelineTracer.h
+        private const int NativeSpanCapacity = 4096;
+        private const int NativeValuesPerSpan = 4;
+        internal const int NativeValueCount = NativeSpanCapacity * NativeValuesPerSpan;
+        private const long NativeMainThreadFlag = 1L << 8;
+        private const int NativeDelegateSpan = 0;
+        private const int NativeAdViewLayoutSpan = 1;
+        private static readonly string[] NativeSpanNames = {"Delegate", "AdViewLayout", "MainThreadBlock"};
+
+        private const int Capacity = 4096;
+        private const int NativeProcessId = 1;
+        private const int UnityProcessId = 2;
+
+        internal enum SpanKind : byte
+        {
+            BackgroundCallback, // The argument is the payload size in bytes
+            Handler,            // The argument is how long the event waited for the main thread, in ticks
+            Frame               // An instant at the start of MaxEventExecutor.Update. The argument is the frame count.
+        }
+
+        private struct Span
+        {
+            // 0 while empty or being written, and the span's index plus one once written
+            public long Sequence;
+            public long StartTimestamp;
+            public long EndTimestamp;
+            public long Argument;
+            public string Name;
+            public int ThreadId;
+            public SpanKind Kind;
+        }
+
+        private static volatile bool _enabled;
+        private static Span[] _spans;
+        private static long _spanCount;
+        private static volatile int _mainThreadId = -1;
+
+        internal static bool IsEnabled
+        {
+            get { return _enabled; }
+        }
+
+        /// <summary>
+        /// Enabling clears any previously recorded spans. The buffer is allocated the first time tracing is enabled and reused after that.
+        /// </summary>
+        internal static void SetEnabled(bool enabled)
+        {
+            if (enabled && !_enabled)
+            {
+                if (_spans == null)
+                {
+                    _spans = new Span[Capacity];
+                }
+                else
+                {
+                    Array.Clear(_spans, 0, _spans.Length);
+                }
+
+                Interlocked.Exchange(ref _spanCount, 0);
+            }
+
+            _enabled = enabled;
+        }
+
+        /// <summary>
+        /// Returns the current timestamp, or <c>0</c> while disabled so callers can skip recording spans they did not time.
+        /// </summary>
+        internal static long GetTimestamp()
+        {
+            return _enabled ? Stopwatch.GetTimestamp() : 0;
+        }
+
+        /// <summary>
+        /// Records a span on the current thread from <paramref name="startTimestamp"/> until now. Spans with a zero start are ignored.
+        /// </summary>
+        internal static void Record(SpanKind kind, string name, long argument, long startTimestamp)
+        {
+            if (startTimestamp == 0 || !_enabled) return;
+
+            Write(kind, name, argument, startTimestamp, Stopwatch.GetTimestamp());
+        }
+
+        /// <summary>
+        /// Marks the start of a frame. Must be called from the Unity main thread.
+        /// </summary>
+        internal static void RecordFrame(int frameCount)
+        {
+            if (!_enabled) return;
+
+            _mainThreadId = Thread.CurrentThread.ManagedThreadId;
+
+            var timestamp = Stopwatch.GetTimestamp();
+            Write(SpanKind.Frame, "Frame", frameCount, timestamp, timestamp);
+        }
+
+        /// <summary>
+        /// Returns the recorded spans, merged with the first <paramref name="nativeValueCount"/> values copied from the native plugin, as Chrome trace-event JSON.
+        /// </summary>
+        /// <param name="nativeValues">The spans copied from the native plugin, or <c>null</c> if there are none.</param>
+        /// <param name="nativeValueCount">The number of values in <paramref name="nativeValues"/>.</param>
+        /// <param name="nativeClockNanoseconds">The native clock, read as close to now as possible, used to line the native spans up with Unity's clock.</param>
+        internal static string ToChromeTraceJson(long[] nativeValues, int nativeValueCount, long nativeClockNanoseconds)
+        {
+            var unityClockMicroseconds = TicksToMicroseconds(Stopwatch.GetTimestamp());
+            var traceEvents = new List<object>
+            {
+                CreateMetadataEvent("process_name", NativeProcessId, 0, "MAX Native"),
+                CreateMetadataEvent("process_name", UnityProcessId, 0, "MAX Unity")
+            };
+
+            if (nativeValues != null && nativeClockNanoseconds > 0)
+            {
+                AddNativeSpans(traceEvents, nativeValues, nativeValueCount, unityClockMicroseconds - nativeClockNanoseconds / 1000);
+            }
+
+            AddUnitySpans(traceEvents);
+
+            return Json.Serialize(new Dictionary<string, object>
+            {
+                {"traceEvents", traceEvents},
+                {"displayTimeUnit", "ms"}
+            });
+        }
+
+        private static void Write(SpanKind kind, string name, long argument, long startTimestamp, long endTimestamp)
+        {
+            var spans = _spans;
+            if (spans == null) return;
+
+            var index = Interlocked.Increment(ref _spanCount) - 1;
+            var slot = (int) (index % spans.Length);
+
+            Volatile.Write(ref spans[slot].Sequence, 0);
+            spans[slot].StartTimestamp = startTimestamp;
+            spans[slot].EndTimestamp = endTimestamp;
+            spans[slot].Argument = argument;
+            spans[slot].Name = name;
+            spans[slot].ThreadId = Thread.CurrentThread.ManagedThreadId;
+            spans[slot].Kind = kind;
+            Volatile.Write(ref spans[slot].Sequence, index + 1);
+        }
+
+        private static void AddUnitySpans(List<object> traceEvents)
+        {
+            var spans = _spans;
+            if (spans == null) return;
+
+            var mainThreadId = _mainThreadId;
+            if (mainThreadId >= 0)
+            {
+                traceEvents.Add(CreateMetadataEvent("thread_name", UnityProcessId, mainThreadId, "Main Thread"));
+            }
+
+            var spanCount = Interlocked.Read(ref _spanCount);
+            for (var index = Math.Max(spanCount - spans.Length, 0); index < spanCount; index++)
+            {
+                var slot = (int) (index % spans.Length);
+                if (Volatile.Read(ref spans[slot].Sequence) != index + 1) continue;
+
+                var span = spans[slot];
+                Thread.MemoryBarrier();
+
+                // Overwritten while being copied
+                if (Volatile.Read(ref spans[slot].Sequence) != index + 1) continue;
+
+                var startMicroseconds = TicksToMicroseconds(span.StartTimestamp);
+                switch (span.Kind)
+                {
+                    case SpanKind.BackgroundCallback:
+                        traceEvents.Add(CreateCompleteEvent(span.Name, UnityProcessId, span.ThreadId, startMicroseconds, TicksToMicroseconds(span.EndTimestamp), "bytes", span.Argument));
+                        break;
+                    case SpanKind.Handler:
+                        traceEvents.Add(CreateCompleteEvent(span.Name, UnityProcessId, span.ThreadId, startMicroseconds, TicksToMicroseconds(span.EndTimestamp), "queueMicroseconds", TicksToMicroseconds(span.Argument)));
+                        break;
+                    case SpanKind.Frame:
+                        traceEvents.Add(new Dictionary<string, object>
+                        {
+                            {"name", span.Name},
+                            {"ph", "i"},
+                            {"s", "g"},
+                            {"ts", startMicroseconds},
+                            {"pid", UnityProcessId},
+                            {"tid", span.ThreadId},
+                            {"args", new Dictionary<string, object> {{"frameCount", span.Argument}}}
+                        });
+                        break;
+                }
+            }
+        }
+
+        private static void AddNativeSpans(List<object> traceEvents, long[] nativeValues, int nativeValueCount, long offsetMicroseconds)
+        {
+            var namedMainThread = false;
+            for (var offset = 0; offset + NativeValuesPerSpan <= nativeValueCount; offset += NativeValuesPerSpan)
+            {
+                var threadId = nativeValues[offset + 2];
+                var info = nativeValues[offset + 3];
+                var kind = (int) (info & 0xFF);
+                if (kind >= NativeSpanNames.Length) continue;
+
+                if ((info & NativeMainThreadFlag) != 0 && !namedMainThread)
+                {
+                    traceEvents.Add(CreateMetadataEvent("thread_name", NativeProcessId, threadId, "Main Thread"));
+                    namedMainThread = true;
+                }
+
+                var startMicroseconds = nativeValues[offset] / 1000 + offsetMicroseconds;
+                var endMicroseconds = nativeValues[offset + 1] / 1000 + offsetMicroseconds;
+                var argument = (long) ((ulong) info >> 32);
+                switch (kind)
+                {
+                    case NativeDelegateSpan:
+                        traceEvents.Add(CreateCompleteEvent(NativeSpanNames[kind], NativeProcessId, threadId, startMicroseconds, endMicroseconds, "event", GetEventName((int) argument)));
+                        break;
+                    case NativeAdViewLayoutSpan:
+                        traceEvents.Add(CreateCompleteEvent(NativeSpanNames[kind], NativeProcessId, threadId, startMicroseconds, endMicroseconds, "adViewCount", argument));
+                        break;
+                    default:
+                        traceEvents.Add(CreateCompleteEvent(NativeSpanNames[kind], NativeProcessId, threadId, startMicroseconds, endMicroseconds, "waitMicroseconds", argument));
+                        break;
+                }
+            }
+        }
+
+        private static Dictionary<string, object> CreateCompleteEvent(string name, int processId, long threadId, long startMicroseconds, long endMicroseconds, string argumentName, object argument)
+        {
+            return new Dictionary<string, object>
+            {
+                {"name", name ?? ""},
+                {"cat", "max"},
+                {"ph", "X"},
+                {"ts", startMicroseconds},
+                {"dur", Math.Max(endMicroseconds - startMicroseconds, 0)},
+                {"pid", processId},
+                {"tid", threadId},
+                {"args", new Dictionary<string, object> {{argumentName, argument}}}
+            };
+        }
+
+        private static Dictionary<string, object> CreateMetadataEvent(string name, int processId, long threadId, string value)
+        {
+            return new Dictionary<string, object>
+            {
+                {"name", name},
+                {"ph", "M"},
+                {"pid", processId},
+                {"tid", threadId},
+                {"args", new Dictionary<string, object> {{"name", value}}}
+            };
+        }
+
+        private static string GetEventName(int eventId)
+        {
+            return eventId > 0 && eventId < MaxEventCodec.EventNames.Length ? MaxEventCodec.EventNames[eventId] : MaxSdkBase.PipelineStats.OtherEventsName;
+        }
+
+        private static long TicksToMicroseconds(long ticks)
+        {
+            return (long) (ticks * (1000000.0 / Stopwatch.Frequency));
+        }
+    }
+}
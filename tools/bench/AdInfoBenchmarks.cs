@@ -0,0 +1,69 @@
+//
+//  AdInfoBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.Collections.Generic;
+using AppLovinMax.Internal;
+using AppLovinMax.ThirdParty.MiniJson;
+using BenchmarkDotNet.Attributes;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// Building <see cref="MaxSdkBase.AdInfo"/> and its <see cref="MaxSdkBase.WaterfallInfo"/> from an already parsed payload, and the
+    /// <see cref="MaxSdkUtils"/> dictionary getters the dictionary path is built on.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class AdInfoBenchmarks
+    {
+        [ParamsSource(nameof(FixtureNames))]
+        public string Fixture { get; set; }
+
+        public static string[] FixtureNames
+        {
+            get { return Fixtures.Names; }
+        }
+
+        private Dictionary<string, object> _eventProps;
+        private byte[] _binary;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            _eventProps = (Dictionary<string, object>) Json.Deserialize(Fixtures.LoadJson(Fixture));
+            _binary = Fixtures.LoadBinary(Fixture);
+        }
+
+        [Benchmark(Baseline = true)]
+        public int AdInfoFromDictionary()
+        {
+            return new MaxSdkBase.AdInfo(_eventProps).WaterfallInfo.NetworkResponses.Count;
+        }
+
+        [Benchmark]
+        public int AdInfoFromBinary()
+        {
+            string eventName;
+            bool keepInBackground;
+            MaxEventReader reader;
+            MaxEventCodec.TryOpen(_binary, 0, _binary.Length, out eventName, out keepInBackground, out reader);
+            return new MaxSdkBase.AdInfo(reader).WaterfallInfo.NetworkResponses.Count;
+        }
+
+        [Benchmark]
+        public double DictionaryGetters()
+        {
+            var length = MaxSdkUtils.GetStringFromDictionary(_eventProps, "adUnitId").Length +
+                         MaxSdkUtils.GetStringFromDictionary(_eventProps, "networkName").Length +
+                         MaxSdkUtils.GetLongFromDictionary(_eventProps, "latencyMillis") +
+                         (MaxSdkUtils.GetBoolFromDictionary(_eventProps, "keepInBackground") ? 1 : 0);
+
+            var waterfallInfo = MaxSdkUtils.GetDictionaryFromDictionary(_eventProps, "waterfallInfo");
+            var networkResponses = MaxSdkUtils.GetListFromDictionary(waterfallInfo, "networkResponses");
+            return length + networkResponses.Count + MaxSdkUtils.GetDoubleFromDictionary(_eventProps, "revenue");
+        }
+    }
+}
@@ -0,0 +1,129 @@
+//
+//  BatchedCallbackBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Text;
+using BenchmarkDotNet.Attributes;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// A burst of ad events handed to the background callback the native plugins call into, either one callback per event or as one batch:
+    /// JSON events joined with '\n', or binary frames sent back to back. Each operation handles <see cref="EventsPerBatch"/> events.
+    ///
+    /// Only the managed side is measured. On device every callback also crosses from native code into Unity, which batching saves as well.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class BatchedCallbackBenchmarks
+    {
+        /// <summary>
+        /// Exposes the callbacks <c>MaxSdkiOS</c> and <c>MaxSdkAndroid</c> forward their native callbacks to.
+        /// </summary>
+        private sealed class NativeCallbacks : MaxSdkBase
+        {
+            internal static void OnBackgroundCallback(string propsStr)
+            {
+                HandleBackgroundCallback(propsStr);
+            }
+
+            internal static void OnBinaryBackgroundCallback(byte[] eventBytes, int length)
+            {
+                HandleBinaryBackgroundCallback(eventBytes, length);
+            }
+        }
+
+        [ParamsSource(nameof(FixtureNames))]
+        public string Fixture { get; set; }
+
+        [Params(1, 8, 32)]
+        public int EventsPerBatch { get; set; }
+
+        public static string[] FixtureNames
+        {
+            get { return Fixtures.Names; }
+        }
+
+        private string _json;
+        private byte[] _binary;
+        private string _batchedJson;
+        private byte[] _batchedBinary;
+        private int _handledCount;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            _json = Fixtures.LoadJson(Fixture);
+            _binary = Fixtures.LoadBinary(Fixture);
+
+            var batchedJson = new StringBuilder();
+            _batchedBinary = new byte[_binary.Length * EventsPerBatch];
+            for (var i = 0; i < EventsPerBatch; i++)
+            {
+                if (i > 0)
+                {
+                    batchedJson.Append('\n');
+                }
+
+                batchedJson.Append(_json);
+                Buffer.BlockCopy(_binary, 0, _batchedBinary, i * _binary.Length, _binary.Length);
+            }
+
+            _batchedJson = batchedJson.ToString();
+
+            // Invoke the handler on the calling thread, rather than queueing it for a main thread that never runs
+            MaxSdkBase.InvokeEventsOnUnityMainThread = false;
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += OnAdLoadedEvent;
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent -= OnAdLoadedEvent;
+        }
+
+        [Benchmark(Baseline = true)]
+        public int JsonPerEvent()
+        {
+            for (var i = 0; i < EventsPerBatch; i++)
+            {
+                NativeCallbacks.OnBackgroundCallback(_json);
+            }
+
+            return _handledCount;
+        }
+
+        [Benchmark]
+        public int JsonBatched()
+        {
+            NativeCallbacks.OnBackgroundCallback(_batchedJson);
+            return _handledCount;
+        }
+
+        [Benchmark]
+        public int BinaryPerEvent()
+        {
+            for (var i = 0; i < EventsPerBatch; i++)
+            {
+                NativeCallbacks.OnBinaryBackgroundCallback(_binary, _binary.Length);
+            }
+
+            return _handledCount;
+        }
+
+        [Benchmark]
+        public int BinaryBatched()
+        {
+            NativeCallbacks.OnBinaryBackgroundCallback(_batchedBinary, _batchedBinary.Length);
+            return _handledCount;
+        }
+
+        private void OnAdLoadedEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo)
+        {
+            _handledCount++;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  CallbackBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using BenchmarkDotNet.Attributes;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// One ad event through <see cref="MaxSdkCallbacks.ForwardEvent(string)"/>, from the payload the native plugin hands over to the publisher's handler.
+    /// The handler reads the waterfall, so its decoding is included.
+    ///
+    /// With <see cref="MaxSdkBase.PooledCallbackPayloadsEnabled"/> set, binary events reuse their <see cref="MaxSdkBase.AdInfo"/> once the handler returns.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class CallbackBenchmarks
+    {
+        [ParamsSource(nameof(FixtureNames))]
+        public string Fixture { get; set; }
+
+        [Params(false, true)]
+        public bool PooledPayloads { get; set; }
+
+        public static string[] FixtureNames
+        {
+            get { return Fixtures.Names; }
+        }
+
+        private string _json;
+        private byte[] _binary;
+        private int _networkResponseCount;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            _json = Fixtures.LoadJson(Fixture);
+            _binary = Fixtures.LoadBinary(Fixture);
+
+            // Invoke the handler on the calling thread, rather than queueing it for a main thread that never runs
+            MaxSdkBase.InvokeEventsOnUnityMainThread = false;
+            MaxSdkBase.PooledCallbackPayloadsEnabled = PooledPayloads;
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += OnAdLoadedEvent;
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent -= OnAdLoadedEvent;
+            MaxSdkBase.PooledCallbackPayloadsEnabled = false;
+        }
+
+        [Benchmark(Baseline = true)]
+        public int ForwardJsonEvent()
+        {
+            MaxSdkCallbacks.ForwardEvent(_json);
+            return _networkResponseCount;
+        }
+
+        [Benchmark]
+        public int ForwardBinaryEvent()
+        {
+            MaxSdkCallbacks.ForwardEvent(_binary, 0, _binary.Length);
+            return _networkResponseCount;
+        }
+
+        private void OnAdLoadedEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo)
+        {
+            _networkResponseCount = adInfo.WaterfallInfo.NetworkResponses.Count;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  ExecutorBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using AppLovinMax.Internal;
+using BenchmarkDotNet.Attributes;
+using UnityEngine;
+using UnityShim;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// Queueing a frame's worth of events for the main thread with <see cref="MaxEventExecutor"/> and dispatching them in the next <c>Update</c>.
+    /// Reward and layout events pass a struct, which is stored in the queued event rather than boxed.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class ExecutorBenchmarks
+    {
+        [Params(1, 16, 256)]
+        public int EventsPerFrame { get; set; }
+
+        private readonly Action<string, MaxSdkBase.AdInfo> _handler = OnAdEvent;
+        private readonly Action<string, MaxSdkBase.Reward, MaxSdkBase.AdInfo> _rewardHandler = OnRewardEvent;
+        private readonly Action<string, Rect> _layoutHandler = OnLayoutEvent;
+        private readonly MaxSdkBase.AdInfo _adInfo = new MaxSdkBase.AdInfo(new Dictionary<string, object>());
+        private readonly MaxSdkBase.Reward _reward = new MaxSdkBase.Reward {Label = "coins", Amount = 25};
+        private readonly Rect _layout = new Rect(0, 0, 320, 50);
+
+        private static int _dispatchedCount;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            MaxEventExecutor.InitializeIfNeeded();
+        }
+
+        [Benchmark(Baseline = true)]
+        public int EnqueueAndDispatch()
+        {
+            for (var i = 0; i < EventsPerFrame; i++)
+            {
+                MaxEventExecutor.ExecuteOnMainThread(_handler, "4a5b6c7d8e9f0a1b", _adInfo, "OnInterstitialLoadedEvent");
+            }
+
+            PlayerLoop.Update();
+            return _dispatchedCount;
+        }
+
+        [Benchmark]
+        public int EnqueueAndDispatchReward()
+        {
+            for (var i = 0; i < EventsPerFrame; i++)
+            {
+                MaxEventExecutor.ExecuteOnMainThread(_rewardHandler, "4a5b6c7d8e9f0a1b", _reward, _adInfo, "OnRewardedAdReceivedRewardEvent");
+            }
+
+            PlayerLoop.Update();
+            return _dispatchedCount;
+        }
+
+        [Benchmark]
+        public int EnqueueAndDispatchLayout()
+        {
+            for (var i = 0; i < EventsPerFrame; i++)
+            {
+                MaxEventExecutor.ExecuteOnMainThread(_layoutHandler, "4a5b6c7d8e9f0a1b", _layout, "OnBannerAdLayoutChangedEvent");
+            }
+
+            PlayerLoop.Update();
+            return _dispatchedCount;
+        }
+
+        private static void OnAdEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo)
+        {
+            _dispatchedCount++;
+        }
+
+        private static void OnRewardEvent(string adUnitIdentifier, MaxSdkBase.Reward reward, MaxSdkBase.AdInfo adInfo)
+        {
+            _dispatchedCount += reward.Amount;
+        }
+
+        private static void OnLayoutEvent(string adUnitIdentifier, Rect layout)
+        {
+            _dispatchedCount++;
+        }
+    }
+}
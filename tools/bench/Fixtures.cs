@@ -0,0 +1,37 @@
+//
+//  Fixtures.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.IO;
+using System.Runtime.CompilerServices;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// The payloads in <c>fixtures/</c>: one interstitial loaded event with a 1, 10 or 40 network waterfall, as the JSON string and the binary frame
+    /// the iOS plugin sends for it. See <c>fixtures/generate_fixtures.c</c>.
+    /// </summary>
+    internal static class Fixtures
+    {
+        internal static readonly string[] Names = {"small", "waterfall10", "waterfall40"};
+
+        internal static string LoadJson(string name)
+        {
+            return File.ReadAllText(GetPath(name, "json"));
+        }
+
+        internal static byte[] LoadBinary(string name)
+        {
+            return File.ReadAllBytes(GetPath(name, "bin"));
+        }
+
+        // BenchmarkDotNet runs each benchmark from a generated project, so fixtures are found relative to this source file rather than the output directory
+        private static string GetPath(string name, string extension, [CallerFilePath] string sourceFilePath = "")
+        {
+            return Path.Combine(Path.GetDirectoryName(sourceFilePath), "fixtures", name + "." + extension);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//
+//  JsonBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.Collections.Generic;
+using AppLovinMax.Internal;
+using AppLovinMax.ThirdParty.MiniJson;
+using BenchmarkDotNet.Attributes;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// Parsing and serializing an event payload with MiniJSON, against a full pass of <see cref="MaxJsonReader"/> over the same payload.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class JsonBenchmarks
+    {
+        [ParamsSource(nameof(FixtureNames))]
+        public string Fixture { get; set; }
+
+        public static string[] FixtureNames
+        {
+            get { return Fixtures.Names; }
+        }
+
+        private string _json;
+        private Dictionary<string, object> _eventProps;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            _json = Fixtures.LoadJson(Fixture);
+            _eventProps = (Dictionary<string, object>) Json.Deserialize(_json);
+        }
+
+        [Benchmark(Baseline = true)]
+        public object MiniJsonDeserialize()
+        {
+            return Json.Deserialize(_json);
+        }
+
+        [Benchmark]
+        public string MiniJsonSerialize()
+        {
+            return Json.Serialize(_eventProps);
+        }
+
+        [Benchmark]
+        public int JsonReaderReadAll()
+        {
+            MaxJsonReader reader;
+            return MaxJsonReader.TryOpen(_json, out reader) ? CountValues(reader) : 0;
+        }
+
+        private static int CountValues(MaxJsonReader reader)
+        {
+            var count = 0;
+            while (reader.MoveNext())
+            {
+                count++;
+                switch (reader.ValueType)
+                {
+                    case MaxEventCodec.ValueTypeObject:
+                    case MaxEventCodec.ValueTypeList:
+                        count += CountValues(reader.ReadContainer());
+                        break;
+                    case MaxEventCodec.ValueTypeString:
+                        count += reader.ReadString().Length > 0 ? 0 : 1;
+                        break;
+                    case MaxEventCodec.ValueTypeDouble:
+                    case MaxEventCodec.ValueTypeInt64:
+                        count += reader.ReadDouble() > 0 ? 0 : 1;
+                        break;
+                }
+            }
+
+            return count;
+        }
+    }
+}
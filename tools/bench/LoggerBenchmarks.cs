@@ -0,0 +1,65 @@
+//
+//  LoggerBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using BenchmarkDotNet.Attributes;
+using UnityShim;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// Setters that log a debug message, with verbose logging off and on. While it is off, the message must not even be formatted.
+    ///
+    /// The <c>MaxSdkUnityEditor</c> setters only log, so they measure the logging overhead of a setter call. Messages are written by the
+    /// <c>MaxLogWriter</c> thread, and the ones it cannot keep up with are dropped. The native side is measured by <c>tools/bench/native</c>.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class LoggerBenchmarks
+    {
+        [Params(false, true)]
+        public bool VerboseLogging { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            MaxSdkLogger.VerboseLoggingEnabled = VerboseLogging;
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            MaxSdkLogger.VerboseLoggingEnabled = false;
+        }
+
+        // Keep the messages captured by the UnityEngine shim from piling up across iterations
+        [IterationCleanup]
+        public void ClearLogs()
+        {
+            LogCapture.Clear();
+        }
+
+        [Benchmark(Baseline = true)]
+        public void SetBannerWidth()
+        {
+            MaxSdk.SetBannerWidth("4a5b6c7d8e9f0a1b", 320.5f);
+        }
+
+        [Benchmark]
+        public void UpdateBannerPosition()
+        {
+            MaxSdk.UpdateBannerPosition("4a5b6c7d8e9f0a1b", MaxSdkBase.AdViewPosition.BottomCenter);
+        }
+
+        [Benchmark]
+        public void AddAndRemoveListener()
+        {
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += OnAdLoadedEvent;
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent -= OnAdLoadedEvent;
+        }
+
+        private static void OnAdLoadedEvent(string adUnitIdentifier, MaxSdkBase.AdInfo adInfo) { }
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  MarshalingBenchmarks.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.IO;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using BenchmarkDotNet.Attributes;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// The string and ad unit handle overloads of <c>IsInterstitialReady</c> and <c>LoadInterstitial</c>, through the same P/Invoke declarations as
+    /// <c>MaxSdkiOS</c>. A string argument is copied to a temporary UTF-8 buffer on every call, while a handle is passed as is.
+    ///
+    /// The exports are stand-ins built by <c>make -C tools/bench/native marshal_stub</c>, see marshal_stub.c. The <c>MaxSdk</c> handle overloads are not
+    /// measured here, since outside of iOS they look up the identifier and call the string overload.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class MarshalingBenchmarks
+    {
+        private const string StubLibrary = "max_marshal_stub";
+        private const string AdUnitIdentifier = "4a5b6c7d8e9f0a1b";
+        private const int AdUnitHandle = 4; // The handle of AdUnitIdentifier in marshal_stub.c
+
+        private static bool _isResolverSet;
+
+        [DllImport(StubLibrary)]
+        private static extern bool _MaxIsInterstitialReady(string adUnitIdentifier);
+
+        [DllImport(StubLibrary)]
+        private static extern bool _MaxIsInterstitialReadyWithHandle(int adUnitHandle);
+
+        [DllImport(StubLibrary)]
+        private static extern void _MaxLoadInterstitial(string adUnitIdentifier);
+
+        [DllImport(StubLibrary)]
+        private static extern void _MaxLoadInterstitialWithHandle(int adUnitHandle);
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            var libraryPath = GetLibraryPath();
+            if (!File.Exists(libraryPath)) throw new InvalidOperationException(libraryPath + " does not exist, run `make -C tools/bench/native marshal_stub` first");
+
+            if (!_isResolverSet)
+            {
+                NativeLibrary.SetDllImportResolver(typeof(MarshalingBenchmarks).Assembly, ResolveStubLibrary);
+                _isResolverSet = true;
+            }
+
+            if (!_MaxIsInterstitialReady(AdUnitIdentifier) || !_MaxIsInterstitialReadyWithHandle(AdUnitHandle))
+            {
+                throw new InvalidOperationException("The stub does not report " + AdUnitIdentifier + " as ready");
+            }
+        }
+
+        [Benchmark(Baseline = true)]
+        public bool IsInterstitialReady()
+        {
+            return _MaxIsInterstitialReady(AdUnitIdentifier);
+        }
+
+        [Benchmark]
+        public bool IsInterstitialReadyWithHandle()
+        {
+            return _MaxIsInterstitialReadyWithHandle(AdUnitHandle);
+        }
+
+        [Benchmark]
+        public void LoadInterstitial()
+        {
+            _MaxLoadInterstitial(AdUnitIdentifier);
+        }
+
+        [Benchmark]
+        public void LoadInterstitialWithHandle()
+        {
+            _MaxLoadInterstitialWithHandle(AdUnitHandle);
+        }
+
+        /// <summary>
+        /// Only the managed side of the string overloads: the UTF-8 copy made for the call, without the transition to native code.
+        /// </summary>
+        [Benchmark]
+        public IntPtr MarshalIdentifierToUtf8()
+        {
+            var utf8 = Marshal.StringToCoTaskMemUTF8(AdUnitIdentifier);
+            Marshal.FreeCoTaskMem(utf8);
+            return utf8;
+        }
+
+        private static IntPtr ResolveStubLibrary(string libraryName, Assembly assembly, DllImportSearchPath? searchPath)
+        {
+            return libraryName == StubLibrary ? NativeLibrary.Load(GetLibraryPath()) : IntPtr.Zero;
+        }
+
+        // BenchmarkDotNet runs each benchmark from a generated project, so the library is found relative to this source file rather than the output directory
+        private static string GetLibraryPath([CallerFilePath] string sourceFilePath = "")
+        {
+            return Path.Combine(Path.GetDirectoryName(sourceFilePath), "native", "build", "libmax_marshal_stub.so");
+        }
+    }
+}
@@ -0,0 +1,43 @@
+//
+//  Program.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.IO;
+using System.Runtime.CompilerServices;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Exporters;
+using BenchmarkDotNet.Exporters.Csv;
+using BenchmarkDotNet.Running;
+
+namespace AppLovinMax.Benchmarks
+{
+    /// <summary>
+    /// Runs the benchmarks selected on the command line, e.g. <c>dotnet run -c Release -- --filter '*Callback*'</c>.
+    ///
+    /// Every run reports throughput, allocated bytes and GC counts per operation. The GitHub markdown and CSV reports are written to
+    /// <c>tools/bench/artifacts/results</c>, so a run can be committed as a baseline and later runs diffed against it.
+    /// </summary>
+    public static class Program
+    {
+        public static void Main(string[] args)
+        {
+            var config = ManualConfig.Create(DefaultConfig.Instance)
+                .WithArtifactsPath(Path.Combine(GetProjectDirectory(), "artifacts"))
+                .AddDiagnoser(MemoryDiagnoser.Default)
+                .AddColumn(StatisticColumn.OperationsPerSecond)
+                .AddExporter(MarkdownExporter.GitHub, CsvExporter.Default);
+
+            BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, config);
+        }
+
+        private static string GetProjectDirectory([CallerFilePath] string sourceFilePath = "")
+        {
+            return Path.GetDirectoryName(sourceFilePath);
+        }
+    }
+}
@@ -0,0 +1,247 @@
+//
+//  generate_fixtures.c
+//  AppLovin MAX Unity Plugin
+//
+//  Writes the benchmark payloads: an interstitial loaded event with a 1, 10 and 40 network waterfall, as the JSON string and the binary frame
+//  MAUnityAdManager sends for it at the full waterfall payload level. The binary frames are produced by the plugin's own encoder.
+//
+//  Usage: generate_fixtures <output directory>
+//
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MAUnityEventCodec.h"
+
+#define MAX_FIXTURE_JSON_CAPACITY (256 * 1024)
+
+// Mirrors `MAAdLoadState`
+#define MAX_FIXTURE_AD_LOAD_STATE_NOT_ATTEMPTED 0
+#define MAX_FIXTURE_AD_LOAD_STATE_LOADED 1
+#define MAX_FIXTURE_AD_LOAD_STATE_FAILED 2
+
+typedef struct
+{
+    const char *name;
+    const char *adapter_class_name;
+    const char *adapter_version;
+    const char *sdk_version;
+} max_fixture_network;
+
+static const max_fixture_network max_fixture_networks[] = {
+    {"AppLovin", "ALAppLovinMediationAdapter", "13.0.1", "13.0.1"},
+    {"Google AdMob", "ALGoogleMediationAdapter", "11.13.0.0", "afma-sdk-i-v11.13.0"},
+    {"Meta Audience Network", "ALFacebookMediationAdapter", "6.15.2.1", "6.15.2"},
+    {"Unity Ads", "ALUnityAdsMediationAdapter", "4.12.5.0", "4.12.5"},
+    {"ironSource", "ALIronSourceMediationAdapter", "8.4.0.0.0", "8.4.0"},
+    {"Mintegral", "ALMintegralMediationAdapter", "7.7.3.0.0", "7.7.3"},
+    {"Pangle", "ALByteDanceMediationAdapter", "6.4.0.5.0", "6.4.0.5"},
+    {"Liftoff Monetize", "ALVungleMediationAdapter", "7.4.2.0", "7.4.2"},
+    {"InMobi", "ALInMobiMediationAdapter", "10.8.0.0", "10.8.0"},
+    {"Chartboost", "ALChartboostMediationAdapter", "9.8.0.0", "9.8.0"}
+};
+
+static const size_t max_fixture_network_count = sizeof(max_fixture_networks) / sizeof(max_fixture_networks[0]);
+
+// MARK: - JSON
+
+typedef struct
+{
+    char bytes[MAX_FIXTURE_JSON_CAPACITY];
+    size_t length;
+} max_fixture_json;
+
+static void max_fixture_json_append(max_fixture_json *json, const char *format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    int written = vsnprintf(json->bytes + json->length, sizeof(json->bytes) - json->length, format, arguments);
+    va_end(arguments);
+
+    if ( written < 0 || (size_t) written >= sizeof(json->bytes) - json->length )
+    {
+        fprintf(stderr, "JSON fixture is too large\n");
+        exit(1);
+    }
+
+    json->length += (size_t) written;
+}
+
+// The fixture strings never need escaping
+static void max_fixture_json_string(max_fixture_json *json, const char *key, const char *value, int is_first)
+{
+    max_fixture_json_append(json, "%s\"%s\":\"%s\"", is_first ? "" : ",", key, value);
+}
+
+static void max_fixture_json_number(max_fixture_json *json, const char *key, long long value, int is_first)
+{
+    max_fixture_json_append(json, "%s\"%s\":%lld", is_first ? "" : ",", key, value);
+}
+
+// MARK: - Payload
+
+static void max_fixture_write_string(max_unity_event_writer *writer, max_fixture_json *json, uint8_t field_id, const char *key, const char *value, int is_first)
+{
+    max_unity_event_write_string(writer, field_id, value, strlen(value));
+    max_fixture_json_string(json, key, value, is_first);
+}
+
+static void max_fixture_write_int64(max_unity_event_writer *writer, max_fixture_json *json, uint8_t field_id, const char *key, long long value, int is_first)
+{
+    max_unity_event_write_int64(writer, field_id, value);
+    max_fixture_json_number(json, key, value, is_first);
+}
+
+static void max_fixture_write_network_response(max_unity_event_writer *writer, max_fixture_json *json, size_t index, int ad_load_state)
+{
+    const max_fixture_network *network = &max_fixture_networks[index % max_fixture_network_count];
+    char placement_id[64];
+    snprintf(placement_id, sizeof(placement_id), "%zu_%08zx", 1000 + index, index * 2654435761u);
+
+    size_t response_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_OBJECT);
+    max_fixture_json_append(json, "%s{", index == 0 ? "" : ",");
+    max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_AD_LOAD_STATE, "adLoadState", ad_load_state, 1);
+
+    size_t network_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_MEDIATED_NETWORK, MAX_UNITY_VALUE_OBJECT);
+    max_fixture_json_append(json, ",\"mediatedNetwork\":{");
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_NAME, "name", network->name, 1);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_ADAPTER_CLASS_NAME, "adapterClassName", network->adapter_class_name, 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_ADAPTER_VERSION, "adapterVersion", network->adapter_version, 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_SDK_VERSION, "sdkVersion", network->sdk_version, 0);
+    max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_INITIALIZATION_STATUS, "initializationStatus", 3, 0);
+    max_unity_event_end_container(writer, network_marker);
+    max_fixture_json_append(json, "}");
+
+    size_t credentials_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_CREDENTIALS, MAX_UNITY_VALUE_MAP);
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "placement_id", strlen("placement_id"));
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, placement_id, strlen(placement_id));
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "app_id", strlen("app_id"));
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "1234567890", strlen("1234567890"));
+    max_unity_event_end_container(writer, credentials_marker);
+    max_fixture_json_append(json, ",\"credentials\":{\"placement_id\":\"%s\",\"app_id\":\"1234567890\"}", placement_id);
+
+    int is_bidding = index % 3 == 0;
+    max_unity_event_write_bool(writer, MAX_UNITY_FIELD_IS_BIDDING, is_bidding);
+    max_fixture_json_append(json, ",\"isBidding\":%s", is_bidding ? "true" : "false");
+
+    if ( ad_load_state == MAX_FIXTURE_AD_LOAD_STATE_FAILED )
+    {
+        size_t error_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_ERROR, MAX_UNITY_VALUE_OBJECT);
+        max_fixture_json_append(json, ",\"error\":{");
+        max_fixture_write_string(writer, json, MAX_UNITY_FIELD_ERROR_MESSAGE, "errorMessage", "No Fill", 1);
+
+        // The load failure info has no field id, so MAUnityAdManager only sends it as JSON
+        max_fixture_json_string(json, "adLoadFailure", "Network returned no fill for this placement", 0);
+        max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_ERROR_CODE, "errorCode", 204, 0);
+        max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_LATENCY_MILLIS, "latencyMillis", 40 + (long long) index * 7, 0);
+        max_unity_event_end_container(writer, error_marker);
+        max_fixture_json_append(json, "}");
+    }
+
+    max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_LATENCY_MILLIS, "latencyMillis", ad_load_state == MAX_FIXTURE_AD_LOAD_STATE_NOT_ATTEMPTED ? 0 : 45 + (long long) index * 7, 0);
+    max_unity_event_end_container(writer, response_marker);
+    max_fixture_json_append(json, "}");
+}
+
+/**
+ * Every network before the one that filled failed with no fill, and the rest were not attempted.
+ */
+static void max_fixture_write_event(max_unity_event_writer *writer, max_fixture_json *json, size_t network_response_count)
+{
+    size_t loaded_index = network_response_count / 2;
+
+    max_unity_event_begin(writer, MAX_UNITY_EVENT_INTERSTITIAL_LOADED, MAX_UNITY_EVENT_FLAG_KEEP_IN_BACKGROUND);
+    json->length = 0;
+    max_fixture_json_append(json, "{\"name\":\"OnInterstitialLoadedEvent\",\"keepInBackground\":true");
+
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_AD_UNIT_ID, "adUnitId", "4a5b6c7d8e9f0a1b", 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_AD_FORMAT, "adFormat", "INTER", 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_NETWORK_NAME, "networkName", max_fixture_networks[loaded_index % max_fixture_network_count].name, 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_NETWORK_PLACEMENT, "networkPlacement", "inter_regular", 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_CREATIVE_ID, "creativeId", "cr_83721", 0);
+
+    max_unity_event_write_double(writer, MAX_UNITY_FIELD_REVENUE, 0.012345);
+    max_fixture_json_append(json, ",\"revenue\":0.012345");
+
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_REVENUE_PRECISION, "revenuePrecision", "exact", 0);
+
+    size_t waterfall_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_WATERFALL_INFO, MAX_UNITY_VALUE_OBJECT);
+    max_fixture_json_append(json, ",\"waterfallInfo\":{");
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_NAME, "name", "Default Waterfall", 1);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_TEST_NAME, "testName", "control", 0);
+
+    size_t responses_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NETWORK_RESPONSES, MAX_UNITY_VALUE_LIST);
+    max_fixture_json_append(json, ",\"networkResponses\":[");
+    for ( size_t i = 0; i < network_response_count; i++ )
+    {
+        int ad_load_state = i < loaded_index ? MAX_FIXTURE_AD_LOAD_STATE_FAILED : i == loaded_index ? MAX_FIXTURE_AD_LOAD_STATE_LOADED : MAX_FIXTURE_AD_LOAD_STATE_NOT_ATTEMPTED;
+        max_fixture_write_network_response(writer, json, i, ad_load_state);
+    }
+    max_unity_event_end_container(writer, responses_marker);
+    max_fixture_json_append(json, "]");
+
+    max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_LATENCY_MILLIS, "latencyMillis", 120 + (long long) network_response_count * 25, 0);
+    max_unity_event_end_container(writer, waterfall_marker);
+    max_fixture_json_append(json, "}");
+
+    max_fixture_write_int64(writer, json, MAX_UNITY_FIELD_LATENCY_MILLIS, "latencyMillis", 130 + (long long) network_response_count * 25, 0);
+    max_fixture_write_string(writer, json, MAX_UNITY_FIELD_DSP_NAME, "dspName", "", 0);
+    max_fixture_json_append(json, "}");
+
+    if ( !max_unity_event_end(writer) )
+    {
+        fprintf(stderr, "Failed to encode fixture\n");
+        exit(1);
+    }
+}
+
+static void max_fixture_write_file(const char *directory, const char *name, const char *extension, const void *bytes, size_t length)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s.%s", directory, name, extension);
+
+    FILE *file = fopen(path, "wb");
+    if ( !file || fwrite(bytes, 1, length, file) != length )
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        exit(1);
+    }
+
+    fclose(file);
+}
+
+int main(int argc, char *argv[])
+{
+    if ( argc != 2 )
+    {
+        fprintf(stderr, "Usage: %s <output directory>\n", argv[0]);
+        return 1;
+    }
+
+    static const struct
+    {
+        const char *name;
+        size_t network_response_count;
+    } fixtures[] = {
+        {"small", 1},
+        {"waterfall10", 10},
+        {"waterfall40", 40}
+    };
+
+    static max_fixture_json json;
+    max_unity_event_writer writer;
+    max_unity_event_writer_init(&writer, 1024);
+
+    for ( size_t i = 0; i < sizeof(fixtures) / sizeof(fixtures[0]); i++ )
+    {
+        max_fixture_write_event(&writer, &json, fixtures[i].network_response_count);
+        max_fixture_write_file(argv[1], fixtures[i].name, "json", json.bytes, json.length);
+        max_fixture_write_file(argv[1], fixtures[i].name, "bin", writer.bytes, writer.length);
+        printf("%s: %zu bytes JSON, %zu bytes binary\n", fixtures[i].name, json.length, writer.length);
+    }
+
+    max_unity_event_writer_free(&writer);
+    return 0;
+}
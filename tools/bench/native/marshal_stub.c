@@ -0,0 +1,87 @@
+//
+//  marshal_stub.c
+//  AppLovin MAX Unity Plugin
+//
+//  Stand-ins for the `_MaxIsInterstitialReady` and `_MaxLoadInterstitial` exports of MAUnityPlugin.mm, with and without an ad unit handle,
+//  loaded by `MarshalingBenchmarks` so the managed side of each call is the same P/Invoke as in `MaxSdkiOS`. The Objective-C exports need UIKit,
+//  so the string exports model `NSSTRING`, which copies and trims the identifier, and the ad unit lookup, while the handle exports index the handle table
+//  the way `-[MAUnityAdManager adUnitIdentifierForHandle:]` does.
+//
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_BENCH_AD_UNIT_COUNT 4
+
+static const char *const ad_unit_identifiers[MAX_BENCH_AD_UNIT_COUNT] = {
+    "1a2b3c4d5e6f7a8b",
+    "2b3c4d5e6f7a8b9c",
+    "3c4d5e6f7a8b9c0d",
+    "4a5b6c7d8e9f0a1b",
+};
+
+static bool ready_ad_units[MAX_BENCH_AD_UNIT_COUNT] = {true, false, true, true};
+static volatile int load_count;
+
+static int ad_unit_index_for_identifier(const char *adUnitIdentifier)
+{
+    if ( !adUnitIdentifier ) return -1;
+
+    // Copy and trim the identifier, like `NSSTRING` creating a trimmed NSString
+    const char *start = adUnitIdentifier;
+    while ( *start == ' ' ) start++;
+
+    size_t length = strlen(start);
+    while ( length > 0 && start[length - 1] == ' ' ) length--;
+
+    char *identifier = malloc(length + 1);
+    if ( !identifier ) return -1;
+
+    memcpy(identifier, start, length);
+    identifier[length] = '\0';
+
+    int index = -1;
+    for ( int i = 0; i < MAX_BENCH_AD_UNIT_COUNT; i++ )
+    {
+        if ( strcmp(ad_unit_identifiers[i], identifier) == 0 )
+        {
+            index = i;
+            break;
+        }
+    }
+
+    free(identifier);
+    return index;
+}
+
+static int ad_unit_index_for_handle(int adUnitHandle)
+{
+    return adUnitHandle > 0 && adUnitHandle <= MAX_BENCH_AD_UNIT_COUNT ? adUnitHandle - 1 : -1;
+}
+
+bool _MaxIsInterstitialReady(const char *adUnitIdentifier)
+{
+    int index = ad_unit_index_for_identifier(adUnitIdentifier);
+    return index >= 0 && ready_ad_units[index];
+}
+
+bool _MaxIsInterstitialReadyWithHandle(int adUnitHandle)
+{
+    int index = ad_unit_index_for_handle(adUnitHandle);
+    return index >= 0 && ready_ad_units[index];
+}
+
+void _MaxLoadInterstitial(const char *adUnitIdentifier)
+{
+    if ( ad_unit_index_for_identifier(adUnitIdentifier) < 0 ) return;
+
+    load_count++;
+}
+
+void _MaxLoadInterstitialWithHandle(int adUnitHandle)
+{
+    if ( ad_unit_index_for_handle(adUnitHandle) < 0 ) return;
+
+    load_count++;
+}
@@ -0,0 +1,157 @@
+//
+//  setter_logging_bench.c
+//  AppLovin MAX Unity Plugin
+//
+//  Measures the throughput of an ad view setter with logging off and on. The Objective-C setters need UIKit, so this models
+//  `-[MAUnityAdManager setAdViewWidth:forAdUnitIdentifier:adFormat:]`: check `MAX_UNITY_LOG_IS_ENABLED`, format the debug message, log it and store the width.
+//  Logging on is measured both through the `MAUnityLogger.c` ring and written synchronously under a lock, the way `NSLog` was called before the ring.
+//  Messages are written to /dev/null, the cheapest sink there is, so the synchronous numbers are a lower bound of what `NSLog` costs.
+//
+//  Reports the wall time and the CPU time of the calling thread per call. The latter is what a setter costs the Unity thread; with fewer cores
+//  than threads the wall time also includes the background writer.
+//
+//  Usage: setter_logging_bench [calls per run]
+//
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MAUnityLogger.h"
+
+#define RUN_COUNT 5
+
+typedef struct
+{
+    // Volatile so the loop is not optimized away once logging is compiled out
+    volatile double adViewWidth;
+} ad_unit_state;
+
+static bool log_synchronously;
+static FILE *log_sink;
+static pthread_mutex_t log_sink_mutex = PTHREAD_MUTEX_INITIALIZER;
+static atomic_ullong written_count;
+
+static void write_to_sink(max_unity_log_level level, const char *message, size_t length)
+{
+    (void) level;
+    fwrite(message, 1, length, log_sink);
+    fputc('\n', log_sink);
+    atomic_fetch_add_explicit(&written_count, 1, memory_order_relaxed);
+}
+
+static void log_with_level(max_unity_log_level level, const char *format, ...)
+{
+    char message[MAX_UNITY_LOG_MESSAGE_CAPACITY];
+    int prefix_length = snprintf(message, sizeof(message), "[MAUnityAdManager] ");
+
+    va_list valist;
+    va_start(valist, format);
+    int length = vsnprintf(message + prefix_length, sizeof(message) - (size_t) prefix_length, format, valist);
+    va_end(valist);
+
+    size_t total_length = (size_t) prefix_length + (size_t) length;
+    if ( total_length >= sizeof(message) )
+    {
+        total_length = sizeof(message) - 1;
+    }
+
+    if ( log_synchronously )
+    {
+        pthread_mutex_lock(&log_sink_mutex);
+        write_to_sink(level, message, total_length);
+        fflush(log_sink);
+        pthread_mutex_unlock(&log_sink_mutex);
+    }
+    else
+    {
+        max_unity_log_enqueue(level, message, total_length);
+    }
+}
+
+#define LOG_DEBUG(...) do { if ( MAX_UNITY_LOG_IS_ENABLED(MAX_UNITY_LOG_LEVEL_DEBUG) ) log_with_level(MAX_UNITY_LOG_LEVEL_DEBUG, __VA_ARGS__); } while ( 0 )
+
+static void set_ad_view_width(ad_unit_state *state, double width, const char *adUnitIdentifier, const char *adFormat)
+{
+    LOG_DEBUG("Setting width %f for \"%s\" with ad unit identifier \"%s\"", width, adFormat, adUnitIdentifier);
+
+    // Banners and leaders need to be at least 320pts wide.
+    double minWidth = 320.0;
+    state->adViewWidth = width < minWidth ? minWidth : width;
+}
+
+static double now_seconds(clockid_t clock)
+{
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
+
+static void run(const char *name, max_unity_log_level level, bool synchronously, long calls)
+{
+    max_unity_log_set_level(level);
+    log_synchronously = synchronously;
+
+    static ad_unit_state state;
+    double best_seconds = 0;
+    double best_thread_seconds = 0;
+    uint64_t dropped_before = max_unity_log_dropped_count();
+    unsigned long long written_before = atomic_load(&written_count);
+
+    for ( int run_index = 0; run_index < RUN_COUNT; run_index++ )
+    {
+        double start = now_seconds(CLOCK_MONOTONIC);
+        double thread_start = now_seconds(CLOCK_THREAD_CPUTIME_ID);
+        for ( long i = 0; i < calls; i++ )
+        {
+            set_ad_view_width(&state, 300.0 + (double) (i & 63), "YOUR_BANNER_AD_UNIT_ID", "BANNER");
+        }
+
+        double thread_seconds = now_seconds(CLOCK_THREAD_CPUTIME_ID) - thread_start;
+        double seconds = now_seconds(CLOCK_MONOTONIC) - start;
+        if ( run_index == 0 || seconds < best_seconds )
+        {
+            best_seconds = seconds;
+        }
+
+        if ( run_index == 0 || thread_seconds < best_thread_seconds )
+        {
+            best_thread_seconds = thread_seconds;
+        }
+    }
+
+    uint64_t dropped = max_unity_log_dropped_count() - dropped_before;
+    unsigned long long written = atomic_load(&written_count) - written_before;
+    printf("%-26s %9.1f ns/call wall %9.1f ns/call calling thread   written %llu, dropped %llu\n",
+           name, best_seconds * 1e9 / (double) calls, best_thread_seconds * 1e9 / (double) calls, written, (unsigned long long) dropped);
+}
+
+int main(int argc, char *argv[])
+{
+    long calls = argc > 1 ? atol(argv[1]) : 1000000;
+    if ( calls <= 0 )
+    {
+        fprintf(stderr, "Usage: %s [calls per run]\n", argv[0]);
+        return 1;
+    }
+
+    log_sink = fopen("/dev/null", "w");
+    if ( !log_sink )
+    {
+        perror("/dev/null");
+        return 1;
+    }
+
+    max_unity_log_set_writer(write_to_sink);
+
+    printf("%ld calls per run, best of %d runs, MAX_UNITY_LOG_MIN_LEVEL %d\n", calls, RUN_COUNT, MAX_UNITY_LOG_MIN_LEVEL);
+    run("logging off", MAX_UNITY_LOG_LEVEL_WARNING, false, calls);
+    run("logging on, ring", MAX_UNITY_LOG_LEVEL_DEBUG, false, calls);
+    run("logging on, synchronous", MAX_UNITY_LOG_LEVEL_DEBUG, true, calls);
+
+    return 0;
+}
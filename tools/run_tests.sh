@@ -0,0 +1,11 @@
+#!/bin/sh
+#
+# Runs the native tests, then the C# tests that decode their output. Arguments are passed on to the C# test runner as name filters.
+#
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+
+make -C "$TOOLS_DIR/tests/native"
+dotnet run --project "$TOOLS_DIR/tests/MaxSdk.Tests.csproj" -c Release -- "$@"
@@ -0,0 +1,689 @@
+//
+//  UnityEngine.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+//  The subset of the UnityEngine API used by the plugin's runtime scripts, so they can be built and run under .NET without Unity.
+//  Behaviours are driven by UnityShim.PlayerLoop. Anything that needs the real engine (rendering, UI, web requests) is a no-op.
+//
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using UnityShim;
+
+namespace AOT
+{
+    [AttributeUsage(AttributeTargets.Method)]
+    public class MonoPInvokeCallbackAttribute : Attribute
+    {
+        public MonoPInvokeCallbackAttribute(Type type) { }
+    }
+}
+
+namespace UnityEngine
+{
+    public enum HideFlags
+    {
+        None = 0,
+        HideAndDontSave = 61
+    }
+
+    public enum RuntimePlatform
+    {
+        OSXEditor = 0,
+        IPhonePlayer = 8,
+        Android = 11,
+        LinuxPlayer = 13
+    }
+
+    public enum LogType
+    {
+        Error,
+        Assert,
+        Warning,
+        Log,
+        Exception
+    }
+
+    public enum RuntimeInitializeLoadType
+    {
+        AfterSceneLoad,
+        BeforeSceneLoad,
+        AfterAssembliesLoaded,
+        BeforeSplashScreen,
+        SubsystemRegistration
+    }
+
+    [AttributeUsage(AttributeTargets.Method)]
+    public class RuntimeInitializeOnLoadMethodAttribute : Attribute
+    {
+        public RuntimeInitializeOnLoadMethodAttribute() { }
+        public RuntimeInitializeOnLoadMethodAttribute(RuntimeInitializeLoadType loadType) { }
+    }
+
+    [AttributeUsage(AttributeTargets.Field)]
+    public class SerializeField : Attribute { }
+
+    public class Object
+    {
+        public string name;
+        public HideFlags hideFlags;
+
+        internal bool IsDestroyed { get; set; }
+
+        public static void DontDestroyOnLoad(Object target) { }
+
+        public static void Destroy(Object target)
+        {
+            if (target == null) return;
+
+            var gameObject = target as GameObject;
+            if (gameObject != null)
+            {
+                gameObject.DestroyComponents();
+            }
+
+            var behaviour = target as MonoBehaviour;
+            if (behaviour != null)
+            {
+                PlayerLoop.Unregister(behaviour);
+            }
+
+            target.IsDestroyed = true;
+        }
+
+        public static T Instantiate<T>(T original, Vector3 position, Quaternion rotation) where T : Object
+        {
+            return original;
+        }
+
+        public static implicit operator bool(Object target)
+        {
+            return target != null && !target.IsDestroyed;
+        }
+    }
+
+    public class Component : Object
+    {
+        public GameObject gameObject { get; internal set; }
+
+        public T GetComponent<T>()
+        {
+            return gameObject != null ? gameObject.GetComponent<T>() : default(T);
+        }
+
+        public T GetComponentInChildren<T>()
+        {
+            return GetComponent<T>();
+        }
+    }
+
+    public class Behaviour : Component
+    {
+        public bool enabled = true;
+    }
+
+    public sealed class Coroutine
+    {
+        internal Coroutine() { }
+    }
+
+    public class MonoBehaviour : Behaviour
+    {
+        public Coroutine StartCoroutine(IEnumerator routine)
+        {
+            return PlayerLoop.StartCoroutine(this, routine);
+        }
+
+        public void StopCoroutine(Coroutine coroutine)
+        {
+            PlayerLoop.StopCoroutine(coroutine);
+        }
+
+        public void Invoke(string methodName, float time) { }
+    }
+
+    public class GameObject : Object
+    {
+        private static readonly List<GameObject> GameObjects = new List<GameObject>();
+
+        private readonly List<Component> _components = new List<Component>();
+
+        public bool activeSelf = true;
+
+        public GameObject() : this("New Game Object") { }
+
+        public GameObject(string name)
+        {
+            this.name = name;
+            lock (GameObjects)
+            {
+                GameObjects.Add(this);
+            }
+        }
+
+        public T AddComponent<T>() where T : Component, new()
+        {
+            var component = new T {gameObject = this, name = name};
+            _components.Add(component);
+
+            var behaviour = component as MonoBehaviour;
+            if (behaviour != null)
+            {
+                PlayerLoop.Register(behaviour);
+            }
+
+            return component;
+        }
+
+        public T GetComponent<T>()
+        {
+            foreach (var component in _components)
+            {
+                if (component is T) return (T) (object) component;
+            }
+
+            return default(T);
+        }
+
+        public T GetComponentInChildren<T>()
+        {
+            return GetComponent<T>();
+        }
+
+        public void SetActive(bool value)
+        {
+            activeSelf = value;
+        }
+
+        public static GameObject Find(string name)
+        {
+            lock (GameObjects)
+            {
+                foreach (var gameObject in GameObjects)
+                {
+                    if (gameObject && gameObject.name == name) return gameObject;
+                }
+            }
+
+            return null;
+        }
+
+        internal void DestroyComponents()
+        {
+            foreach (var component in _components)
+            {
+                Destroy(component);
+            }
+
+            _components.Clear();
+            lock (GameObjects)
+            {
+                GameObjects.Remove(this);
+            }
+        }
+    }
+
+    public struct Vector2
+    {
+        public float x;
+        public float y;
+
+        public Vector2(float x, float y)
+        {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    public struct Vector3
+    {
+        public float x;
+        public float y;
+        public float z;
+
+        public static readonly Vector3 zero = new Vector3();
+    }
+
+    public struct Quaternion
+    {
+        public static readonly Quaternion identity = new Quaternion();
+    }
+
+    public struct Rect : IEquatable<Rect>
+    {
+        public float x;
+        public float y;
+        public float width;
+        public float height;
+
+        public Rect(float x, float y, float width, float height)
+        {
+            this.x = x;
+            this.y = y;
+            this.width = width;
+            this.height = height;
+        }
+
+        public static Rect zero
+        {
+            get { return new Rect(); }
+        }
+
+        public bool Equals(Rect other)
+        {
+            return x == other.x && y == other.y && width == other.width && height == other.height;
+        }
+
+        public override bool Equals(object other)
+        {
+            return other is Rect && Equals((Rect) other);
+        }
+
+        public override int GetHashCode()
+        {
+            return x.GetHashCode() ^ (y.GetHashCode() << 2) ^ (width.GetHashCode() >> 2) ^ (height.GetHashCode() >> 1);
+        }
+
+        public static bool operator ==(Rect lhs, Rect rhs)
+        {
+            return lhs.Equals(rhs);
+        }
+
+        public static bool operator !=(Rect lhs, Rect rhs)
+        {
+            return !lhs.Equals(rhs);
+        }
+
+        public override string ToString()
+        {
+            return "(x:" + x + ", y:" + y + ", width:" + width + ", height:" + height + ")";
+        }
+    }
+
+    public struct Color
+    {
+        public float r;
+        public float g;
+        public float b;
+        public float a;
+
+        public Color(float r, float g, float b, float a = 1f)
+        {
+            this.r = r;
+            this.g = g;
+            this.b = b;
+            this.a = a;
+        }
+
+        public static Color clear
+        {
+            get { return new Color(0, 0, 0, 0); }
+        }
+
+        public static Color black
+        {
+            get { return new Color(0, 0, 0); }
+        }
+
+        public static Color white
+        {
+            get { return new Color(1, 1, 1); }
+        }
+    }
+
+    public static class ColorUtility
+    {
+        public static string ToHtmlStringRGBA(Color color)
+        {
+            return ToHex(color.r) + ToHex(color.g) + ToHex(color.b) + ToHex(color.a);
+        }
+
+        public static bool TryParseHtmlString(string htmlString, out Color color)
+        {
+            color = default(Color);
+            return false;
+        }
+
+        private static string ToHex(float component)
+        {
+            return ((int) Math.Round(Mathf.Clamp01(component) * 255)).ToString("X2");
+        }
+    }
+
+    public static class Mathf
+    {
+        public static float Clamp(float value, float min, float max)
+        {
+            return value < min ? min : value > max ? max : value;
+        }
+
+        public static int Clamp(int value, int min, int max)
+        {
+            return value < min ? min : value > max ? max : value;
+        }
+
+        public static float Clamp01(float value)
+        {
+            return Clamp(value, 0f, 1f);
+        }
+
+        public static float Max(float a, float b)
+        {
+            return Math.Max(a, b);
+        }
+
+        public static int Max(int a, int b)
+        {
+            return Math.Max(a, b);
+        }
+
+        public static int RoundToInt(float value)
+        {
+            return (int) Math.Round(value);
+        }
+    }
+
+    public static class Debug
+    {
+        public static void Log(object message)
+        {
+            LogCapture.Add(LogType.Log, message);
+        }
+
+        public static void LogWarning(object message)
+        {
+            LogCapture.Add(LogType.Warning, message);
+        }
+
+        public static void LogError(object message)
+        {
+            LogCapture.Add(LogType.Error, message);
+        }
+
+        public static void LogException(Exception exception)
+        {
+            LogCapture.Add(LogType.Exception, exception);
+        }
+    }
+
+    public static class Application
+    {
+        public static string unityVersion = "2021.3.0f1";
+        public static bool isEditor;
+        public static bool isPlaying = true;
+        public static RuntimePlatform platform = RuntimePlatform.LinuxPlayer;
+        public static string dataPath = "";
+        public static string persistentDataPath = System.IO.Path.GetTempPath();
+        public static string temporaryCachePath = System.IO.Path.GetTempPath();
+        public static string identifier = "com.applovin.shim";
+    }
+
+    public static class Screen
+    {
+        public static float dpi = 160;
+        public static int width = 1080;
+        public static int height = 1920;
+    }
+
+    public static class Time
+    {
+        public static float realtimeSinceStartup
+        {
+            get { return PlayerLoop.Time; }
+        }
+
+        public static float unscaledTime
+        {
+            get { return PlayerLoop.Time; }
+        }
+
+        public static float deltaTime
+        {
+            get { return PlayerLoop.DeltaTime; }
+        }
+
+        public static int frameCount
+        {
+            get { return PlayerLoop.FrameCount; }
+        }
+    }
+
+    public static class JsonUtility
+    {
+        public static string ToJson(object value)
+        {
+            return "{}";
+        }
+
+        public static T FromJson<T>(string json)
+        {
+            return default(T);
+        }
+    }
+
+    public class CustomYieldInstruction : IEnumerator
+    {
+        public virtual bool keepWaiting
+        {
+            get { return false; }
+        }
+
+        public object Current
+        {
+            get { return null; }
+        }
+
+        public bool MoveNext()
+        {
+            return keepWaiting;
+        }
+
+        public void Reset() { }
+    }
+
+    public class WaitForSecondsRealtime : CustomYieldInstruction
+    {
+        private readonly float _waitUntil;
+
+        public WaitForSecondsRealtime(float time)
+        {
+            _waitUntil = PlayerLoop.Time + time;
+        }
+
+        public override bool keepWaiting
+        {
+            get { return PlayerLoop.Time < _waitUntil; }
+        }
+    }
+
+    public class WaitForSeconds : WaitForSecondsRealtime
+    {
+        public WaitForSeconds(float seconds) : base(seconds) { }
+    }
+
+    public class WaitForEndOfFrame : CustomYieldInstruction { }
+
+    public class AsyncOperation : CustomYieldInstruction
+    {
+        public bool isDone = true;
+        public float progress = 1;
+    }
+
+    public class AndroidJavaObject : IDisposable
+    {
+        public AndroidJavaObject(string className, params object[] args) { }
+
+        public void Call(string methodName, params object[] args) { }
+
+        public T Call<T>(string methodName, params object[] args)
+        {
+            return default(T);
+        }
+
+        public T Get<T>(string fieldName)
+        {
+            return default(T);
+        }
+
+        public T GetStatic<T>(string fieldName)
+        {
+            return default(T);
+        }
+
+        public void Dispose() { }
+    }
+
+    public class AndroidJavaClass : AndroidJavaObject
+    {
+        public AndroidJavaClass(string className) : base(className) { }
+
+        public void CallStatic(string methodName, params object[] args) { }
+
+        public T CallStatic<T>(string methodName, params object[] args)
+        {
+            return default(T);
+        }
+    }
+
+    public class AndroidJavaProxy
+    {
+        public AndroidJavaProxy(string javaInterface) { }
+    }
+}
+
+namespace UnityEngine.Events
+{
+    public class UnityEvent
+    {
+        private readonly List<Action> _listeners = new List<Action>();
+
+        public void AddListener(Action call)
+        {
+            _listeners.Add(call);
+        }
+
+        public void Invoke()
+        {
+            foreach (var listener in _listeners)
+            {
+                listener();
+            }
+        }
+    }
+}
+
+namespace UnityEngine.UI
+{
+    public class Text : Component
+    {
+        public string text = "";
+    }
+
+    public class Image : Component
+    {
+        public Color color;
+    }
+
+    public class Button : Component
+    {
+        public class ButtonClickedEvent : UnityEngine.Events.UnityEvent { }
+
+        public ButtonClickedEvent onClick = new ButtonClickedEvent();
+    }
+}
+
+namespace UnityEngine.EventSystems
+{
+    public class EventSystem : MonoBehaviour
+    {
+        public static EventSystem current;
+    }
+}
+
+namespace UnityEngine.Networking
+{
+    public class DownloadHandler
+    {
+        public string text;
+        public byte[] data;
+    }
+
+    public class DownloadHandlerBuffer : DownloadHandler { }
+
+    public class DownloadHandlerFile : DownloadHandler
+    {
+        public DownloadHandlerFile(string path) { }
+    }
+
+    public class UploadHandler { }
+
+    public class UploadHandlerRaw : UploadHandler
+    {
+        public UploadHandlerRaw(byte[] data) { }
+    }
+
+    public class UnityWebRequestAsyncOperation : AsyncOperation
+    {
+        public UnityWebRequest webRequest;
+    }
+
+    /// <summary>
+    /// Every request fails with a connection error, since the shim has no network stack.
+    /// </summary>
+    public class UnityWebRequest : IDisposable
+    {
+        public enum Result
+        {
+            InProgress,
+            Success,
+            ConnectionError,
+            ProtocolError,
+            DataProcessingError
+        }
+
+        public Result result = Result.ConnectionError;
+        public long responseCode;
+        public string error = "No network in the UnityEngine shim";
+        public DownloadHandler downloadHandler;
+        public UploadHandler uploadHandler;
+        public int timeout;
+        public string method;
+        public string url;
+        public bool isDone = true;
+        public bool isNetworkError = true;
+        public bool isHttpError;
+        public float downloadProgress = 1;
+
+        public UnityWebRequest() { }
+
+        public UnityWebRequest(string url, string method)
+        {
+            this.url = url;
+            this.method = method;
+        }
+
+        public UnityWebRequestAsyncOperation SendWebRequest()
+        {
+            return new UnityWebRequestAsyncOperation {webRequest = this};
+        }
+
+        public void SetRequestHeader(string name, string value) { }
+
+        public void Abort() { }
+
+        public void Dispose() { }
+
+        public static UnityWebRequest Get(string url)
+        {
+            return new UnityWebRequest(url, "GET") {downloadHandler = new DownloadHandlerBuffer()};
+        }
+
+        public static UnityWebRequest Post(string url, string postData)
+        {
+            return new UnityWebRequest(url, "POST") {downloadHandler = new DownloadHandlerBuffer()};
+        }
+    }
+}
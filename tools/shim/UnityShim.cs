@@ -0,0 +1,209 @@
+//
+//  UnityShim.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+//  Drives the behaviours created through the UnityEngine shim, and records what they log.
+//
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Reflection;
+using UnityEngine;
+
+namespace UnityShim
+{
+    /// <summary>
+    /// Stands in for Unity's player loop. The calling thread acts as the main thread: <see cref="Update"/> advances the clock by the given
+    /// number of seconds, then calls <c>Start</c> and <c>Update</c> on every live behaviour and steps their coroutines, like one Unity frame.
+    /// </summary>
+    public static class PlayerLoop
+    {
+        private const BindingFlags MessageBindingFlags = BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic;
+
+        private sealed class Routine
+        {
+            public readonly MonoBehaviour Owner;
+            public readonly Stack<IEnumerator> Frames = new Stack<IEnumerator>();
+            public readonly Coroutine Handle;
+
+            public Routine(MonoBehaviour owner, IEnumerator enumerator, Coroutine handle)
+            {
+                Owner = owner;
+                Frames.Push(enumerator);
+                Handle = handle;
+            }
+        }
+
+        private static readonly List<MonoBehaviour> Behaviours = new List<MonoBehaviour>();
+        private static readonly HashSet<MonoBehaviour> StartedBehaviours = new HashSet<MonoBehaviour>();
+        private static readonly List<Routine> Routines = new List<Routine>();
+        private static readonly ConstructorInfo CoroutineConstructor = typeof(Coroutine).GetConstructor(MessageBindingFlags, null, Type.EmptyTypes, null);
+
+        public static float Time { get; private set; }
+
+        public static float DeltaTime { get; private set; }
+
+        public static int FrameCount { get; private set; }
+
+        /// <summary>
+        /// Runs one frame, after advancing the clock by <paramref name="deltaSeconds"/>.
+        /// </summary>
+        public static void Update(float deltaSeconds = 1 / 60f)
+        {
+            DeltaTime = deltaSeconds;
+            Time += deltaSeconds;
+            FrameCount++;
+
+            foreach (var behaviour in Behaviours.ToArray())
+            {
+                if (!behaviour || !behaviour.enabled) continue;
+
+                if (StartedBehaviours.Add(behaviour))
+                {
+                    SendMessage(behaviour, "Start");
+                }
+
+                SendMessage(behaviour, "Update");
+            }
+
+            foreach (var routine in Routines.ToArray())
+            {
+                Step(routine);
+            }
+        }
+
+        /// <summary>
+        /// Runs frames of <paramref name="deltaSeconds"/> each until <paramref name="seconds"/> have passed.
+        /// </summary>
+        public static void Run(float seconds, float deltaSeconds = 1 / 60f)
+        {
+            var end = Time + seconds;
+            while (Time < end)
+            {
+                Update(deltaSeconds);
+            }
+        }
+
+        internal static void Register(MonoBehaviour behaviour)
+        {
+            Behaviours.Add(behaviour);
+            SendMessage(behaviour, "Awake");
+            SendMessage(behaviour, "OnEnable");
+        }
+
+        internal static void Unregister(MonoBehaviour behaviour)
+        {
+            Behaviours.Remove(behaviour);
+            StartedBehaviours.Remove(behaviour);
+            Routines.RemoveAll(routine => routine.Owner == behaviour);
+        }
+
+        internal static Coroutine StartCoroutine(MonoBehaviour owner, IEnumerator enumerator)
+        {
+            var routine = new Routine(owner, enumerator, (Coroutine) CoroutineConstructor.Invoke(null));
+            Routines.Add(routine);
+
+            // Like Unity, run the coroutine up to its first yield right away
+            Step(routine);
+            return routine.Handle;
+        }
+
+        internal static void StopCoroutine(Coroutine handle)
+        {
+            Routines.RemoveAll(routine => routine.Handle == handle);
+        }
+
+        private static void Step(Routine routine)
+        {
+            while (routine.Frames.Count > 0)
+            {
+                var frame = routine.Frames.Peek();
+                var waiting = frame.Current as IEnumerator;
+                if (waiting != null && waiting.MoveNext()) return;
+
+                if (!frame.MoveNext())
+                {
+                    routine.Frames.Pop();
+                    continue;
+                }
+
+                var nested = frame.Current as IEnumerator;
+                if (nested != null && !(nested is CustomYieldInstruction))
+                {
+                    routine.Frames.Push(nested);
+                    continue;
+                }
+
+                return;
+            }
+
+            Routines.Remove(routine);
+        }
+
+        private static void SendMessage(MonoBehaviour behaviour, string methodName)
+        {
+            var method = behaviour.GetType().GetMethod(methodName, MessageBindingFlags, null, Type.EmptyTypes, null);
+            if (method == null) return;
+
+            try
+            {
+                method.Invoke(behaviour, null);
+            }
+            catch (TargetInvocationException exception)
+            {
+                UnityEngine.Debug.LogException(exception.InnerException);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Everything written through <see cref="UnityEngine.Debug"/>, in order. Messages are also echoed to the console when <see cref="Echo"/> is set.
+    /// </summary>
+    public static class LogCapture
+    {
+        public struct Entry
+        {
+            public LogType Type;
+            public string Message;
+            public Exception Exception;
+        }
+
+        private static readonly List<Entry> Entries = new List<Entry>();
+
+        public static bool Echo { get; set; }
+
+        public static Entry[] Snapshot()
+        {
+            lock (Entries)
+            {
+                return Entries.ToArray();
+            }
+        }
+
+        public static void Clear()
+        {
+            lock (Entries)
+            {
+                Entries.Clear();
+            }
+        }
+
+        internal static void Add(LogType type, object message)
+        {
+            var exception = message as Exception;
+            var entry = new Entry {Type = type, Message = exception != null ? exception.Message : Convert.ToString(message), Exception = exception};
+            lock (Entries)
+            {
+                Entries.Add(entry);
+            }
+
+            if (Echo)
+            {
+                Console.WriteLine("[" + type + "] " + entry.Message);
+            }
+        }
+    }
+}
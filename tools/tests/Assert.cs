@@ -0,0 +1,43 @@
+//
+//  Assert.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+
+namespace AppLovinMax.Tests
+{
+    public class AssertionException : Exception
+    {
+        public AssertionException(string message) : base(message) { }
+    }
+
+    internal static class Assert
+    {
+        internal static void True(bool condition, string message)
+        {
+            if (!condition) throw new AssertionException(message);
+        }
+
+        internal static void False(bool condition, string message)
+        {
+            True(!condition, message);
+        }
+
+        internal static void Equal<T>(T expected, T actual, string message)
+        {
+            if (!EqualityComparer<T>.Default.Equals(expected, actual))
+            {
+                throw new AssertionException(message + ": expected <" + expected + "> but was <" + actual + ">");
+            }
+        }
+
+        internal static void Fail(string message)
+        {
+            throw new AssertionException(message);
+        }
+    }
+}
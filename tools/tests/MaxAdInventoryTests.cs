@@ -0,0 +1,251 @@
+//
+//  MaxAdInventoryTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.Collections.Generic;
+using System.Reflection;
+using System.Threading;
+using AppLovinMax.Scripts;
+using AppLovinMax.ThirdParty.MiniJson;
+using UnityShim;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Drives <see cref="MaxAdInventory"/> end to end against the <c>MaxSdkUnityEditor</c> stub, which finishes every load one second after it starts.
+    /// Ad events the stub only sends from its editor UI, such as hidden events, are forwarded the way the native plugins would send them.
+    ///
+    /// The inventory is a singleton, so each test uses its own placements and first lets the loads of earlier tests finish.
+    /// </summary>
+    public static class MaxAdInventoryTests
+    {
+        private const float StubLoadSeconds = 1.1f;
+
+        [Test]
+        public static void LoadsPlacementUpToTargetAndReplacesShownAds()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.AddPlacement("refill", MaxAdInventory.AdFormat.Interstitial, 2, MaxAdInventory.Priority.Normal, "refill_0", "refill_1", "refill_2");
+
+            PlayerLoop.Update();
+            var stats = inventory.GetStats("refill");
+            Assert.Equal(2, stats.LoadCount, "Loads started");
+            Assert.Equal(0, stats.ReadyCount, "Ads ready before the loads finish");
+            Assert.False(inventory.IsReady("refill"), "Ready before the loads finish");
+
+            PlayerLoop.Run(StubLoadSeconds);
+            stats = inventory.GetStats("refill");
+            Assert.Equal(2, stats.LoadCount, "Loads started once the target is reached");
+            Assert.Equal(2, stats.ReadyCount, "Ads ready");
+            Assert.Equal(2, stats.ReadyAdCount, "Ads that became ready");
+            Assert.True(inventory.IsReady("refill"), "Ready once loaded");
+
+            Assert.True(inventory.TryShow("refill"), "Shows a ready ad");
+            PlayerLoop.Run(StubLoadSeconds);
+            stats = inventory.GetStats("refill");
+            Assert.Equal(1, stats.ShowHitCount, "Show hits");
+            Assert.Equal(1, stats.ReadyCount, "Ads ready while one is showing");
+            Assert.Equal(2, stats.LoadCount, "An ad that is showing counts towards the target");
+
+            ForwardEvent("OnInterstitialHiddenEvent", "refill_0");
+            PlayerLoop.Run(StubLoadSeconds);
+            stats = inventory.GetStats("refill");
+            Assert.Equal(3, stats.LoadCount, "Loads started after the shown ad was hidden");
+            Assert.Equal(2, stats.ReadyCount, "Ads ready after the shown ad was replaced");
+            Assert.Equal(3, stats.ReadyAdCount, "Ads that became ready");
+        }
+
+        [Test]
+        public static void ShowWithoutReadyAdCountsMiss()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.AddPlacement("miss", MaxAdInventory.AdFormat.Interstitial, 1, MaxAdInventory.Priority.Normal, "miss_0");
+
+            Assert.False(inventory.TryShow("miss"), "Shows before the placement has loaded");
+            Assert.False(inventory.TryShow("missing"), "Shows a placement that was not added");
+
+            var stats = inventory.GetStats("miss");
+            Assert.Equal(0, stats.ShowHitCount, "Show hits");
+            Assert.Equal(1, stats.ShowMissCount, "Show misses");
+            Assert.Equal(0.0, stats.ShowHitRate, "Show hit rate");
+            Assert.True(inventory.GetStats("missing") == null, "Stats of a placement that was not added");
+        }
+
+        [Test]
+        public static void HigherPriorityPlacementLoadsFirst()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.MaxConcurrentLoads = 1;
+            try
+            {
+                inventory.AddPlacement("priority_low", MaxAdInventory.AdFormat.Rewarded, 1, MaxAdInventory.Priority.Low, "priority_low_0");
+                inventory.AddPlacement("priority_high", MaxAdInventory.AdFormat.Rewarded, 1, MaxAdInventory.Priority.High, "priority_high_0");
+
+                PlayerLoop.Update();
+                Assert.Equal(1, inventory.GetStats("priority_high").LoadCount, "High priority loads started");
+                Assert.Equal(0, inventory.GetStats("priority_low").LoadCount, "Low priority loads started while the high priority one is loading");
+
+                PlayerLoop.Run(StubLoadSeconds);
+                Assert.True(inventory.IsReady("priority_high"), "High priority placement ready");
+                Assert.Equal(1, inventory.GetStats("priority_low").LoadCount, "Low priority loads started once the high priority one is ready");
+
+                PlayerLoop.Run(StubLoadSeconds);
+                Assert.True(inventory.IsReady("priority_low"), "Low priority placement ready");
+            }
+            finally
+            {
+                inventory.MaxConcurrentLoads = 2;
+            }
+        }
+
+        [Test]
+        public static void DeferredLoadsStartOnResume()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.DeferLoads();
+            inventory.DeferLoads();
+            try
+            {
+                inventory.AddPlacement("deferred", MaxAdInventory.AdFormat.AppOpen, 1, MaxAdInventory.Priority.Normal, "deferred_0");
+
+                PlayerLoop.Run(0.5f);
+                Assert.Equal(0, inventory.GetStats("deferred").LoadCount, "Loads started while deferred");
+
+                inventory.ResumeLoads();
+                PlayerLoop.Update();
+                Assert.True(inventory.IsDeferringLoads, "Deferred until resumed as many times as deferred");
+                Assert.Equal(0, inventory.GetStats("deferred").LoadCount, "Loads started while still deferred");
+            }
+            finally
+            {
+                inventory.ResumeLoads();
+            }
+
+            PlayerLoop.Update();
+            Assert.Equal(1, inventory.GetStats("deferred").LoadCount, "Loads started once resumed");
+        }
+
+        [Test]
+        public static void FailedLoadWaitsToRetry()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.AddPlacement("failing", MaxAdInventory.AdFormat.Interstitial, 1, MaxAdInventory.Priority.Normal, "failing_0");
+
+            PlayerLoop.Update();
+            ForwardEvent("OnInterstitialLoadFailedEvent", "failing_0", new Dictionary<string, string> {{"errorCode", "-1"}, {"errorMessage", "No fill"}});
+            PlayerLoop.Run(0.5f);
+
+            var stats = inventory.GetStats("failing");
+            Assert.Equal(1, stats.LoadFailureCount, "Load failures");
+            Assert.Equal(1, stats.LoadCount, "Loads started before the retry is due");
+            Assert.False(inventory.IsReady("failing"), "Ready after the load failed");
+        }
+
+        /// <summary>
+        /// An ad the SDK no longer has, e.g. one that expired without being reloaded, must not keep counting towards the placement's target.
+        /// </summary>
+        [Test]
+        public static void AdNoLongerReadyInSdkIsReloaded()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.AddPlacement("stale", MaxAdInventory.AdFormat.Interstitial, 1, MaxAdInventory.Priority.Normal, "stale_0");
+            PlayerLoop.Run(StubLoadSeconds);
+            Assert.True(inventory.IsReady("stale"), "Ready once loaded");
+
+            typeof(MaxSdkUnityEditor).GetMethod("RemoveReadyAdUnit", BindingFlags.Static | BindingFlags.NonPublic).Invoke(null, new object[] {"stale_0"});
+
+            Assert.False(inventory.TryShow("stale"), "Shows an ad the SDK no longer has");
+            var stats = inventory.GetStats("stale");
+            Assert.Equal(0, stats.ReadyCount, "Ads ready after the SDK reported the ad as not ready");
+            Assert.Equal(1, stats.ShowMissCount, "Show misses");
+
+            PlayerLoop.Update();
+            Assert.Equal(2, inventory.GetStats("stale").LoadCount, "Loads started after the SDK reported the ad as not ready");
+
+            PlayerLoop.Run(StubLoadSeconds);
+            Assert.True(inventory.IsReady("stale"), "Ready once reloaded");
+        }
+
+        /// <summary>
+        /// With <see cref="MaxSdkBase.InvokeEventsOnUnityMainThread"/> disabled, ad events reach the inventory on the thread that forwards them.
+        /// Shows on the main thread must neither deadlock with them nor lose count.
+        /// </summary>
+        [Test]
+        public static void BackgroundEventsDuringShows()
+        {
+            Settle();
+            var inventory = MaxAdInventory.Instance;
+            inventory.AddPlacement("background", MaxAdInventory.AdFormat.Interstitial, 1, MaxAdInventory.Priority.Normal, "background_0");
+            PlayerLoop.Run(StubLoadSeconds);
+            Assert.True(inventory.IsReady("background"), "Ready before the events start");
+
+            // Show the ad loaded before the events start first, since the event thread may hide it before the loop gets to it
+            Assert.True(inventory.TryShow("background"), "The ad loaded before the events started was shown");
+
+            const int showCount = 20000;
+            var invokeEventsOnUnityMainThread = MaxSdkBase.InvokeEventsOnUnityMainThread;
+            MaxSdkBase.InvokeEventsOnUnityMainThread = false;
+            try
+            {
+                var isShowing = 1;
+                var eventThread = new Thread(() =>
+                {
+                    while (Volatile.Read(ref isShowing) == 1)
+                    {
+                        ForwardEvent("OnInterstitialLoadedEvent", "background_0");
+                        ForwardEvent("OnInterstitialHiddenEvent", "background_0");
+                    }
+                });
+                eventThread.Start();
+
+                for (var i = 0; i < showCount; i++)
+                {
+                    inventory.IsReady("background");
+                    inventory.TryShow("background");
+                }
+
+                Volatile.Write(ref isShowing, 0);
+                Assert.True(eventThread.Join(5000), "Event thread finished");
+            }
+            finally
+            {
+                MaxSdkBase.InvokeEventsOnUnityMainThread = invokeEventsOnUnityMainThread;
+            }
+
+            var stats = inventory.GetStats("background");
+            Assert.Equal(showCount + 1, stats.ShowHitCount + stats.ShowMissCount, "Shows counted");
+        }
+
+        /// <summary>
+        /// Initializes the SDK and lets loads started by earlier tests finish, so they do not count against <see cref="MaxAdInventory.MaxConcurrentLoads"/>.
+        /// </summary>
+        private static void Settle()
+        {
+            MaxSdk.InitializeSdk();
+            PlayerLoop.Run(3 * StubLoadSeconds);
+        }
+
+        private static void ForwardEvent(string eventName, string adUnitIdentifier, Dictionary<string, string> extraProperties = null)
+        {
+            var eventProperties = new Dictionary<string, string> {{"name", eventName}, {"adUnitId", adUnitIdentifier}, {"placement", ""}};
+            if (extraProperties != null)
+            {
+                foreach (var property in extraProperties)
+                {
+                    eventProperties[property.Key] = property.Value;
+                }
+            }
+
+            MaxSdkCallbacks.ForwardEvent(Json.Serialize(eventProperties));
+        }
+    }
+}
@@ -0,0 +1,185 @@
+//
+//  MaxCallbackPayloadTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.IO;
+using System.Runtime.CompilerServices;
+using AppLovinMax.Internal;
+using UnityEngine;
+using UnityShim;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// The lifetime of the payloads passed to ad event callbacks: struct parameters queued for the main thread without boxing, and pooled
+    /// <see cref="MaxSdkBase.AdInfo"/> objects that are recycled once their callback returns unless the listener retained them.
+    ///
+    /// Binary events are read from the <c>small</c> fixture of tools/bench, an interstitial loaded event.
+    /// </summary>
+    public static class MaxCallbackPayloadTests
+    {
+        private const string AdUnitIdentifier = "4a5b6c7d8e9f0a1b";
+        private const int EventsPerFrame = 8;
+
+        [Test]
+        public static void RewardAndLayoutArriveOnMainThread()
+        {
+            MaxEventExecutor.InitializeIfNeeded();
+
+            var reward = default(MaxSdkBase.Reward);
+            var rect = default(Rect);
+            var isPaused = false;
+            MaxEventExecutor.ExecuteOnMainThread<string, MaxSdkBase.Reward, MaxSdkBase.AdInfo>((adUnitIdentifier, value, adInfo) => reward = value,
+                AdUnitIdentifier, new MaxSdkBase.Reward {Label = "coins", Amount = 25}, null, "OnRewardedAdReceivedRewardEvent");
+            MaxEventExecutor.ExecuteOnMainThread<string, Rect>((adUnitIdentifier, value) => rect = value, AdUnitIdentifier, new Rect(1, 2, 320, 50), "OnBannerAdLayoutChangedEvent");
+            MaxEventExecutor.ExecuteOnMainThread<bool>(value => isPaused = value, true, "OnApplicationStateChanged");
+
+            PlayerLoop.Update();
+
+            Assert.Equal("coins", reward.Label, "Reward label");
+            Assert.Equal(25, reward.Amount, "Reward amount");
+            Assert.Equal(new Rect(1, 2, 320, 50), rect, "Layout");
+            Assert.True(isPaused, "Application state");
+        }
+
+        [Test]
+        public static void QueueingRewardAndLayoutDoesNotAllocate()
+        {
+            MaxEventExecutor.InitializeIfNeeded();
+
+            Action<string, MaxSdkBase.Reward, MaxSdkBase.AdInfo> onReward = (adUnitIdentifier, reward, adInfo) => { };
+            Action<string, Rect> onLayout = (adUnitIdentifier, rect) => { };
+            var adInfo = new MaxSdkBase.AdInfo();
+            var reward = new MaxSdkBase.Reward {Label = "coins", Amount = 25};
+            var rect = new Rect(1, 2, 320, 50);
+
+            long allocatedBytes = 0;
+            for (var frame = 0; frame < 4; frame++)
+            {
+                // The first frame warms up the generic instantiations
+                var allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+                for (var i = 0; i < EventsPerFrame / 2; i++)
+                {
+                    MaxEventExecutor.ExecuteOnMainThread(onReward, AdUnitIdentifier, reward, adInfo, "OnRewardedAdReceivedRewardEvent");
+                    MaxEventExecutor.ExecuteOnMainThread(onLayout, AdUnitIdentifier, rect, "OnBannerAdLayoutChangedEvent");
+                }
+
+                if (frame > 0)
+                {
+                    allocatedBytes += GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+                }
+
+                PlayerLoop.Update();
+            }
+
+            Assert.Equal(0L, allocatedBytes, "Bytes allocated queueing reward and layout events");
+        }
+
+        [Test]
+        public static void RecycledPayloadIsReused()
+        {
+            var adInfos = ForwardTwice(false, false);
+
+            Assert.True(ReferenceEquals(adInfos[0], adInfos[1]), "Second event reuses the recycled AdInfo");
+        }
+
+        [Test]
+        public static void RetainedPayloadSurvivesRecycling()
+        {
+            var adInfos = ForwardTwice(true, false);
+
+            Assert.False(ReferenceEquals(adInfos[0], adInfos[1]), "Second event gets another AdInfo");
+            Assert.Equal(AdUnitIdentifier, adInfos[0].AdUnitIdentifier, "Ad unit identifier of the retained AdInfo");
+            Assert.Equal("AppLovin", adInfos[0].NetworkName, "Network name of the retained AdInfo");
+            Assert.True(adInfos[0].WaterfallInfo.NetworkResponses.Count > 0, "Waterfall of the retained AdInfo");
+        }
+
+        [Test]
+        public static void RecycledPayloadIsPoisoned()
+        {
+            var adInfos = ForwardTwice(false, true);
+
+            Assert.False(ReferenceEquals(adInfos[0], adInfos[1]), "Poisoned AdInfo is not reused");
+            Assert.Equal(MaxCallbackPayloadPool.PoisonedString, adInfos[0].AdUnitIdentifier, "Ad unit identifier of the recycled AdInfo");
+            Assert.Equal(MaxCallbackPayloadPool.PoisonedString, adInfos[0].NetworkName, "Network name of the recycled AdInfo");
+            Assert.True(double.IsNaN(adInfos[0].Revenue), "Revenue of the recycled AdInfo");
+        }
+
+        [Test]
+        public static void QueuedPayloadIsRecycledAfterDispatch()
+        {
+            var binary = LoadFixture();
+            MaxSdkBase.AdInfo dispatchedAdInfo = null;
+            Action<string, MaxSdkBase.AdInfo> onAdLoaded = (adUnitIdentifier, adInfo) => dispatchedAdInfo = adInfo;
+
+            MaxEventExecutor.InitializeIfNeeded();
+            MaxSdkBase.InvokeEventsOnUnityMainThread = true;
+            MaxSdkBase.PooledCallbackPayloadsEnabled = true;
+            MaxSdkBase.PoisonRecycledCallbackPayloads = true;
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += onAdLoaded;
+            try
+            {
+                MaxSdkCallbacks.ForwardEvent(binary, 0, binary.Length);
+                PlayerLoop.Update();
+
+                // The callback read the values while the queue still owned the payload, and it was poisoned once the callback returned
+                Assert.True(dispatchedAdInfo != null, "Event dispatched");
+                Assert.Equal(MaxCallbackPayloadPool.PoisonedString, dispatchedAdInfo.AdUnitIdentifier, "Ad unit identifier after dispatch");
+            }
+            finally
+            {
+                MaxSdkCallbacks.Interstitial.OnAdLoadedEvent -= onAdLoaded;
+                ResetSettings();
+            }
+        }
+
+        /// <summary>
+        /// Forwards the fixture twice to an interstitial loaded listener on the calling thread, with pooling enabled. Returns the AdInfo of each event.
+        /// </summary>
+        private static MaxSdkBase.AdInfo[] ForwardTwice(bool retainFirst, bool poisonRecycled)
+        {
+            var binary = LoadFixture();
+            var adInfos = new MaxSdkBase.AdInfo[2];
+            var eventCount = 0;
+            Action<string, MaxSdkBase.AdInfo> onAdLoaded = (adUnitIdentifier, adInfo) =>
+            {
+                adInfos[eventCount] = eventCount == 0 && retainFirst ? adInfo.Retain() : adInfo;
+                eventCount++;
+            };
+
+            MaxSdkBase.InvokeEventsOnUnityMainThread = false;
+            MaxSdkBase.PooledCallbackPayloadsEnabled = true;
+            MaxSdkBase.PoisonRecycledCallbackPayloads = poisonRecycled;
+            MaxSdkCallbacks.Interstitial.OnAdLoadedEvent += onAdLoaded;
+            try
+            {
+                MaxSdkCallbacks.ForwardEvent(binary, 0, binary.Length);
+                MaxSdkCallbacks.ForwardEvent(binary, 0, binary.Length);
+            }
+            finally
+            {
+                MaxSdkCallbacks.Interstitial.OnAdLoadedEvent -= onAdLoaded;
+                ResetSettings();
+            }
+
+            Assert.Equal(2, eventCount, "Events forwarded");
+            return adInfos;
+        }
+
+        private static void ResetSettings()
+        {
+            MaxSdkBase.InvokeEventsOnUnityMainThread = null;
+            MaxSdkBase.PooledCallbackPayloadsEnabled = false;
+            MaxSdkBase.PoisonRecycledCallbackPayloads = false;
+        }
+
+        private static byte[] LoadFixture([CallerFilePath] string sourceFilePath = "")
+        {
+            return File.ReadAllBytes(Path.Combine(Path.GetDirectoryName(sourceFilePath), "..", "bench", "fixtures", "small.bin"));
+        }
+    }
+}
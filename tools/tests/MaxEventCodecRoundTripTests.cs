@@ -0,0 +1,201 @@
+//
+//  MaxEventCodecRoundTripTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using AppLovinMax.Internal;
+using AppLovinMax.ThirdParty.MiniJson;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Decodes the frames written by <c>native/event_codec_roundtrip.c</c>, one per event id holding every field id, so the event and field tables
+    /// duplicated in MAUnityEventCodec.c and <see cref="MaxEventCodec"/> are checked against each other.
+    ///
+    /// Values are derived from the event and field ids. NOTE: Must be kept in sync with event_codec_roundtrip.c
+    /// </summary>
+    public static class MaxEventCodecRoundTripTests
+    {
+        // NOTE: Must be kept in sync with `roundtrip_write_nested_credentials` in event_codec_roundtrip.c
+        private const string NestedCredentialsJson = "{\"nested\": {\"id\": 7, \"list\": [\"x\", 2.5, {\"enabled\": true}]}}";
+
+        private sealed class NativeTables
+        {
+            public readonly Dictionary<int, string> EventNames = new Dictionary<int, string>();
+            public readonly Dictionary<int, string> FieldKeys = new Dictionary<int, string>();
+            public readonly Dictionary<int, byte> FieldTypes = new Dictionary<int, byte>();
+        }
+
+        [Test]
+        public static void EventNamesMatchNativeTable()
+        {
+            var nativeTables = LoadNativeTables();
+
+            Assert.Equal(nativeTables.EventNames.Count + 1, MaxEventCodec.EventNames.Length, "Number of event ids");
+            foreach (var entry in nativeTables.EventNames)
+            {
+                Assert.Equal(entry.Value, MaxEventCodec.EventNames[entry.Key], "Name of event " + entry.Key);
+                Assert.Equal(entry.Key, MaxEventCodec.EventIdForName(entry.Value), "Id of event " + entry.Value);
+            }
+        }
+
+        [Test]
+        public static void FieldKeysMatchNativeTable()
+        {
+            var nativeTables = LoadNativeTables();
+
+            var managedFieldIds = typeof(MaxEventCodec).GetFields(BindingFlags.Static | BindingFlags.NonPublic)
+                .Where(field => field.IsLiteral && field.Name.StartsWith("Field", StringComparison.Ordinal) && field.Name != "FieldNone")
+                .Select(field => (int) (byte) field.GetRawConstantValue())
+                .OrderBy(fieldId => fieldId)
+                .ToList();
+            Assert.Equal(string.Join(",", nativeTables.FieldKeys.Keys.OrderBy(fieldId => fieldId)), string.Join(",", managedFieldIds), "Field ids");
+
+            foreach (var entry in nativeTables.FieldKeys)
+            {
+                Assert.Equal(entry.Key, (int) MaxEventCodec.FieldForKey(entry.Value, 0, entry.Value.Length), "Id of field " + entry.Value);
+            }
+        }
+
+        [Test]
+        public static void NativeFramesDecodeInManagedCode()
+        {
+            var nativeTables = LoadNativeTables();
+            var bytes = File.ReadAllBytes(GetNativeOutputPath("event_codec_roundtrip.bin"));
+
+            var offset = 0;
+            var eventId = 1;
+            while (offset < bytes.Length)
+            {
+                var frameLength = MaxEventCodec.GetFrameLength(bytes, offset, bytes.Length - offset);
+                Assert.True(frameLength > 0, "Frame " + eventId + " has a valid length");
+
+                string eventName;
+                bool keepInBackground;
+                MaxEventReader reader;
+                Assert.True(MaxEventCodec.TryOpen(bytes, offset, frameLength, out eventName, out keepInBackground, out reader), "Frame " + eventId + " opens");
+                Assert.Equal(nativeTables.EventNames[eventId], eventName, "Event name of frame " + eventId);
+                Assert.Equal(eventId % 2 == 1, keepInBackground, "Keep in background flag of " + eventName);
+
+                var expectedFieldId = 1;
+                while (reader.MoveNext())
+                {
+                    Assert.Equal(expectedFieldId, (int) reader.FieldId, "Field order of " + eventName);
+                    Assert.Equal(nativeTables.FieldTypes[expectedFieldId], reader.ValueType, "Value type of " + nativeTables.FieldKeys[expectedFieldId]);
+                    CheckValue(reader, eventId, nativeTables.FieldKeys[expectedFieldId]);
+                    expectedFieldId++;
+                }
+
+                Assert.Equal(nativeTables.FieldKeys.Count + 1, expectedFieldId, "Fields decoded from " + eventName);
+
+                offset += frameLength;
+                eventId++;
+            }
+
+            Assert.Equal(nativeTables.EventNames.Count + 1, eventId, "Frames decoded");
+        }
+
+        private static void CheckValue(MaxEventReader reader, int eventId, string key)
+        {
+            int fieldId = reader.FieldId;
+            switch (reader.ValueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                    Assert.Equal(key + ":" + eventId, reader.ReadString(), key);
+                    break;
+                case MaxEventCodec.ValueTypeDouble:
+                    Assert.Equal(eventId + fieldId / 64.0, reader.ReadDouble(), key);
+                    break;
+                case MaxEventCodec.ValueTypeInt64:
+                    var value = ((long) eventId << 40) + fieldId;
+                    Assert.Equal(fieldId % 2 == 1 ? -value : value, reader.ReadLong(), key);
+                    break;
+                case MaxEventCodec.ValueTypeBool:
+                    Assert.Equal((eventId + fieldId) % 2 == 1, reader.ReadBool(), key);
+                    break;
+                case MaxEventCodec.ValueTypeObject:
+                    Assert.Equal(key, ReadNames(reader.ReadContainer()), key);
+                    break;
+                case MaxEventCodec.ValueTypeList:
+                    var items = reader.ReadContainer();
+                    var names = new List<string>();
+                    while (items.MoveNext())
+                    {
+                        Assert.Equal(MaxEventCodec.ValueTypeObject, items.ValueType, key + " item type");
+                        names.Add(ReadNames(items.ReadContainer()));
+                    }
+
+                    Assert.Equal("item0,item1", string.Join(",", names), key);
+                    break;
+                case MaxEventCodec.ValueTypeMap:
+                    var map = reader.ReadMap();
+                    var isCredentials = fieldId == MaxEventCodec.FieldCredentials;
+                    Assert.Equal(isCredentials ? 3 : 2, map.Count, key + " entries");
+                    Assert.Equal(key, map["key"] as string, key + "[key]");
+                    Assert.Equal(eventId.ToString(CultureInfo.InvariantCulture), map["eventId"] as string, key + "[eventId]");
+                    if (isCredentials)
+                    {
+                        // Nested credentials must decode to the same dictionaries and lists MiniJSON makes of the JSON payload
+                        var expected = (Dictionary<string, object>) Json.Deserialize(NestedCredentialsJson);
+                        Assert.Equal(Json.Serialize(expected["nested"]), Json.Serialize(map["nested"]), key + "[nested]");
+                        Assert.True(map["nested"] is Dictionary<string, object>, key + "[nested] is a dictionary");
+                        Assert.True(((Dictionary<string, object>) map["nested"])["list"] is List<object>, key + "[nested][list] is a list");
+                    }
+
+                    break;
+                default:
+                    Assert.Fail("Unexpected value type " + reader.ValueType + " for " + key);
+                    break;
+            }
+        }
+
+        private static string ReadNames(MaxEventReader reader)
+        {
+            var names = new List<string>();
+            while (reader.MoveNext())
+            {
+                Assert.Equal(MaxEventCodec.FieldName, reader.FieldId, "Nested field id");
+                names.Add(reader.ReadString());
+            }
+
+            return string.Join(",", names);
+        }
+
+        private static NativeTables LoadNativeTables()
+        {
+            var nativeTables = new NativeTables();
+            foreach (var line in File.ReadAllLines(GetNativeOutputPath("event_codec_roundtrip.txt")))
+            {
+                var parts = line.Split(' ');
+                var id = int.Parse(parts[1], CultureInfo.InvariantCulture);
+                if (parts[0] == "event")
+                {
+                    nativeTables.EventNames[id] = parts[2];
+                }
+                else
+                {
+                    nativeTables.FieldKeys[id] = parts[2];
+                    nativeTables.FieldTypes[id] = byte.Parse(parts[3], CultureInfo.InvariantCulture);
+                }
+            }
+
+            return nativeTables;
+        }
+
+        private static string GetNativeOutputPath(string fileName)
+        {
+            var path = Path.Combine(NativeOutput.Directory, fileName);
+            if (!File.Exists(path)) Assert.Fail(path + " does not exist, run `make -C tools/tests/native` first");
+
+            return path;
+        }
+    }
+}
@@ -0,0 +1,160 @@
+//
+//  MaxEventQueueStressTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Reflection;
+using System.Threading;
+using AppLovinMax.Internal;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Several producer threads enqueue numbered events into a <see cref="MaxEventQueue"/> small enough to keep spilling into its overflow list,
+    /// while one consumer thread drains it. Every event must be dequeued exactly once, in the order its producer enqueued it.
+    /// </summary>
+    public static class MaxEventQueueStressTests
+    {
+        private const int EventsPerProducer = 200000;
+
+        [Test]
+        public static void ProducersKeepOrderAcrossOverflow()
+        {
+            Run(Math.Max(4, Environment.ProcessorCount), 16);
+        }
+
+        [Test]
+        public static void SingleProducerKeepsOrderAcrossOverflow()
+        {
+            Run(1, 4);
+        }
+
+        /// <summary>
+        /// A producer that has claimed the head slot but not published it yet holds back the events behind it in the ring. Another producer's events
+        /// that spilled over meanwhile must not be dequeued ahead of its own earlier events in the ring.
+        /// </summary>
+        [Test]
+        public static void UnpublishedSlotHoldsBackOverflow()
+        {
+            var queue = new MaxEventQueue(4);
+            var enqueuePosition = typeof(MaxEventQueue).GetField("_enqueuePosition", BindingFlags.Instance | BindingFlags.NonPublic);
+
+            // Claim slot 0 the way a preempted producer would, without publishing it
+            enqueuePosition.SetValue(queue, 1L);
+
+            for (var sequence = 0; sequence < 4; sequence++)
+            {
+                var queuedEvent = new MaxQueuedEvent {Param1 = 1, Param2 = sequence};
+                queue.Enqueue(ref queuedEvent);
+            }
+
+            var events = new MaxQueuedEvent[4];
+            Assert.Equal(0, queue.DrainTo(ref events, 0), "Events dequeued while the head slot is unpublished");
+
+            PublishSlot(queue, 0, new MaxQueuedEvent {Param1 = 0, Param2 = 0});
+
+            var count = queue.DrainTo(ref events, 0);
+            Assert.Equal(5, count, "Events dequeued once the head slot is published");
+            Assert.Equal(0, (int) events[0].Param1, "Producer of the head slot");
+            for (var i = 1; i < count; i++)
+            {
+                Assert.Equal(i - 1, (int) events[i].Param2, "Event " + i);
+            }
+        }
+
+        private static void PublishSlot(MaxEventQueue queue, int index, MaxQueuedEvent queuedEvent)
+        {
+            var slots = (Array) typeof(MaxEventQueue).GetField("_slots", BindingFlags.Instance | BindingFlags.NonPublic).GetValue(queue);
+            var slot = slots.GetValue(index);
+            var slotType = slot.GetType();
+            slotType.GetField("Event").SetValue(slot, queuedEvent);
+            slotType.GetField("Sequence").SetValue(slot, (long) index + 1);
+            slots.SetValue(slot, index);
+        }
+
+        private static void Run(int producerCount, int capacity)
+        {
+            var queue = new MaxEventQueue(capacity);
+            var start = new Barrier(producerCount + 1);
+            var runningProducers = producerCount;
+
+            // Box the producer and sequence numbers up front so producers only contend on the queue
+            var producerIds = new object[producerCount];
+            var sequences = new object[EventsPerProducer];
+            for (var i = 0; i < producerCount; i++)
+            {
+                producerIds[i] = i;
+            }
+
+            for (var i = 0; i < EventsPerProducer; i++)
+            {
+                sequences[i] = i;
+            }
+
+            var producers = new Thread[producerCount];
+            for (var i = 0; i < producerCount; i++)
+            {
+                var producerId = producerIds[i];
+                producers[i] = new Thread(() =>
+                {
+                    start.SignalAndWait();
+                    for (var sequence = 0; sequence < EventsPerProducer; sequence++)
+                    {
+                        var queuedEvent = new MaxQueuedEvent {Param1 = producerId, Param2 = sequences[sequence]};
+                        queue.Enqueue(ref queuedEvent);
+                    }
+
+                    Interlocked.Decrement(ref runningProducers);
+                });
+                producers[i].Start();
+            }
+
+            var nextSequences = new int[producerCount];
+            var events = new MaxQueuedEvent[capacity];
+            var overflowedDrains = 0;
+            start.SignalAndWait();
+
+            while (true)
+            {
+                // Read before draining, so the last drain happens after every producer has finished
+                var isDone = Volatile.Read(ref runningProducers) == 0;
+
+                var count = queue.DrainTo(ref events, 0);
+                if (count > capacity)
+                {
+                    overflowedDrains++;
+                }
+
+                for (var i = 0; i < count; i++)
+                {
+                    var producerId = (int) events[i].Param1;
+                    var sequence = (int) events[i].Param2;
+                    if (sequence != nextSequences[producerId])
+                    {
+                        Assert.Fail("Producer " + producerId + " expected event " + nextSequences[producerId] + " but got " + sequence);
+                    }
+
+                    nextSequences[producerId]++;
+                }
+
+                if (isDone && count == 0) break;
+            }
+
+            foreach (var producer in producers)
+            {
+                producer.Join();
+            }
+
+            for (var i = 0; i < producerCount; i++)
+            {
+                Assert.Equal(EventsPerProducer, nextSequences[i], "Events dequeued from producer " + i);
+            }
+
+            Assert.True(queue.IsEmpty, "Queue is empty once drained");
+            Assert.True(overflowedDrains > 0, "Events spilled into the overflow list");
+        }
+    }
+}
@@ -0,0 +1,316 @@
+//
+//  MaxJsonReaderConformanceTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using AppLovinMax.Internal;
+using AppLovinMax.ThirdParty.MiniJson;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Checks that <see cref="MaxJsonReader"/> reads the same values as MiniJSON, which it replaced on the callback path, and that it rejects
+    /// malformed and truncated documents instead of throwing.
+    /// </summary>
+    public static class MaxJsonReaderConformanceTests
+    {
+        private static readonly string[] Corpus =
+        {
+            @"{}",
+            @" { } ",
+            "\t{\r\n\"a\" :\n1 ,\t\"b\"\r:[ ]\n}\r\n",
+            @"{""empty"":"""",""object"":{},""list"":[],""null"":null,""true"":true,""false"":false}",
+            @"{""escapes"":""quote \"" backslash \\ slash \/ b \b f \f n \n r \r t \t""}",
+            @"{""unicode"":""Aé中\u0000￿"",""pair"":""😀"",""lone"":""\udc00 \ud800""}",
+            "{\"raw\":\"café 中文 😀\",\"kéy\":\"v\"}",
+            @"{""escaped \""name\"""":1,""escaped"":2}",
+            @"{""int"":0,""negative"":-42,""max"":9223372036854775807,""min"":-9223372036854775808,""eighteen"":123456789012345678}",
+            @"{""fraction"":0.5,""negative"":-0.25,""zero"":0.0,""negativeZero"":-0.0,""long"":123456789.125,""precise"":0.1}",
+            @"{""exponent"":1.5e3,""upper"":2.5E-2,""signed"":-1.25e+2,""small"":1.0e-30,""large"":1.7976931348623157e308,""digits"":3.14159265358979323846}",
+            @"{""revenue"":0.000123456789012345,""cpm"":12.3456789012345678}",
+            @"{""a"":{""b"":{""c"":[1,[2,[3,{""d"":""}]""}]]]},""e"":""{[""},""f"":[{},[],""]"",{""g"":null}],""h"":""after""}",
+            @"{""adUnitId"":""abc"",""waterfallInfo"":{""name"":""default"",""networkResponses"":[{""adLoadState"":1,""mediatedNetwork"":{""name"":""AppLovin""},""credentials"":{""placement_id"":""x""},""latencyMillis"":123,""error"":{""errorCode"":-1}}]},""revenue"":1.5e-3,""keepInBackground"":true}",
+        };
+
+        private static readonly string[] InvalidDocuments =
+        {
+            "",
+            " ",
+            "[]",
+            "\"a\"",
+            "1",
+            "{",
+            "}",
+            "{} {}",
+            "{},",
+            @"{""a""}",
+            @"{""a"":}",
+            @"{""a"" 1}",
+            @"{""a"":1,}",
+            @"{,""a"":1}",
+            @"{""a"":1 ""b"":2}",
+            @"{'a':1}",
+            @"{a:1}",
+            @"{""a"":[1,]}",
+            @"{""a"":[1 2]}",
+            @"{""a"":[}",
+            @"{""a"":]}",
+            @"{""a"":01}",
+            @"{""a"":-}",
+            @"{""a"":+1}",
+            @"{""a"":1.}",
+            @"{""a"":.5}",
+            @"{""a"":1e}",
+            @"{""a"":1e+}",
+            @"{""a"":0x10}",
+            @"{""a"":NaN}",
+            @"{""a"":tru}",
+            @"{""a"":True}",
+            @"{""a"":nul}",
+            @"{""a"":""\x""}",
+            @"{""a"":""\u12G4""}",
+            @"{""a"":""\u12""}",
+            "{\"a\":\"raw\ncontrol\"}",
+            "{\"a\":\"raw\u0001control\"}",
+            @"{""a"":""unterminated}",
+            "{\"a\":1}\u0000",
+        };
+
+        [Test]
+        public static void CorpusMatchesMiniJson()
+        {
+            foreach (var json in Corpus)
+            {
+                MaxJsonReader reader;
+                Assert.True(MaxJsonReader.TryOpen(json, out reader), "Opens " + json);
+                AssertTreesEqual(Json.Deserialize(json), ReadObject(reader), json);
+            }
+        }
+
+        [Test]
+        public static void ReadMapMatchesMiniJson()
+        {
+            foreach (var json in Corpus)
+            {
+                var expected = (Dictionary<string, object>) Json.Deserialize(json);
+
+                MaxJsonReader reader;
+                Assert.True(MaxJsonReader.TryOpen(json, out reader), "Opens " + json);
+                while (reader.MoveNext())
+                {
+                    if (reader.ValueType != MaxEventCodec.ValueTypeObject) continue;
+
+                    var name = reader.ReadName();
+                    AssertTreesEqual(expected[name], reader.ReadMap(), json + " " + name);
+                }
+            }
+        }
+
+        /// <summary>
+        /// MiniJSON parses numbers without a '.' as a long, so an exponent on an integer mantissa yields 0. The reader follows the JSON spec.
+        /// </summary>
+        [Test]
+        public static void ExponentsWithoutFractionAreDoubles()
+        {
+            var json = @"{""a"":1e3,""b"":-2E-2,""c"":7e+1,""d"":5e-324,""e"":1E400}";
+            var expected = new Dictionary<string, object>
+            {
+                {"a", 1000.0},
+                {"b", -0.02},
+                {"c", 70.0},
+                {"d", double.Epsilon},
+                {"e", double.PositiveInfinity},
+            };
+
+            MaxJsonReader reader;
+            Assert.True(MaxJsonReader.TryOpen(json, out reader), "Opens " + json);
+            AssertTreesEqual(expected, ReadObject(reader), json);
+        }
+
+        [Test]
+        public static void SkippedContainersDoNotHideLaterProperties()
+        {
+            var json = Corpus.First(document => document.Contains("\"after\""));
+
+            MaxJsonReader reader;
+            Assert.True(MaxJsonReader.TryOpen(json, out reader), "Opens " + json);
+
+            var names = new List<string>();
+            string after = null;
+            while (reader.MoveNext())
+            {
+                names.Add(reader.ReadName());
+                if (reader.NameEquals("h"))
+                {
+                    after = reader.ReadString();
+                }
+            }
+
+            Assert.Equal("a,f,h", string.Join(",", names), "Property names");
+            Assert.Equal("after", after, "Value after the skipped containers");
+        }
+
+        [Test]
+        public static void EscapedNamesCompareDecoded()
+        {
+            MaxJsonReader reader;
+            Assert.True(MaxJsonReader.TryOpen(@"{""a\/b"":1}", out reader), "Opens document");
+            Assert.True(reader.MoveNext(), "Reads the property");
+            Assert.True(reader.NameEquals("a/b"), "Escaped name equals its decoded form");
+            Assert.False(reader.NameEquals("\\u0061\\/b"), "Escaped name does not equal its raw form");
+            Assert.Equal("a/b", reader.ReadName(), "Decoded name");
+        }
+
+        [Test]
+        public static void RangeMatchesStandaloneDocument()
+        {
+            foreach (var json in Corpus)
+            {
+                var embedded = "{\"x\":[" + json + "\n" + json + "]}";
+                var start = embedded.IndexOf(json, StringComparison.Ordinal);
+
+                MaxJsonReader reader;
+                Assert.True(MaxJsonReader.TryOpen(embedded, start, json.Length, out reader), "Opens the range of " + json);
+                AssertTreesEqual(Json.Deserialize(json), ReadObject(reader), json);
+            }
+        }
+
+        [Test]
+        public static void TruncatedDocumentsAreRejected()
+        {
+            foreach (var json in Corpus)
+            {
+                // Only trailing whitespace may be cut off a valid document
+                var documentLength = json.TrimEnd().Length;
+
+                // Truncate both the string and a range over a longer string, so the bounds are checked instead of the end of the string
+                var embedded = json + json;
+                for (var length = 0; length < documentLength; length++)
+                {
+                    MaxJsonReader reader;
+                    Assert.False(MaxJsonReader.TryOpen(json.Substring(0, length), out reader), "Rejects prefix " + json.Substring(0, length));
+                    Assert.False(MaxJsonReader.TryOpen(embedded, 0, length, out reader), "Rejects range prefix " + json.Substring(0, length));
+                    Assert.False(MaxJsonReader.TryOpen(embedded, json.Length, length, out reader), "Rejects range prefix " + json.Substring(0, length));
+                }
+            }
+        }
+
+        [Test]
+        public static void InvalidDocumentsAreRejected()
+        {
+            MaxJsonReader reader;
+            Assert.False(MaxJsonReader.TryOpen(null, out reader), "Rejects null");
+            foreach (var json in InvalidDocuments)
+            {
+                Assert.False(MaxJsonReader.TryOpen(json, out reader), "Rejects " + json);
+            }
+        }
+
+        [Test]
+        public static void NestingDepthIsBounded()
+        {
+            MaxJsonReader reader;
+            Assert.True(MaxJsonReader.TryOpen(Nest(63), out reader), "Accepts 64 levels of nesting");
+            Assert.False(MaxJsonReader.TryOpen(Nest(64), out reader), "Rejects 65 levels of nesting");
+        }
+
+        private static string Nest(int depth)
+        {
+            return "{\"a\":" + new string('[', depth) + new string(']', depth) + "}";
+        }
+
+        #region Helpers
+
+        private static Dictionary<string, object> ReadObject(MaxJsonReader reader)
+        {
+            var map = new Dictionary<string, object>();
+            while (reader.MoveNext())
+            {
+                map[reader.ReadName()] = ReadValue(reader);
+            }
+
+            return map;
+        }
+
+        private static object ReadValue(MaxJsonReader reader)
+        {
+            switch (reader.ValueType)
+            {
+                case MaxEventCodec.ValueTypeString:
+                    return reader.ReadString();
+                case MaxEventCodec.ValueTypeDouble:
+                    return reader.ReadDouble();
+                case MaxEventCodec.ValueTypeInt64:
+                    return reader.ReadLong();
+                case MaxEventCodec.ValueTypeBool:
+                    return reader.ReadBool();
+                case MaxEventCodec.ValueTypeObject:
+                    return ReadObject(reader.ReadContainer());
+                case MaxEventCodec.ValueTypeList:
+                    var list = new List<object>();
+                    var items = reader.ReadContainer();
+                    while (items.MoveNext())
+                    {
+                        list.Add(ReadValue(items));
+                    }
+
+                    return list;
+                default:
+                    return null;
+            }
+        }
+
+        private static void AssertTreesEqual(object expected, object actual, string path)
+        {
+            if (expected == null || actual == null)
+            {
+                Assert.True(expected == null && actual == null, path + ": expected <" + Describe(expected) + "> but was <" + Describe(actual) + ">");
+                return;
+            }
+
+            Assert.Equal(expected.GetType(), actual.GetType(), path + " type");
+
+            var expectedMap = expected as IDictionary<string, object>;
+            if (expectedMap != null)
+            {
+                var actualMap = (IDictionary<string, object>) actual;
+                Assert.Equal(string.Join(",", expectedMap.Keys), string.Join(",", actualMap.Keys), path + " keys");
+                foreach (var entry in expectedMap)
+                {
+                    AssertTreesEqual(entry.Value, actualMap[entry.Key], path + "." + entry.Key);
+                }
+
+                return;
+            }
+
+            var expectedList = expected as IList;
+            if (expectedList != null)
+            {
+                var actualList = (IList) actual;
+                Assert.Equal(expectedList.Count, actualList.Count, path + " count");
+                for (var i = 0; i < expectedList.Count; i++)
+                {
+                    AssertTreesEqual(expectedList[i], actualList[i], path + "[" + i + "]");
+                }
+
+                return;
+            }
+
+            Assert.Equal(expected, actual, path);
+        }
+
+        private static string Describe(object value)
+        {
+            return value == null ? "null" : Convert.ToString(value, CultureInfo.InvariantCulture);
+        }
+
+        #endregion
+    }
+}
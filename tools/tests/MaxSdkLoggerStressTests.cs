@@ -0,0 +1,159 @@
+//
+//  MaxSdkLoggerStressTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Linq;
+using System.Threading;
+using UnityEngine;
+using UnityShim;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Several threads log numbered warnings, errors and exceptions through <see cref="MaxSdkLogger"/> faster than the <c>MaxLogWriter</c> thread writes them out.
+    /// The writer drops messages instead of blocking once its ring is full, so every message must either be written, in the order its thread logged it,
+    /// or be counted in one of the writer's "Dropped N log messages" reports.
+    /// </summary>
+    public static class MaxSdkLoggerStressTests
+    {
+        private const int MessagesPerThread = 50000;
+        private const string WarningPrefix = "Warning [" + MaxSdkLogger.SdkTag + "] ";
+        private const string ErrorPrefix = "Error [" + MaxSdkLogger.SdkTag + "] ";
+        private const string DroppedPrefix = WarningPrefix + "Dropped ";
+
+        [Test]
+        public static void ThreadsKeepOrderAndReportDrops()
+        {
+            var threadCount = Math.Max(4, Environment.ProcessorCount);
+
+            // Let the writer catch up and report drops from earlier tests before counting
+            WaitForMarker("stress start");
+            LogCapture.Clear();
+
+            var start = new Barrier(threadCount);
+            var threads = new Thread[threadCount];
+            for (var i = 0; i < threadCount; i++)
+            {
+                var threadIndex = i;
+                threads[i] = new Thread(() =>
+                {
+                    start.SignalAndWait();
+                    for (var sequence = 0; sequence < MessagesPerThread; sequence++)
+                    {
+                        var message = "stress thread=" + threadIndex + " sequence=" + sequence;
+                        switch (sequence % 3)
+                        {
+                            case 0:
+                                MaxSdkLogger.UserWarning(message);
+                                break;
+                            case 1:
+                                MaxSdkLogger.UserError(message);
+                                break;
+                            default:
+                                MaxSdkLogger.LogException(new InvalidOperationException(message));
+                                break;
+                        }
+                    }
+                });
+                threads[i].Start();
+            }
+
+            foreach (var thread in threads)
+            {
+                thread.Join();
+            }
+
+            // The writer reports drops after draining, so one more message makes it report the drops of the final burst
+            var flushCount = WaitForMarker("stress flush");
+
+            var nextSequences = new int[threadCount];
+            var writtenCount = 0;
+            Assert.True(WaitFor(() =>
+            {
+                var entries = LogCapture.Snapshot();
+                writtenCount = entries.Count(entry => entry.Message.Contains("stress thread="));
+                var writtenFlushCount = entries.Count(entry => entry.Message == WarningPrefix + "stress flush");
+                return writtenCount + writtenFlushCount + CountReportedDrops(entries) == threadCount * MessagesPerThread + flushCount;
+            }), "Every message was written or reported as dropped");
+
+            foreach (var entry in LogCapture.Snapshot())
+            {
+                var index = entry.Message.IndexOf("stress thread=", StringComparison.Ordinal);
+                if (index < 0) continue;
+
+                var fields = entry.Message.Substring(index + "stress thread=".Length).Split(new[] {" sequence="}, StringSplitOptions.None);
+                var threadIndex = int.Parse(fields[0]);
+                var sequence = int.Parse(fields[1]);
+                if (sequence < nextSequences[threadIndex])
+                {
+                    Assert.Fail("Thread " + threadIndex + " expected a message after " + (nextSequences[threadIndex] - 1) + " but got " + sequence);
+                }
+
+                nextSequences[threadIndex] = sequence + 1;
+                switch (sequence % 3)
+                {
+                    case 0:
+                        Assert.True(entry.Type == LogType.Warning && entry.Message.StartsWith(WarningPrefix, StringComparison.Ordinal), "Warning " + entry.Message);
+                        break;
+                    case 1:
+                        Assert.True(entry.Type == LogType.Error && entry.Message.StartsWith(ErrorPrefix, StringComparison.Ordinal), "Error " + entry.Message);
+                        break;
+                    default:
+                        Assert.True(entry.Type == LogType.Exception && entry.Exception is InvalidOperationException, "Exception " + entry.Message);
+                        break;
+                }
+            }
+
+            Assert.True(writtenCount > 0, "Messages were written");
+        }
+
+        /// <summary>
+        /// Logs the marker until it is written, since it is dropped while the ring is full. Returns how many times it was logged.
+        /// </summary>
+        private static int WaitForMarker(string marker)
+        {
+            var markerCount = 0;
+            var isWritten = false;
+            for (var attempt = 0; attempt < 100 && !isWritten; attempt++)
+            {
+                MaxSdkLogger.UserWarning(marker);
+                markerCount++;
+                isWritten = WaitFor(() => LogCapture.Snapshot().Any(entry => entry.Message == WarningPrefix + marker), 100);
+            }
+
+            Assert.True(isWritten, "Marker " + marker + " written");
+            return markerCount;
+        }
+
+        private static long CountReportedDrops(LogCapture.Entry[] entries)
+        {
+            long droppedCount = 0;
+            foreach (var entry in entries)
+            {
+                if (entry.Message.StartsWith(DroppedPrefix, StringComparison.Ordinal))
+                {
+                    droppedCount += long.Parse(entry.Message.Substring(DroppedPrefix.Length).Split(' ')[0]);
+                }
+            }
+
+            return droppedCount;
+        }
+
+        private static bool WaitFor(Func<bool> condition, int timeoutMilliseconds = 10000)
+        {
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            while (stopwatch.ElapsedMilliseconds < timeoutMilliseconds)
+            {
+                if (condition()) return true;
+
+                Thread.Sleep(10);
+            }
+
+            return condition();
+        }
+    }
+}
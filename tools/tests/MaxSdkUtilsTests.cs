@@ -0,0 +1,103 @@
+//
+//  MaxSdkUtilsTests.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System.Collections.Generic;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// The <c>MaxSdkUtils.Get*FromDictionary</c> getters read boxed numbers directly instead of parsing them. They must return what parsing the
+    /// number's invariant string returns, including the default value for NaN, fractions and values out of range.
+    /// </summary>
+    public static class MaxSdkUtilsTests
+    {
+        private const int DefaultInt = -7;
+        private const long DefaultLong = -7L;
+
+        [Test]
+        public static void IntFromBoxedNumbers()
+        {
+            CheckInt(42, 42L);
+            CheckInt(-42, -42L);
+            CheckInt(int.MaxValue, (long) int.MaxValue);
+            CheckInt(int.MinValue, (long) int.MinValue);
+            CheckInt(DefaultInt, (long) int.MaxValue + 1);
+            CheckInt(DefaultInt, (long) int.MinValue - 1);
+            CheckInt(DefaultInt, long.MaxValue);
+
+            CheckInt(42, 42.0);
+            CheckInt(-42, -42.0);
+            CheckInt(0, -0.0);
+            CheckInt(int.MaxValue, (double) int.MaxValue);
+            CheckInt(int.MinValue, (double) int.MinValue);
+            CheckInt(DefaultInt, 1.5);
+            CheckInt(DefaultInt, -1.5);
+            CheckInt(DefaultInt, (double) int.MaxValue + 1);
+            CheckInt(DefaultInt, (double) int.MinValue - 1);
+            CheckInt(DefaultInt, 1e20);
+            CheckInt(DefaultInt, double.NaN);
+            CheckInt(DefaultInt, double.PositiveInfinity);
+            CheckInt(DefaultInt, double.NegativeInfinity);
+
+            CheckInt(42, 42);
+            CheckInt(42, "42");
+            CheckInt(DefaultInt, "forty-two");
+        }
+
+        [Test]
+        public static void LongFromBoxedNumbers()
+        {
+            CheckLong(long.MaxValue, long.MaxValue);
+            CheckLong(long.MinValue, long.MinValue);
+
+            CheckLong(42L, 42.0);
+            CheckLong(-42L, -42.0);
+            CheckLong(1L << 53, (double) (1L << 53));
+            CheckLong(DefaultLong, 1.5);
+            CheckLong(DefaultLong, 9223372036854775808.0);
+            CheckLong(DefaultLong, 1e20);
+            CheckLong(DefaultLong, -1e20);
+            CheckLong(DefaultLong, double.NaN);
+            CheckLong(DefaultLong, double.PositiveInfinity);
+
+            CheckLong(42L, 42);
+            CheckLong(42L, "42");
+            CheckLong(DefaultLong, "forty-two");
+        }
+
+        [Test]
+        public static void MissingValuesReturnDefault()
+        {
+            var dictionary = new Dictionary<string, object> {{"null", null}};
+
+            Assert.Equal(DefaultInt, MaxSdkUtils.GetIntFromDictionary(null, "value", DefaultInt), "Int from a null dictionary");
+            Assert.Equal(DefaultInt, MaxSdkUtils.GetIntFromDictionary(dictionary, "missing", DefaultInt), "Missing int");
+            Assert.Equal(DefaultInt, MaxSdkUtils.GetIntFromDictionary(dictionary, "null", DefaultInt), "Null int");
+            Assert.Equal(DefaultLong, MaxSdkUtils.GetLongFromDictionary(dictionary, "missing", DefaultLong), "Missing long");
+            Assert.Equal(DefaultLong, MaxSdkUtils.GetLongFromDictionary(dictionary, "null", DefaultLong), "Null long");
+        }
+
+        private static void CheckInt(int expected, object value)
+        {
+            var name = value.GetType().Name + " " + MaxSdkUtils.InvariantCultureToString(value);
+            Assert.Equal(expected, MaxSdkUtils.GetIntFromDictionary(new Dictionary<string, object> {{"value", value}}, "value", DefaultInt), "Int from " + name);
+
+            // The string path is the parsing the boxed paths replaced
+            var stringValue = MaxSdkUtils.InvariantCultureToString(value);
+            Assert.Equal(expected, MaxSdkUtils.GetIntFromDictionary(new Dictionary<string, object> {{"value", stringValue}}, "value", DefaultInt), "Int parsed from " + name);
+        }
+
+        private static void CheckLong(long expected, object value)
+        {
+            var name = value.GetType().Name + " " + MaxSdkUtils.InvariantCultureToString(value);
+            Assert.Equal(expected, MaxSdkUtils.GetLongFromDictionary(new Dictionary<string, object> {{"value", value}}, "value", DefaultLong), "Long from " + name);
+
+            var stringValue = MaxSdkUtils.InvariantCultureToString(value);
+            Assert.Equal(expected, MaxSdkUtils.GetLongFromDictionary(new Dictionary<string, object> {{"value", stringValue}}, "value", DefaultLong), "Long parsed from " + name);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  Program.cs
+//  Max Unity Plugin
+//
+//  Copyright © 2024 AppLovin. All rights reserved.
+//
+
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+
+namespace AppLovinMax.Tests
+{
+    /// <summary>
+    /// Marks a public static method as a test. A test fails by throwing.
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Method)]
+    public class TestAttribute : Attribute { }
+
+    /// <summary>
+    /// Where the native tests in <c>native/</c> write the data the C# tests decode.
+    /// </summary>
+    internal static class NativeOutput
+    {
+        internal static string Directory
+        {
+            get { return GetDirectory(); }
+        }
+
+        private static string GetDirectory([CallerFilePath] string sourceFilePath = "")
+        {
+            return Path.Combine(Path.GetDirectoryName(sourceFilePath), "native", "build");
+        }
+    }
+
+    /// <summary>
+    /// Runs every <see cref="TestAttribute"/> method, or only those whose <c>Class.Method</c> name contains one of the arguments.
+    /// Tests run one at a time on the calling thread, which stands in for the Unity main thread. Returns the number of failed tests.
+    /// </summary>
+    public static class Program
+    {
+        public static int Main(string[] args)
+        {
+            var tests = typeof(Program).Assembly.GetTypes()
+                .Where(type => type.Namespace == typeof(Program).Namespace)
+                .SelectMany(type => type.GetMethods(BindingFlags.Public | BindingFlags.Static))
+                .Where(method => method.GetCustomAttribute<TestAttribute>() != null)
+                .Select(method => new {Method = method, Name = method.DeclaringType.Name + "." + method.Name})
+                .Where(test => args.Length == 0 || args.Any(filter => test.Name.Contains(filter)))
+                .OrderBy(test => test.Name, StringComparer.Ordinal)
+                .ToList();
+
+            var failedCount = 0;
+            foreach (var test in tests)
+            {
+                var stopwatch = Stopwatch.StartNew();
+                try
+                {
+                    test.Method.Invoke(null, null);
+                    Console.WriteLine("PASS " + test.Name + " (" + stopwatch.ElapsedMilliseconds + " ms)");
+                }
+                catch (TargetInvocationException exception)
+                {
+                    failedCount++;
+                    Console.WriteLine("FAIL " + test.Name);
+                    Console.WriteLine("     " + exception.InnerException);
+                }
+            }
+
+            Console.WriteLine(tests.Count - failedCount + "/" + tests.Count + " tests passed");
+            return failedCount;
+        }
+    }
+}
@@ -0,0 +1,452 @@
+//
+//  ad_view_layout_test.c
+//  AppLovin MAX Unity Plugin
+//
+//  Table tests for `max_unity_ad_view_compute_geometry`: every position for banners, leaders and MRECs, once as configured by default and once
+//  with each option that affects the layout. The expected geometries follow the constraints `positionAdViewForAdUnitIdentifier:adFormat:` built
+//  in MAUnityAdManager.m before the layout was moved to C.
+//
+//  Usage: ad_view_layout_test
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "MAUnityAdViewLayout.h"
+
+#define CHECK(condition, ...)                                    \
+    do                                                           \
+    {                                                            \
+        if ( !(condition) )                                      \
+        {                                                        \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);      \
+            fprintf(stderr, __VA_ARGS__);                        \
+            fprintf(stderr, "\n");                               \
+            exit(1);                                             \
+        }                                                        \
+    } while ( 0 )
+
+#define WINDOW_WIDTH 390.0
+#define WINDOW_HEIGHT 844.0
+#define WIDTH_OVERRIDE 256.0
+#define OFFSET_X 12.0
+#define OFFSET_Y 34.0
+
+// Shorthands for the table below
+#define TOP_LEFT MAX_UNITY_AD_VIEW_POSITION_TOP_LEFT
+#define TOP_CENTER MAX_UNITY_AD_VIEW_POSITION_TOP_CENTER
+#define TOP_RIGHT MAX_UNITY_AD_VIEW_POSITION_TOP_RIGHT
+#define CENTERED MAX_UNITY_AD_VIEW_POSITION_CENTERED
+#define CENTER_LEFT MAX_UNITY_AD_VIEW_POSITION_CENTER_LEFT
+#define CENTER_RIGHT MAX_UNITY_AD_VIEW_POSITION_CENTER_RIGHT
+#define BOTTOM_LEFT MAX_UNITY_AD_VIEW_POSITION_BOTTOM_LEFT
+#define BOTTOM_CENTER MAX_UNITY_AD_VIEW_POSITION_BOTTOM_CENTER
+#define BOTTOM_RIGHT MAX_UNITY_AD_VIEW_POSITION_BOTTOM_RIGHT
+#define ABOVE MAX_UNITY_SAFE_AREA_BACKGROUND_ABOVE
+#define BELOW MAX_UNITY_SAFE_AREA_BACKGROUND_BELOW
+#define LEFT MAX_UNITY_SAFE_AREA_BACKGROUND_LEFT
+#define RIGHT MAX_UNITY_SAFE_AREA_BACKGROUND_RIGHT
+#define FLEXIBLE_TOP MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_TOP_MARGIN
+#define FLEXIBLE_BOTTOM MAX_UNITY_AUTORESIZING_FLEXIBLE_WIDTH_BOTTOM_MARGIN
+
+typedef enum
+{
+    BANNER,
+    LEADER,
+    MREC
+} ad_format;
+
+typedef enum
+{
+    DEFAULT,
+    BACKGROUND_COLOR,
+    WIDTH_OVERRIDDEN,
+    ADAPTIVE_DISABLED,
+    IGNORES_SAFE_AREA
+} layout_variant;
+
+static const char *const format_names[] = {"banner", "leader", "mrec"};
+static const char *const variant_names[] = {"default", "background color", "width override", "adaptive disabled", "ignores safe area"};
+
+typedef struct
+{
+    max_unity_ad_view_position position;
+    ad_format format;
+    layout_variant variant;
+    max_unity_ad_view_geometry expected; // `position` is filled in from the row
+} layout_case;
+
+// Distinct from every format height, so the table shows which height was used
+static double adaptive_height_for_width(double width, void *context)
+{
+    (void) context;
+    return width / 4.0;
+}
+
+static const layout_case layout_cases[] = {
+    {TOP_LEFT, BANNER, DEFAULT, {.width = 320, .height = 80, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, BANNER, BACKGROUND_COLOR, {.width = 320, .height = 80, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80, .offset_x = OFFSET_X, .offset_y = OFFSET_Y, .uses_superview_top = true}},
+    {TOP_LEFT, LEADER, DEFAULT, {.width = 728, .height = 182, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, LEADER, BACKGROUND_COLOR, {.width = 728, .height = 182, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182, .offset_x = OFFSET_X, .offset_y = OFFSET_Y, .uses_superview_top = true}},
+    {TOP_LEFT, MREC, DEFAULT, {.width = 300, .height = 250, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250, .offset_x = OFFSET_X, .offset_y = OFFSET_Y}},
+    {TOP_LEFT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250, .offset_x = OFFSET_X, .offset_y = OFFSET_Y, .uses_superview_top = true}},
+
+    {TOP_CENTER, BANNER, DEFAULT, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, BANNER, BACKGROUND_COLOR, {.height = 97.5, .spans_superview_width = true, .safe_area_background = ABOVE, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, BANNER, ADAPTIVE_DISABLED, {.width = 390, .height = 50}},
+    {TOP_CENTER, BANNER, IGNORES_SAFE_AREA, {.width = 390, .height = 97.5, .uses_superview_top = true, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, LEADER, DEFAULT, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, LEADER, BACKGROUND_COLOR, {.height = 97.5, .spans_superview_width = true, .safe_area_background = ABOVE, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, LEADER, ADAPTIVE_DISABLED, {.width = 390, .height = 90}},
+    {TOP_CENTER, LEADER, IGNORES_SAFE_AREA, {.width = 390, .height = 97.5, .uses_superview_top = true, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, MREC, DEFAULT, {.width = 390, .height = 250, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, MREC, BACKGROUND_COLOR, {.width = 390, .height = 250, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250, .autoresizing = FLEXIBLE_BOTTOM}},
+    {TOP_CENTER, MREC, ADAPTIVE_DISABLED, {.width = 390, .height = 250}},
+    {TOP_CENTER, MREC, IGNORES_SAFE_AREA, {.width = 390, .height = 250, .uses_superview_top = true, .autoresizing = FLEXIBLE_BOTTOM}},
+
+    {TOP_RIGHT, BANNER, DEFAULT, {.width = 320, .height = 80}},
+    {TOP_RIGHT, BANNER, BACKGROUND_COLOR, {.width = 320, .height = 80}},
+    {TOP_RIGHT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {TOP_RIGHT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50}},
+    {TOP_RIGHT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80, .uses_superview_top = true}},
+    {TOP_RIGHT, LEADER, DEFAULT, {.width = 728, .height = 182}},
+    {TOP_RIGHT, LEADER, BACKGROUND_COLOR, {.width = 728, .height = 182}},
+    {TOP_RIGHT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {TOP_RIGHT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90}},
+    {TOP_RIGHT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182, .uses_superview_top = true}},
+    {TOP_RIGHT, MREC, DEFAULT, {.width = 300, .height = 250}},
+    {TOP_RIGHT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250}},
+    {TOP_RIGHT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250}},
+    {TOP_RIGHT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250}},
+    {TOP_RIGHT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250, .uses_superview_top = true}},
+
+    {CENTERED, BANNER, DEFAULT, {.width = 320, .height = 80}},
+    {CENTERED, BANNER, BACKGROUND_COLOR, {.width = 320, .height = 80}},
+    {CENTERED, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {CENTERED, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50}},
+    {CENTERED, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80}},
+    {CENTERED, LEADER, DEFAULT, {.width = 728, .height = 182}},
+    {CENTERED, LEADER, BACKGROUND_COLOR, {.width = 728, .height = 182}},
+    {CENTERED, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {CENTERED, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90}},
+    {CENTERED, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182}},
+    {CENTERED, MREC, DEFAULT, {.width = 300, .height = 250}},
+    {CENTERED, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250}},
+    {CENTERED, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250}},
+    {CENTERED, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250}},
+    {CENTERED, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250}},
+
+    {CENTER_LEFT, BANNER, DEFAULT, {.width = 320, .height = 80, .is_rotated = true, .center_x_offset = 40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, BANNER, BACKGROUND_COLOR, {.width = 844, .height = 80, .is_rotated = true, .center_x_offset = 40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .is_rotated = true, .center_x_offset = 32, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50, .is_rotated = true, .center_x_offset = 25}},
+    {CENTER_LEFT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80, .is_rotated = true, .center_x_offset = 40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, LEADER, DEFAULT, {.width = 728, .height = 182, .is_rotated = true, .center_x_offset = 91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, LEADER, BACKGROUND_COLOR, {.width = 844, .height = 182, .is_rotated = true, .center_x_offset = 91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .is_rotated = true, .center_x_offset = 32, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90, .is_rotated = true, .center_x_offset = 45}},
+    {CENTER_LEFT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182, .is_rotated = true, .center_x_offset = 91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_LEFT, MREC, DEFAULT, {.width = 300, .height = 250, .safe_area_background = LEFT}},
+    {CENTER_LEFT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250, .safe_area_background = LEFT}},
+    {CENTER_LEFT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250, .safe_area_background = LEFT}},
+    {CENTER_LEFT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250, .safe_area_background = LEFT}},
+    {CENTER_LEFT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250, .safe_area_background = LEFT}},
+
+    {CENTER_RIGHT, BANNER, DEFAULT, {.width = 320, .height = 80, .is_rotated = true, .center_x_offset = -40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, BANNER, BACKGROUND_COLOR, {.width = 844, .height = 80, .is_rotated = true, .center_x_offset = -40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .is_rotated = true, .center_x_offset = -32, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50, .is_rotated = true, .center_x_offset = -25}},
+    {CENTER_RIGHT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80, .is_rotated = true, .center_x_offset = -40, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, LEADER, DEFAULT, {.width = 728, .height = 182, .is_rotated = true, .center_x_offset = -91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, LEADER, BACKGROUND_COLOR, {.width = 844, .height = 182, .is_rotated = true, .center_x_offset = -91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .is_rotated = true, .center_x_offset = -32, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90, .is_rotated = true, .center_x_offset = -45}},
+    {CENTER_RIGHT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182, .is_rotated = true, .center_x_offset = -91, .autoresizing = FLEXIBLE_TOP}},
+    {CENTER_RIGHT, MREC, DEFAULT, {.width = 300, .height = 250, .safe_area_background = RIGHT}},
+    {CENTER_RIGHT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250, .safe_area_background = RIGHT}},
+    {CENTER_RIGHT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250, .safe_area_background = RIGHT}},
+    {CENTER_RIGHT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250, .safe_area_background = RIGHT}},
+    {CENTER_RIGHT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250, .safe_area_background = RIGHT}},
+
+    {BOTTOM_LEFT, BANNER, DEFAULT, {.width = 320, .height = 80}},
+    {BOTTOM_LEFT, BANNER, BACKGROUND_COLOR, {.width = 320, .height = 80}},
+    {BOTTOM_LEFT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {BOTTOM_LEFT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50}},
+    {BOTTOM_LEFT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80}},
+    {BOTTOM_LEFT, LEADER, DEFAULT, {.width = 728, .height = 182}},
+    {BOTTOM_LEFT, LEADER, BACKGROUND_COLOR, {.width = 728, .height = 182}},
+    {BOTTOM_LEFT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {BOTTOM_LEFT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90}},
+    {BOTTOM_LEFT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182}},
+    {BOTTOM_LEFT, MREC, DEFAULT, {.width = 300, .height = 250}},
+    {BOTTOM_LEFT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250}},
+    {BOTTOM_LEFT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250}},
+    {BOTTOM_LEFT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250}},
+    {BOTTOM_LEFT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250}},
+
+    {BOTTOM_CENTER, BANNER, DEFAULT, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, BANNER, BACKGROUND_COLOR, {.height = 97.5, .spans_superview_width = true, .safe_area_background = BELOW, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, BANNER, ADAPTIVE_DISABLED, {.width = 390, .height = 50}},
+    {BOTTOM_CENTER, BANNER, IGNORES_SAFE_AREA, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, LEADER, DEFAULT, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, LEADER, BACKGROUND_COLOR, {.height = 97.5, .spans_superview_width = true, .safe_area_background = BELOW, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, LEADER, ADAPTIVE_DISABLED, {.width = 390, .height = 90}},
+    {BOTTOM_CENTER, LEADER, IGNORES_SAFE_AREA, {.width = 390, .height = 97.5, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, MREC, DEFAULT, {.width = 390, .height = 250, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, MREC, BACKGROUND_COLOR, {.width = 390, .height = 250, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250, .autoresizing = FLEXIBLE_TOP}},
+    {BOTTOM_CENTER, MREC, ADAPTIVE_DISABLED, {.width = 390, .height = 250}},
+    {BOTTOM_CENTER, MREC, IGNORES_SAFE_AREA, {.width = 390, .height = 250, .autoresizing = FLEXIBLE_TOP}},
+
+    {BOTTOM_RIGHT, BANNER, DEFAULT, {.width = 320, .height = 80}},
+    {BOTTOM_RIGHT, BANNER, BACKGROUND_COLOR, {.width = 320, .height = 80}},
+    {BOTTOM_RIGHT, BANNER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {BOTTOM_RIGHT, BANNER, ADAPTIVE_DISABLED, {.width = 320, .height = 50}},
+    {BOTTOM_RIGHT, BANNER, IGNORES_SAFE_AREA, {.width = 320, .height = 80}},
+    {BOTTOM_RIGHT, LEADER, DEFAULT, {.width = 728, .height = 182}},
+    {BOTTOM_RIGHT, LEADER, BACKGROUND_COLOR, {.width = 728, .height = 182}},
+    {BOTTOM_RIGHT, LEADER, WIDTH_OVERRIDDEN, {.width = 256, .height = 64}},
+    {BOTTOM_RIGHT, LEADER, ADAPTIVE_DISABLED, {.width = 728, .height = 90}},
+    {BOTTOM_RIGHT, LEADER, IGNORES_SAFE_AREA, {.width = 728, .height = 182}},
+    {BOTTOM_RIGHT, MREC, DEFAULT, {.width = 300, .height = 250}},
+    {BOTTOM_RIGHT, MREC, BACKGROUND_COLOR, {.width = 300, .height = 250}},
+    {BOTTOM_RIGHT, MREC, WIDTH_OVERRIDDEN, {.width = 256, .height = 250}},
+    {BOTTOM_RIGHT, MREC, ADAPTIVE_DISABLED, {.width = 300, .height = 250}},
+    {BOTTOM_RIGHT, MREC, IGNORES_SAFE_AREA, {.width = 300, .height = 250}},
+};
+
+static max_unity_ad_view_layout_input make_input(max_unity_ad_view_position position, ad_format format, layout_variant variant)
+{
+    static const double format_sizes[][2] = {{320, 50}, {728, 90}, {300, 250}};
+
+    max_unity_ad_view_layout_input input = {
+        .position = position,
+        .offset_x = OFFSET_X,
+        .offset_y = OFFSET_Y,
+        .format_width = format_sizes[format][0],
+        .format_height = format_sizes[format][1],
+        .is_mrec = format == MREC,
+        .supports_adaptive_height = format != MREC,
+        .is_adaptive_banner_disabled = variant == ADAPTIVE_DISABLED,
+        .has_width_override = variant == WIDTH_OVERRIDDEN,
+        .width_override = variant == WIDTH_OVERRIDDEN ? WIDTH_OVERRIDE : 0,
+        .window_width = WINDOW_WIDTH,
+        .window_height = WINDOW_HEIGHT,
+        .has_background_color = variant == BACKGROUND_COLOR,
+        .ignores_safe_area = variant == IGNORES_SAFE_AREA,
+        .orientation = MAX_UNITY_INTERFACE_ORIENTATION_OTHER,
+        .adaptive_height_for_width = adaptive_height_for_width,
+        .adaptive_height_context = NULL
+    };
+    return input;
+}
+
+static void print_geometry(const char *label, const max_unity_ad_view_geometry *geometry)
+{
+    fprintf(stderr, "  %-8s position=%d width=%g height=%g offset=(%g, %g) spans=%d superview_top=%d rotated=%d center_x=(%g, %d) background=%d autoresizing=%d\n",
+            label, geometry->position, geometry->width, geometry->height, geometry->offset_x, geometry->offset_y, geometry->spans_superview_width,
+            geometry->uses_superview_top, geometry->is_rotated, geometry->center_x_offset, geometry->center_x_uses_safe_area,
+            geometry->safe_area_background, geometry->autoresizing);
+}
+
+static void check_geometry(const max_unity_ad_view_layout_input *input, max_unity_ad_view_geometry expected, const char *description)
+{
+    max_unity_ad_view_geometry actual = max_unity_ad_view_compute_geometry(input);
+    if ( !max_unity_ad_view_geometry_equals(&expected, &actual) )
+    {
+        fprintf(stderr, "%s: geometry mismatch\n", description);
+        print_geometry("expected", &expected);
+        print_geometry("actual", &actual);
+        exit(1);
+    }
+}
+
+static void test_layout_table(void)
+{
+    size_t count = sizeof(layout_cases) / sizeof(layout_cases[0]);
+    CHECK(count == 9 * 3 * 5, "Expected a row for every position, format and variant but got %zu", count);
+
+    char description[128];
+    for ( size_t i = 0; i < count; i++ )
+    {
+        const layout_case *row = &layout_cases[i];
+        max_unity_ad_view_layout_input input = make_input(row->position, row->format, row->variant);
+        max_unity_ad_view_geometry expected = row->expected;
+        expected.position = row->position;
+
+        snprintf(description, sizeof(description), "Position %d, %s, %s", row->position, format_names[row->format], variant_names[row->variant]);
+        check_geometry(&input, expected, description);
+    }
+}
+
+static void test_combined_options(void)
+{
+    // A width override keeps a fixed width next to the safe area background, instead of spanning the superview
+    max_unity_ad_view_layout_input input = make_input(TOP_CENTER, BANNER, WIDTH_OVERRIDDEN);
+    input.has_background_color = true;
+    check_geometry(&input, (max_unity_ad_view_geometry) {.position = TOP_CENTER, .width = 256, .height = 64, .safe_area_background = ABOVE, .autoresizing = FLEXIBLE_BOTTOM},
+                   "Top center banner with a background color and a width override");
+
+    // ... and is used instead of the screen height for vertical banners
+    input = make_input(CENTER_RIGHT, LEADER, WIDTH_OVERRIDDEN);
+    input.has_background_color = true;
+    check_geometry(&input, (max_unity_ad_view_geometry) {.position = CENTER_RIGHT, .width = 256, .height = 64, .is_rotated = true, .center_x_offset = -32, .autoresizing = FLEXIBLE_TOP},
+                   "Center right leader with a background color and a width override");
+
+    // Adaptive banners without a height function fall back to the format height
+    input = make_input(BOTTOM_CENTER, BANNER, DEFAULT);
+    input.adaptive_height_for_width = NULL;
+    check_geometry(&input, (max_unity_ad_view_geometry) {.position = BOTTOM_CENTER, .width = 390, .height = 50, .autoresizing = FLEXIBLE_TOP},
+                   "Bottom center banner without an adaptive height function");
+
+    // Without a position only the size is constrained
+    input = make_input(MAX_UNITY_AD_VIEW_POSITION_NONE, BANNER, IGNORES_SAFE_AREA);
+    input.has_background_color = true;
+    check_geometry(&input, (max_unity_ad_view_geometry) {.width = 320, .height = 80}, "Banner without a position");
+}
+
+static void test_vertical_orientations(void)
+{
+    static const struct
+    {
+        max_unity_ad_view_position position;
+        max_unity_interface_orientation orientation;
+        bool center_x_uses_safe_area;
+    } cases[] = {
+        {CENTER_LEFT, MAX_UNITY_INTERFACE_ORIENTATION_OTHER, false},
+        {CENTER_LEFT, MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_LEFT, false},
+        {CENTER_LEFT, MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_RIGHT, true},
+        {CENTER_RIGHT, MAX_UNITY_INTERFACE_ORIENTATION_OTHER, false},
+        {CENTER_RIGHT, MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_LEFT, true},
+        {CENTER_RIGHT, MAX_UNITY_INTERFACE_ORIENTATION_LANDSCAPE_RIGHT, false},
+    };
+
+    for ( size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++ )
+    {
+        max_unity_ad_view_layout_input input = make_input(cases[i].position, BANNER, DEFAULT);
+        input.orientation = cases[i].orientation;
+        max_unity_ad_view_geometry geometry = max_unity_ad_view_compute_geometry(&input);
+        CHECK(geometry.center_x_uses_safe_area == cases[i].center_x_uses_safe_area, "Position %d in orientation %d", cases[i].position, cases[i].orientation);
+
+        // The orientation only affects vertical banners
+        for ( max_unity_ad_view_position position = TOP_LEFT; position <= BOTTOM_RIGHT; position++ )
+        {
+            if ( position == CENTER_LEFT || position == CENTER_RIGHT ) continue;
+
+            input = make_input(position, BANNER, DEFAULT);
+            max_unity_ad_view_geometry portrait = max_unity_ad_view_compute_geometry(&input);
+            input.orientation = cases[i].orientation;
+            geometry = max_unity_ad_view_compute_geometry(&input);
+            CHECK(max_unity_ad_view_geometry_equals(&portrait, &geometry), "Orientation %d changed the layout of position %d", cases[i].orientation, position);
+        }
+    }
+}
+
+static void test_geometry_equals(void)
+{
+    max_unity_ad_view_layout_input input = make_input(CENTER_LEFT, BANNER, DEFAULT);
+    max_unity_ad_view_geometry geometry = max_unity_ad_view_compute_geometry(&input);
+    max_unity_ad_view_geometry other = geometry;
+    CHECK(max_unity_ad_view_geometry_equals(&geometry, &other), "A geometry equals its copy");
+
+    // Every field takes part in the comparison
+#define CHECK_FIELD_COMPARED(field, value)                                                                 \
+    do                                                                                                     \
+    {                                                                                                      \
+        other = geometry;                                                                                  \
+        other.field = value;                                                                               \
+        CHECK(!max_unity_ad_view_geometry_equals(&geometry, &other), "Field %s is not compared", #field);  \
+        CHECK(!max_unity_ad_view_geometry_equals(&other, &geometry), "Field %s is not compared", #field);  \
+    } while ( 0 )
+
+    CHECK_FIELD_COMPARED(position, CENTER_RIGHT);
+    CHECK_FIELD_COMPARED(width, geometry.width + 1);
+    CHECK_FIELD_COMPARED(height, geometry.height + 1);
+    CHECK_FIELD_COMPARED(offset_x, 1);
+    CHECK_FIELD_COMPARED(offset_y, 1);
+    CHECK_FIELD_COMPARED(spans_superview_width, true);
+    CHECK_FIELD_COMPARED(uses_superview_top, true);
+    CHECK_FIELD_COMPARED(is_rotated, false);
+    CHECK_FIELD_COMPARED(center_x_offset, -geometry.center_x_offset);
+    CHECK_FIELD_COMPARED(center_x_uses_safe_area, true);
+    CHECK_FIELD_COMPARED(safe_area_background, LEFT);
+    CHECK_FIELD_COMPARED(autoresizing, MAX_UNITY_AUTORESIZING_UNCHANGED);
+
+#undef CHECK_FIELD_COMPARED
+
+    // Inputs that do not affect the layout of a position produce equal geometries, so the ad manager can skip rebuilding its constraints
+    static const struct
+    {
+        max_unity_ad_view_position position;
+        ad_format format;
+        layout_variant variant;
+    } unaffected[] = {
+        {TOP_CENTER, MREC, BACKGROUND_COLOR},
+        {TOP_RIGHT, BANNER, BACKGROUND_COLOR},
+        {CENTERED, LEADER, IGNORES_SAFE_AREA},
+        {CENTER_LEFT, MREC, ADAPTIVE_DISABLED},
+        {BOTTOM_CENTER, BANNER, IGNORES_SAFE_AREA},
+        {BOTTOM_LEFT, MREC, IGNORES_SAFE_AREA},
+    };
+
+    for ( size_t i = 0; i < sizeof(unaffected) / sizeof(unaffected[0]); i++ )
+    {
+        input = make_input(unaffected[i].position, unaffected[i].format, DEFAULT);
+        geometry = max_unity_ad_view_compute_geometry(&input);
+
+        input = make_input(unaffected[i].position, unaffected[i].format, unaffected[i].variant);
+        other = max_unity_ad_view_compute_geometry(&input);
+        CHECK(max_unity_ad_view_geometry_equals(&geometry, &other), "Position %d, %s: %s changed the geometry",
+              unaffected[i].position, format_names[unaffected[i].format], variant_names[unaffected[i].variant]);
+    }
+
+    // Offsets only apply to the top left position
+    for ( max_unity_ad_view_position position = TOP_LEFT; position <= BOTTOM_RIGHT; position++ )
+    {
+        input = make_input(position, BANNER, DEFAULT);
+        geometry = max_unity_ad_view_compute_geometry(&input);
+        input.offset_x = 0;
+        input.offset_y = 0;
+        other = max_unity_ad_view_compute_geometry(&input);
+        CHECK(max_unity_ad_view_geometry_equals(&geometry, &other) == (position != TOP_LEFT), "Offsets of position %d", position);
+    }
+}
+
+static void test_position_from_string(void)
+{
+    static const char *const names[] = {"top_left", "top_center", "top_right", "centered", "center_left", "center_right", "bottom_left", "bottom_center", "bottom_right"};
+    for ( size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++ )
+    {
+        CHECK(max_unity_ad_view_position_from_string(names[i]) == (max_unity_ad_view_position) (TOP_LEFT + i), "Position of %s", names[i]);
+    }
+
+    CHECK(max_unity_ad_view_position_from_string(NULL) == MAX_UNITY_AD_VIEW_POSITION_NONE, "Position of NULL");
+    CHECK(max_unity_ad_view_position_from_string("") == MAX_UNITY_AD_VIEW_POSITION_NONE, "Position of an empty name");
+    CHECK(max_unity_ad_view_position_from_string("Top_Left") == MAX_UNITY_AD_VIEW_POSITION_NONE, "Position names are case sensitive");
+}
+
+int main(void)
+{
+    test_layout_table();
+    test_combined_options();
+    test_vertical_orientations();
+    test_geometry_equals();
+    test_position_from_string();
+
+    printf("ad_view_layout_test: %zu layout cases passed\n", sizeof(layout_cases) / sizeof(layout_cases[0]));
+    return 0;
+}
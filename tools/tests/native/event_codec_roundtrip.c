@@ -0,0 +1,262 @@
+//
+//  event_codec_roundtrip.c
+//  AppLovin MAX Unity Plugin
+//
+//  Encodes one frame per event id, each holding every field id with the value type the native side encodes it as, and writes a manifest of the
+//  native event and field tables. MaxEventCodecRoundTripTests decodes both in C#, so the tables duplicated in MAUnityEventCodec.c and
+//  MaxEventCodec.cs are checked against each other. The frames are also decoded here, so the writer and reader agree too.
+//
+//  Usage: event_codec_roundtrip <output directory>
+//
+//  Values are derived from the event and field ids. NOTE: Must be kept in sync with `MaxEventCodecRoundTripTests` in MaxEventCodecRoundTripTests.cs
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MAUnityEventCodec.h"
+
+#define CHECK(condition, ...)                                    \
+    do                                                           \
+    {                                                            \
+        if ( !(condition) )                                      \
+        {                                                        \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);      \
+            fprintf(stderr, __VA_ARGS__);                        \
+            fprintf(stderr, "\n");                               \
+            exit(1);                                             \
+        }                                                        \
+    } while ( 0 )
+
+static void roundtrip_string_value(char *buffer, size_t size, const char *key, uint16_t event_id)
+{
+    snprintf(buffer, size, "%s:%u", key, (unsigned) event_id);
+}
+
+static double roundtrip_double_value(uint16_t event_id, uint8_t field_id)
+{
+    return event_id + field_id / 64.0;
+}
+
+static int64_t roundtrip_int64_value(uint16_t event_id, uint8_t field_id)
+{
+    int64_t value = ((int64_t) event_id << 40) + field_id;
+    return field_id % 2 == 1 ? -value : value;
+}
+
+static bool roundtrip_bool_value(uint16_t event_id, uint8_t field_id)
+{
+    return (event_id + field_id) % 2 == 1;
+}
+
+static uint8_t roundtrip_flags(uint16_t event_id)
+{
+    return event_id % 2 == 1 ? MAX_UNITY_EVENT_FLAG_KEEP_IN_BACKGROUND : 0;
+}
+
+// Credentials may hold nested maps and lists, which are written the way MAUnityAdManager.m writes them:
+// {"nested": {"id": 7, "list": ["x", 2.5, {"enabled": true}]}}
+#define ROUNDTRIP_NESTED_CREDENTIALS_VALUE_COUNT 11
+
+static void roundtrip_write_nested_credentials(max_unity_event_writer *writer)
+{
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "nested", 6);
+    size_t map_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_MAP);
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "id", 2);
+    max_unity_event_write_int64(writer, MAX_UNITY_FIELD_NONE, 7);
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "list", 4);
+
+    size_t list_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_LIST);
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "x", 1);
+    max_unity_event_write_double(writer, MAX_UNITY_FIELD_NONE, 2.5);
+
+    size_t item_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_MAP);
+    max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "enabled", 7);
+    max_unity_event_write_bool(writer, MAX_UNITY_FIELD_NONE, true);
+    max_unity_event_end_container(writer, item_marker);
+
+    max_unity_event_end_container(writer, list_marker);
+    max_unity_event_end_container(writer, map_marker);
+}
+
+// Counts the values in a container, including the values of nested containers
+static int roundtrip_count_values(max_unity_event_reader container)
+{
+    max_unity_event_value item;
+    int count = 0;
+    while ( max_unity_event_reader_next(&container, &item) )
+    {
+        count++;
+        if ( item.type == MAX_UNITY_VALUE_OBJECT || item.type == MAX_UNITY_VALUE_LIST || item.type == MAX_UNITY_VALUE_MAP )
+        {
+            count += roundtrip_count_values(item.container);
+        }
+    }
+    CHECK(container.position == container.end, "Container is malformed");
+    return count;
+}
+
+static void roundtrip_write_field(max_unity_event_writer *writer, uint16_t event_id, uint8_t field_id, const char *key, max_unity_value_type type)
+{
+    char string[128];
+    switch ( type )
+    {
+        case MAX_UNITY_VALUE_STRING:
+            roundtrip_string_value(string, sizeof(string), key, event_id);
+            max_unity_event_write_string(writer, field_id, string, strlen(string));
+            break;
+        case MAX_UNITY_VALUE_DOUBLE:
+            max_unity_event_write_double(writer, field_id, roundtrip_double_value(event_id, field_id));
+            break;
+        case MAX_UNITY_VALUE_INT64:
+            max_unity_event_write_int64(writer, field_id, roundtrip_int64_value(event_id, field_id));
+            break;
+        case MAX_UNITY_VALUE_BOOL:
+            max_unity_event_write_bool(writer, field_id, roundtrip_bool_value(event_id, field_id));
+            break;
+        case MAX_UNITY_VALUE_OBJECT:
+        {
+            size_t marker = max_unity_event_begin_container(writer, field_id, MAX_UNITY_VALUE_OBJECT);
+            max_unity_event_write_string(writer, MAX_UNITY_FIELD_NAME, key, strlen(key));
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        case MAX_UNITY_VALUE_LIST:
+        {
+            size_t marker = max_unity_event_begin_container(writer, field_id, MAX_UNITY_VALUE_LIST);
+            for ( int i = 0; i < 2; i++ )
+            {
+                snprintf(string, sizeof(string), "item%d", i);
+                size_t item_marker = max_unity_event_begin_container(writer, MAX_UNITY_FIELD_NONE, MAX_UNITY_VALUE_OBJECT);
+                max_unity_event_write_string(writer, MAX_UNITY_FIELD_NAME, string, strlen(string));
+                max_unity_event_end_container(writer, item_marker);
+            }
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        case MAX_UNITY_VALUE_MAP:
+        {
+            size_t marker = max_unity_event_begin_container(writer, field_id, MAX_UNITY_VALUE_MAP);
+            snprintf(string, sizeof(string), "%u", (unsigned) event_id);
+            max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "key", 3);
+            max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, key, strlen(key));
+            max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, "eventId", 7);
+            max_unity_event_write_string(writer, MAX_UNITY_FIELD_NONE, string, strlen(string));
+            if ( field_id == MAX_UNITY_FIELD_CREDENTIALS )
+            {
+                roundtrip_write_nested_credentials(writer);
+            }
+            max_unity_event_end_container(writer, marker);
+            break;
+        }
+        default:
+            CHECK(false, "Field %u has no value type", (unsigned) field_id);
+    }
+}
+
+static void roundtrip_check_field(const max_unity_event_value *value, uint16_t event_id, const char *key, max_unity_value_type type)
+{
+    char string[128];
+    CHECK(value->type == type, "Field %u of event %u decoded as type %d instead of %d", (unsigned) value->field_id, (unsigned) event_id, value->type, type);
+
+    switch ( type )
+    {
+        case MAX_UNITY_VALUE_STRING:
+            roundtrip_string_value(string, sizeof(string), key, event_id);
+            CHECK(value->string_length == strlen(string) && memcmp(value->string_value, string, value->string_length) == 0, "String field %s mismatch", key);
+            break;
+        case MAX_UNITY_VALUE_DOUBLE:
+            CHECK(value->double_value == roundtrip_double_value(event_id, value->field_id), "Double field %s mismatch", key);
+            break;
+        case MAX_UNITY_VALUE_INT64:
+            CHECK(value->int64_value == roundtrip_int64_value(event_id, value->field_id), "Int64 field %s mismatch", key);
+            break;
+        case MAX_UNITY_VALUE_BOOL:
+            CHECK(value->bool_value == roundtrip_bool_value(event_id, value->field_id), "Bool field %s mismatch", key);
+            break;
+        default:
+        {
+            // Containers are checked in depth by the C# side, here only that they can be walked
+            int count = roundtrip_count_values(value->container);
+            CHECK(count > 0, "Container field %s is empty", key);
+            if ( value->field_id == MAX_UNITY_FIELD_CREDENTIALS )
+            {
+                CHECK(count == 4 + ROUNDTRIP_NESTED_CREDENTIALS_VALUE_COUNT, "Credentials hold %d values including nested ones", count);
+            }
+            break;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    CHECK(argc == 2, "Usage: %s <output directory>", argv[0]);
+
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/event_codec_roundtrip.txt", argv[1]);
+    FILE *manifest = fopen(path, "w");
+    CHECK(manifest, "Failed to open %s", path);
+
+    // The C tables must be consistent with themselves before they are compared with C#
+    max_unity_value_type types[MAX_UNITY_FIELD_COUNT];
+    for ( uint16_t event_id = 1; event_id < MAX_UNITY_EVENT_COUNT; event_id++ )
+    {
+        const char *name = max_unity_event_name_for_id(event_id);
+        CHECK(name && max_unity_event_id_for_name(name) == event_id, "Event %u does not map back to its id", (unsigned) event_id);
+        fprintf(manifest, "event %u %s\n", (unsigned) event_id, name);
+    }
+
+    for ( uint8_t field_id = 1; field_id < MAX_UNITY_FIELD_COUNT; field_id++ )
+    {
+        const char *key = max_unity_event_key_for_field(field_id);
+        CHECK(key && max_unity_event_field_for_key(key, &types[field_id]) == field_id, "Field %u does not map back to its id", (unsigned) field_id);
+        fprintf(manifest, "field %u %s %d\n", (unsigned) field_id, key, types[field_id]);
+    }
+
+    fclose(manifest);
+
+    max_unity_event_writer writer;
+    max_unity_event_writer_init(&writer, 4096);
+    for ( uint16_t event_id = 1; event_id < MAX_UNITY_EVENT_COUNT; event_id++ )
+    {
+        max_unity_event_begin_next(&writer, event_id, roundtrip_flags(event_id));
+        for ( uint8_t field_id = 1; field_id < MAX_UNITY_FIELD_COUNT; field_id++ )
+        {
+            roundtrip_write_field(&writer, event_id, field_id, max_unity_event_key_for_field(field_id), types[field_id]);
+        }
+        CHECK(max_unity_event_end(&writer), "Failed to encode event %u", (unsigned) event_id);
+    }
+
+    size_t offset = 0;
+    for ( uint16_t event_id = 1; event_id < MAX_UNITY_EVENT_COUNT; event_id++ )
+    {
+        max_unity_event_reader reader;
+        uint16_t decoded_event_id;
+        uint8_t flags;
+        CHECK(max_unity_event_reader_open(&reader, writer.bytes + offset, writer.length - offset, &decoded_event_id, &flags), "Failed to open frame %u", (unsigned) event_id);
+        CHECK(decoded_event_id == event_id && flags == roundtrip_flags(event_id), "Frame %u has the wrong header", (unsigned) event_id);
+
+        max_unity_event_value value;
+        uint8_t expected_field_id = 1;
+        while ( max_unity_event_reader_next(&reader, &value) )
+        {
+            CHECK(value.field_id == expected_field_id, "Expected field %u but got %u", (unsigned) expected_field_id, (unsigned) value.field_id);
+            roundtrip_check_field(&value, event_id, max_unity_event_key_for_field(value.field_id), types[value.field_id]);
+            expected_field_id++;
+        }
+        CHECK(expected_field_id == MAX_UNITY_FIELD_COUNT && reader.position == reader.end, "Frame %u was not fully decoded", (unsigned) event_id);
+
+        offset += reader.end;
+    }
+    CHECK(offset == writer.length, "Trailing bytes after the last frame");
+
+    snprintf(path, sizeof(path), "%s/event_codec_roundtrip.bin", argv[1]);
+    FILE *frames = fopen(path, "wb");
+    CHECK(frames && fwrite(writer.bytes, 1, writer.length, frames) == writer.length, "Failed to write %s", path);
+    fclose(frames);
+
+    printf("event_codec_roundtrip: %d events, %d fields, %zu bytes\n", MAX_UNITY_EVENT_COUNT - 1, MAX_UNITY_FIELD_COUNT - 1, writer.length);
+    max_unity_event_writer_free(&writer);
+    return 0;
+}
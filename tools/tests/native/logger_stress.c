@@ -0,0 +1,215 @@
+//
+//  logger_stress.c
+//  AppLovin MAX Unity Plugin
+//
+//  Stress test for the MAUnityLogger.c ring: several threads log numbered messages as fast as they can while the background writer drains them.
+//  The ring drops messages instead of blocking once it is full, so every message must either reach the writer, in the order its thread logged it,
+//  or be counted as dropped and reported by the writer. Also checks level gating and that truncation does not split a UTF-8 sequence.
+//
+//  Usage: logger_stress [thread count] [messages per thread]
+//
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "MAUnityLogger.h"
+
+#define CHECK(condition, ...)                                    \
+    do                                                           \
+    {                                                            \
+        if ( !(condition) )                                      \
+        {                                                        \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);      \
+            fprintf(stderr, __VA_ARGS__);                        \
+            fprintf(stderr, "\n");                               \
+            exit(1);                                             \
+        }                                                        \
+    } while ( 0 )
+
+#define MAX_THREAD_COUNT 64
+
+static int thread_count = 4;
+static long messages_per_thread = 200000;
+
+// Written by the writer thread
+static long next_sequences[MAX_THREAD_COUNT];
+static long received_counts[MAX_THREAD_COUNT];
+static atomic_llong received_total;
+static atomic_ullong reported_dropped_total;
+static atomic_bool flush_received;
+static atomic_size_t truncated_length;
+static atomic_bool order_violated;
+
+static void stress_writer(max_unity_log_level level, const char *message, size_t length)
+{
+    int thread_index;
+    long sequence;
+    unsigned long long dropped;
+
+    if ( sscanf(message, "stress thread=%d sequence=%ld", &thread_index, &sequence) == 2 )
+    {
+        if ( thread_index < 0 || thread_index >= thread_count || sequence < next_sequences[thread_index] || level != MAX_UNITY_LOG_LEVEL_WARNING )
+        {
+            fprintf(stderr, "Out of order message: %s (expected sequence >= %ld)\n", message, thread_index >= 0 && thread_index < thread_count ? next_sequences[thread_index] : -1);
+            atomic_store(&order_violated, true);
+            return;
+        }
+
+        next_sequences[thread_index] = sequence + 1;
+        received_counts[thread_index]++;
+        atomic_fetch_add(&received_total, 1);
+    }
+    else if ( sscanf(message, "Dropped %llu log messages", &dropped) == 1 )
+    {
+        atomic_fetch_add(&reported_dropped_total, dropped);
+    }
+    else if ( strcmp(message, "stress flush") == 0 )
+    {
+        atomic_store(&flush_received, true);
+    }
+    else if ( strncmp(message, "truncated ", 10) == 0 )
+    {
+        CHECK(strlen(message) == length, "Truncated message length %zu does not match its NUL terminator", length);
+        atomic_store(&truncated_length, length);
+    }
+}
+
+static void *stress_thread_main(void *argument)
+{
+    int thread_index = (int) (intptr_t) argument;
+    char message[64];
+    for ( long sequence = 0; sequence < messages_per_thread; sequence++ )
+    {
+        int length = snprintf(message, sizeof(message), "stress thread=%d sequence=%ld", thread_index, sequence);
+        max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_WARNING, message, (size_t) length);
+    }
+
+    return NULL;
+}
+
+static void sleep_milliseconds(long milliseconds)
+{
+    struct timespec duration = {milliseconds / 1000, (milliseconds % 1000) * 1000000L};
+    nanosleep(&duration, NULL);
+}
+
+static bool wait_for(atomic_bool *flag, long timeout_milliseconds)
+{
+    for ( long waited = 0; waited < timeout_milliseconds; waited++ )
+    {
+        if ( atomic_load(flag) ) return true;
+
+        sleep_milliseconds(1);
+    }
+
+    return atomic_load(flag);
+}
+
+static void test_level_gating(void)
+{
+    max_unity_log_set_level(MAX_UNITY_LOG_LEVEL_WARNING);
+    CHECK(!max_unity_log_is_enabled(MAX_UNITY_LOG_LEVEL_DEBUG), "Debug enabled at the warning level");
+    CHECK(max_unity_log_is_enabled(MAX_UNITY_LOG_LEVEL_ERROR), "Error disabled at the warning level");
+    CHECK(!max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_DEBUG, "debug", 5), "Debug message enqueued at the warning level");
+
+    max_unity_log_set_level(MAX_UNITY_LOG_LEVEL_NONE);
+    CHECK(!max_unity_log_is_enabled(MAX_UNITY_LOG_LEVEL_ERROR), "Error enabled with logging disabled");
+    CHECK(!max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_ERROR, "error", 5), "Error message enqueued with logging disabled");
+    CHECK(!max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_NONE, "none", 4), "Message enqueued at the none level");
+
+    CHECK(max_unity_log_dropped_count() == 0, "Disabled messages were counted as dropped");
+    max_unity_log_set_level(MAX_UNITY_LOG_LEVEL_WARNING);
+}
+
+static void test_truncation(void)
+{
+    // Two byte UTF-8 sequences after an odd length prefix, so the capacity falls in the middle of one
+    char message[MAX_UNITY_LOG_MESSAGE_CAPACITY + 64];
+    size_t length = strlen("truncated ");
+    memcpy(message, "truncated ", length);
+    while ( length + 2 < sizeof(message) )
+    {
+        message[length++] = (char) 0xC3;
+        message[length++] = (char) 0xA9;
+    }
+
+    CHECK(max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_ERROR, message, length), "Failed to enqueue the long message");
+
+    for ( int waited = 0; waited < 5000 && atomic_load(&truncated_length) == 0; waited++ )
+    {
+        sleep_milliseconds(1);
+    }
+
+    size_t written_length = atomic_load(&truncated_length);
+    CHECK(written_length > 0 && written_length < MAX_UNITY_LOG_MESSAGE_CAPACITY, "Long message was written with length %zu", written_length);
+    CHECK((written_length - strlen("truncated ")) % 2 == 0, "Truncation split a UTF-8 sequence at length %zu", written_length);
+}
+
+int main(int argc, char *argv[])
+{
+    if ( argc > 1 ) thread_count = atoi(argv[1]);
+    if ( argc > 2 ) messages_per_thread = atol(argv[2]);
+    CHECK(thread_count > 0 && thread_count <= MAX_THREAD_COUNT && messages_per_thread > 0, "Usage: %s [thread count] [messages per thread]", argv[0]);
+
+    test_level_gating();
+
+    max_unity_log_set_writer(stress_writer);
+    test_truncation();
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t threads[MAX_THREAD_COUNT];
+    for ( int i = 0; i < thread_count; i++ )
+    {
+        CHECK(pthread_create(&threads[i], NULL, stress_thread_main, (void *) (intptr_t) i) == 0, "Failed to start thread %d", i);
+    }
+
+    for ( int i = 0; i < thread_count; i++ )
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    // The writer reports drops after draining, so one more message makes it report the drops of the final burst.
+    // Attempts that find the ring still full are dropped and counted like any other message.
+    unsigned long long dropped_flush_count = 0;
+    while ( !max_unity_log_enqueue(MAX_UNITY_LOG_LEVEL_WARNING, "stress flush", strlen("stress flush")) )
+    {
+        dropped_flush_count++;
+        sleep_milliseconds(1);
+    }
+
+    CHECK(wait_for(&flush_received, 10000), "The writer did not drain the ring");
+    for ( int waited = 0; waited < 10000 && atomic_load(&reported_dropped_total) != max_unity_log_dropped_count(); waited++ )
+    {
+        sleep_milliseconds(1);
+    }
+
+    CHECK(!atomic_load(&order_violated), "Messages were written out of order");
+
+    long long total = (long long) thread_count * messages_per_thread;
+    unsigned long long dropped = max_unity_log_dropped_count();
+    CHECK(atomic_load(&reported_dropped_total) == dropped, "The writer reported %llu dropped messages, but %llu were dropped",
+          (unsigned long long) atomic_load(&reported_dropped_total), dropped);
+
+    dropped -= dropped_flush_count;
+    long long received = atomic_load(&received_total);
+    CHECK(received + (long long) dropped == total, "%lld messages were written and %llu dropped, out of %lld", received, dropped, total);
+
+    for ( int i = 0; i < thread_count; i++ )
+    {
+        CHECK(received_counts[i] > 0, "No message of thread %d was written", i);
+    }
+
+    double seconds = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("logger_stress: %d threads x %ld messages in %.3f s (%.1f M/s), %lld written, %llu dropped\n",
+           thread_count, messages_per_thread, seconds, (double) total / seconds / 1e6, received, dropped);
+    return 0;
+}